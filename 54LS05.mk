@@ -43,7 +43,7 @@ INCLUDES:=-I${NATIVE_SIM_PATH}/common/src/include/ \
           -I${NRFX_BASE}/drivers/include
 
 NRF_HW_MODELS_LIB_SUFFIX?=
-LIB_NAME=libnRF_hw_models.${VARIANT}.32${NRF_HW_MODELS_LIB_SUFFIX}
+LIB_NAME=libnRF_hw_models.${VARIANT}.${NHW_BITS}${NRF_HW_MODELS_LIB_SUFFIX}
 A_LIBS:=
 A_LIBS32:=
 SO_LIBS:=
@@ -2,7 +2,23 @@
 # Copyright 2023 Nordic Semiconductor ASA
 # SPDX-License-Identifier: Apache-2.0
 
-OBJS=$(abspath $(addprefix $(COMPONENT_OUTPUT_DIR)/,${SRCS:.c=.${VARIANT}.o}))
+# The objects of each build variant are kept apart, so switching variants rebuilds them
+OBJ_VARIANT:=${VARIANT}$(if $(filter-out 32,${NHW_BITS}),.${NHW_BITS})$(if $(filter 1,${NHW_UNITY_BUILD}),.unity)$(if $(filter 1,${NHW_LTO}),.lto)
+
+BUILD_SRCS:=${SRCS}
+UNITY_OBJ:=
+ifeq (${NHW_UNITY_BUILD},1)
+  UNITY_SRCS:=$(filter src/HW_models/%,${SRCS})
+  ifneq (,${UNITY_SRCS})
+    UNITY_FILE:=$(abspath $(COMPONENT_OUTPUT_DIR)/${LIB_NAME}.unity.c)
+    # The script prints the sources which cannot be merged and need to be built on their own
+    UNITY_STANDALONE_SRCS:=$(shell python3 scripts/gen_unity_src.py -o ${UNITY_FILE} ${UNITY_SRCS})
+    BUILD_SRCS:=$(filter-out ${UNITY_SRCS},${SRCS}) ${UNITY_STANDALONE_SRCS}
+    UNITY_OBJ:=${UNITY_FILE:.c=.${OBJ_VARIANT}.o}
+  endif
+endif
+
+OBJS=$(abspath $(addprefix $(COMPONENT_OUTPUT_DIR)/,${BUILD_SRCS:.c=.${OBJ_VARIANT}.o})) ${UNITY_OBJ}
 LIBFILE=${LIB_NAME}.a
 VERSION_FILE:=${LIB_NAME}.version
 
@@ -24,10 +40,15 @@ compile: $(COMPONENT_OUTPUT_DIR)/${LIBFILE}
 $(COMPONENT_OUTPUT_DIR):
 	@mkdir -p $(COMPONENT_OUTPUT_DIR)
 
-$(COMPONENT_OUTPUT_DIR)/%.${VARIANT}.o: %.c
+$(COMPONENT_OUTPUT_DIR)/%.${OBJ_VARIANT}.o: %.c
 	@if [ ! -d $(dir $@) ]; then mkdir -p $(dir $@); fi
 	@${CC} ${CPPFLAGS} ${CFLAGS} ${COVERAGE} -c $< -o $@
 
+ifneq (,${UNITY_OBJ})
+${UNITY_OBJ}: ${UNITY_FILE}
+	@${CC} ${CPPFLAGS} ${CFLAGS} ${COVERAGE} -c $< -o $@
+endif
+
 %.c: ;
 %.h: ;
 
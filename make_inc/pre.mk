@@ -20,9 +20,24 @@ CC:=ccache gcc
 
 DEBUG:=-g
 OPT:=
-ARCH:=-m32
+# Set NHW_BITS=64 to build the models for a 64 bit host (see docs/README_HW_models.md)
+NHW_BITS?=32
+ARCH:=-m${NHW_BITS}
 WARNINGS:=-Wall -Wpedantic -Wextra -Wsign-compare -Wshadow
 COVERAGE:=
+
+# Optional build variants (see docs/README_HW_models.md):
+# NHW_UNITY_BUILD=1 compiles all HW models as one translation unit
+# NHW_LTO=1 compiles with link time optimization (fat objects, so the libraries are still
+# usable by programs linked without LTO)
+NHW_UNITY_BUILD?=0
+NHW_LTO?=0
+LTO_FLAGS:=
+ifeq (${NHW_LTO},1)
+  LTO_FLAGS:=-flto -ffat-lto-objects
+  AR:=gcc-ar
+endif
+
 COMMON_CC_FLAGS:=\
-  ${ARCH} ${DEBUG} ${OPT} ${WARNINGS} -MMD -MP -std=gnu11 \
+  ${ARCH} ${DEBUG} ${OPT} ${LTO_FLAGS} ${WARNINGS} -MMD -MP -std=gnu11 \
   -fdata-sections -ffunction-sections -D_XOPEN_SOURCE=500 -fno-pie -fno-pic ${EXTRA_CC_FLAGS}
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Nordic Semiconductor ASA
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Generate a unity build source file: a single C file which #includes a set of the HW models
+sources, so they are compiled as one translation unit and the compiler can inline calls
+across them (for ex. into the DPPI, interrupt controller or event signaling functions).
+
+After each included source, the macros it defined are #undef'ed, so they do not leak into the
+next ones. Sources which set feature test macros (like _DEFAULT_SOURCE or _XOPEN_SOURCE)
+need to be compiled on their own, as those only have an effect before the first system
+header is included. Those are not included in the unity file, but printed to stdout instead,
+one per line, so the build system can compile them separately.
+
+The output file is only rewritten if its content changes, to avoid needless rebuilds.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+DEFINE_RE = re.compile(r"^\s*#\s*define\s+(\w+)", re.M)
+FEATURE_TEST_RE = re.compile(r"^\s*#\s*(?:define|undef)\s+_\w+_SOURCE\b", re.M)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("-o", "--output", required=True, help="Unity source file to generate")
+    parser.add_argument("sources", nargs="*", help="C sources to merge")
+    args = parser.parse_args()
+
+    lines = ["/* Generated by gen_unity_src.py, do not edit */", ""]
+    standalone = []
+
+    for src in args.sources:
+        with open(src, "r") as f:
+            content = f.read()
+        if FEATURE_TEST_RE.search(content):
+            standalone.append(src)
+            continue
+        lines.append('#include "%s"' % os.path.abspath(src))
+        for macro in sorted(set(DEFINE_RE.findall(content))):
+            lines.append("#undef %s" % macro)
+
+    new_content = "\n".join(lines) + "\n"
+    try:
+        with open(args.output, "r") as f:
+            old_content = f.read()
+    except OSError:
+        old_content = None
+    if new_content != old_content:
+        os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+        with open(args.output, "w") as f:
+            f.write(new_content)
+
+    for src in standalone:
+        print(src)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Nordic Semiconductor ASA
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Convert GPIO stimuli/output files between the csv and binary formats
+understood by the GPIO models, and to VCD (value change dump) for waveform viewers.
+
+The input format (csv or binary) is detected automatically.
+The output format is selected with --to, or otherwise deduced from the output file extension
+(.csv, .bin or .vcd).
+
+Check docs/GPIO.md for a description of the formats.
+"""
+
+import argparse
+import os
+import sys
+
+BIN_MAGIC = b"NHWGPIO\0"
+BIN_VERSION = 1
+BIN_LEVEL_BIT = 0x80
+
+
+def read_csv(path):
+    """Yield (time, port, pin, level) records from a csv file"""
+    with open(path, "r") as f:
+        for line_nbr, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line or line.startswith("time"):
+                continue
+            fields = line.split(",")
+            try:
+                time, port, pin, level = (int(x, 0) for x in fields)
+            except ValueError:
+                sys.exit(f"{path}:{line_nbr}: Expected <time>,<port>,<pin>,<level>. "
+                         f"Line was: {line}")
+            yield time, port, pin, level
+
+
+def read_bin(path):
+    """Yield (time, port, pin, level) records from a binary file"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[len(BIN_MAGIC)] != BIN_VERSION:
+        sys.exit(f"{path}: Unsupported binary format version ({data[len(BIN_MAGIC)]})")
+    pos = len(BIN_MAGIC) + 1
+    time = 0
+    while pos < len(data):
+        start = pos
+        delta = 0
+        shift = 0
+        while True:
+            if pos >= len(data):
+                sys.exit(f"{path}: Truncated record at offset {start}")
+            byte = data[pos]
+            pos += 1
+            delta |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        if pos + 2 > len(data):
+            sys.exit(f"{path}: Truncated record at offset {start}")
+        time += delta
+        port = data[pos]
+        pin = data[pos + 1] & ~BIN_LEVEL_BIT
+        level = 1 if data[pos + 1] & BIN_LEVEL_BIT else 0
+        pos += 2
+        yield time, port, pin, level
+
+
+def write_csv(path, records):
+    with open(path, "w") as f:
+        f.write("time(microsecond),port,pin,level\n")
+        for time, port, pin, level in records:
+            f.write(f"{time},{port},{pin},{level}\n")
+
+
+def write_bin(path, records):
+    out = bytearray(BIN_MAGIC)
+    out.append(BIN_VERSION)
+    last_time = 0
+    for time, port, pin, level in records:
+        if time < last_time:
+            sys.exit(f"Records go back in time ({time} < {last_time}), "
+                     "which the binary format cannot represent")
+        if port > 0xFF or pin >= BIN_LEVEL_BIT or level not in (0, 1):
+            sys.exit(f"Record out of range for the binary format: {time},{port},{pin},{level}")
+        delta = time - last_time
+        last_time = time
+        while delta >= 0x80:
+            out.append((delta & 0x7F) | 0x80)
+            delta >>= 7
+        out.append(delta)
+        out.append(port)
+        out.append(pin | (BIN_LEVEL_BIT if level else 0))
+    with open(path, "wb") as f:
+        f.write(out)
+
+
+def vcd_id(port, pin, max_pins):
+    index = port * max_pins + pin
+    id = ""
+    while True:
+        id += chr(ord("!") + index % 94)
+        index //= 94
+        if index == 0:
+            return id
+
+
+def write_vcd(path, records):
+    # As we need to know which pins are used before writing the header,
+    # we need to go thru all records first
+    records = list(records)
+    pins = sorted({(port, pin) for _, port, pin, _ in records})
+    max_pins = max([pin + 1 for _, pin in pins] + [32])
+    with open(path, "w") as f:
+        f.write("$version nRF HW models GPIO output $end\n")
+        f.write("$timescale 1us $end\n")
+        f.write("$scope module gpio $end\n")
+        for port, pin in pins:
+            f.write(f"$var wire 1 {vcd_id(port, pin, max_pins)} P{port}_{pin} $end\n")
+        f.write("$upscope $end\n")
+        f.write("$enddefinitions $end\n")
+        f.write("$dumpvars\n")
+        for port, pin in pins:
+            f.write(f"x{vcd_id(port, pin, max_pins)}\n")
+        f.write("$end\n")
+        last_time = None
+        for time, port, pin, level in records:
+            if time != last_time:
+                f.write(f"#{time}\n")
+                last_time = time
+            f.write(f"{level}{vcd_id(port, pin, max_pins)}\n")
+
+
+def is_bin(path):
+    with open(path, "rb") as f:
+        return f.read(len(BIN_MAGIC)) == BIN_MAGIC
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="Input file (csv or binary)")
+    parser.add_argument("output", help="Output file")
+    parser.add_argument("--to", choices=["csv", "bin", "vcd"],
+                        help="Output format (by default deduced from the output file extension)")
+    args = parser.parse_args()
+
+    out_format = args.to
+    if out_format is None:
+        out_format = os.path.splitext(args.output)[1].lstrip(".").lower()
+        if out_format not in ("csv", "bin", "vcd"):
+            sys.exit(f"Cannot deduce the output format from {args.output}, use --to")
+
+    records = read_bin(args.input) if is_bin(args.input) else read_csv(args.input)
+
+    {"csv": write_csv, "bin": write_bin, "vcd": write_vcd}[out_format](args.output, records)
+
+
+if __name__ == "__main__":
+    main()
@@ -6,6 +6,12 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <immintrin.h>
+#define HWU_X86_SIMD 1
+#endif
 
 void hwu_reverse_byte_order(const unsigned char *in_data, unsigned char *out_data, size_t len)
 {
@@ -16,3 +22,75 @@ void hwu_reverse_byte_order(const unsigned char *in_data, unsigned char *out_dat
         *out_data++ = *in_data--;
     }
 }
+
+static void hwu_and_into_generic(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+        uint32_t d, s;
+        memcpy(&d, dst + i, sizeof(uint32_t));
+        memcpy(&s, src + i, sizeof(uint32_t));
+        d &= s;
+        memcpy(dst + i, &d, sizeof(uint32_t));
+    }
+    for (; i < len; i++) {
+        dst[i] &= src[i];
+    }
+}
+
+#if defined(HWU_X86_SIMD)
+__attribute__((target("avx2")))
+static void hwu_and_into_avx2(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_and_si256(d, s));
+    }
+    hwu_and_into_generic(dst + i, src + i, len - i);
+}
+
+__attribute__((target("sse2")))
+static void hwu_and_into_sse2(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_and_si128(d, s));
+    }
+    hwu_and_into_generic(dst + i, src + i, len - i);
+}
+#endif
+
+/*
+ * dst[i] &= src[i] for i in [0, len)
+ *
+ * (For ex. to model programming NOR flash, where writes can only clear bits)
+ * On x86 hosts the AVX2 or SSE2 versions are used if the CPU supports them,
+ * irrespectively of the compilation flags.
+ */
+void hwu_and_into(uint8_t *dst, const uint8_t *src, size_t len)
+{
+#if defined(HWU_X86_SIMD)
+    static void (*and_into_f)(uint8_t *dst, const uint8_t *src, size_t len);
+
+    if (and_into_f == NULL) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            and_into_f = hwu_and_into_avx2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            and_into_f = hwu_and_into_sse2;
+        } else {
+            and_into_f = hwu_and_into_generic;
+        }
+    }
+    and_into_f(dst, src, len);
+#else
+    hwu_and_into_generic(dst, src, len);
+#endif
+}
@@ -7,12 +7,14 @@
 #define _NRF_HW_MODEL_UTILS_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C"{
 #endif
 
 void hwu_reverse_byte_order(const unsigned char *in_data, unsigned char *out_data, size_t len);
+void hwu_and_into(uint8_t *dst, const uint8_t *src, size_t len);
 
 #ifdef __cplusplus
 }
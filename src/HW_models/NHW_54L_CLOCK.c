@@ -56,6 +56,7 @@
 #include "bs_utils.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 union NRF_CLKPWR_Type NRF_CLKPWR_regs[NHW_CLKPWR_TOTAL_INST];
 
@@ -324,27 +325,28 @@ void nhw_pwrclk_regw_sideeffects_EVENTS_all(uint inst) {
 }
 
 #if !defined(CLOCK_PUBLISH_XOSTARTED_ResetValue) /* no PUBLISH registers in MDK */
-#undef NHW_SIGNAL_EVENT
-#define NHW_SIGNAL_EVENT(peri, peri_regs, event) \
+#define CLOCK_SIGNAL_EVENT(peri, peri_regs, event) \
   void nhw_##peri##_signal_EVENTS_##event(unsigned int inst) \
   { \
       peri_regs EVENTS_##event = 1; \
       nhw_##peri##_eval_interrupt(inst); \
   }
+#else
+#define CLOCK_SIGNAL_EVENT NHW_SIGNAL_EVENT
 #endif
 
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOSTARTED)
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, PLLSTARTED)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOSTARTED)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, PLLSTARTED)
 #if (NHW_CLKPWR_HAS_LFCLK)
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, LFCLKSTARTED)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, LFCLKSTARTED)
 #endif
 #if (NHW_CLKPWR_HAS_PLL_24M)
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XO24MSTARTED)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XO24MSTARTED)
 #endif
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, DONE)
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOTUNED)
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOTUNEERROR)
-NHW_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOTUNEFAILED)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, DONE)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOTUNED)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOTUNEERROR)
+CLOCK_SIGNAL_EVENT(CLOCK, NRF_CLOCK_regs[0]->, XOTUNEFAILED)
 
 NHW_SIDEEFFECTS_TASKS(CLOCK, NRF_CLOCK_regs[0]->, XOSTART)
 NHW_SIDEEFFECTS_TASKS(CLOCK, NRF_CLOCK_regs[0]->, XOSTOP)
@@ -368,8 +370,8 @@ NHW_SIDEEFFECTS_TASKS(CLOCK, NRF_CLOCK_regs[0]->, XOTUNEABORT)
   } \
   void nhw_CLOCK_regw_sideeffects_SUBSCRIBE_##task(unsigned int inst) { \
     static struct nhw_subsc_mem task##_subscribed[NHW_CLKPWR_TOTAL_INST]; \
-    nhw_dppi_common_subscribe_sideeffect(nhw_CLOCK_dppi_map[inst], \
-        NRF_CLOCK_regs[0]->SUBSCRIBE_##task, \
+    nhw_dppi_common_subscribe_sideeffect_reg(nhw_CLOCK_dppi_map[inst], \
+        &NRF_CLOCK_regs[0]->SUBSCRIBE_##task, \
         &task##_subscribed[inst], \
         nhw_CLOCK_TASK_##task##_wrap, \
         (void*) inst); \
@@ -533,7 +535,7 @@ static void nhw_pwrclk_timer_triggered(void) {
   } /* LCOV_EXCL_STOP */
 }
 
-NSI_HW_EVENT(Timer_PWRCLK, nhw_pwrclk_timer_triggered, 50);
+NHW_HW_EVENT(Timer_PWRCLK, nhw_pwrclk_timer_triggered, 50);
 
 void nhw_clock_cheat_set_start_time(uint inst, int clock, int source, bs_time_t time) {
   (void)inst;
@@ -89,6 +89,8 @@
 #include "BLECrypt_if.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
+#include "NHW_dma_addr.h"
 
 static bs_time_t Timer_AAR_CCM_ECB = TIME_NEVER;
 
@@ -170,7 +172,7 @@ static void nhw_AARCCMECB_init(void) {
 
 NSI_TASK(nhw_AARCCMECB_init, HW_INIT, 100);
 
-static void update_master_timer(void) {
+static void nhw_AARCCMECB_update_master_timer(void) {
   Timer_AAR_CCM_ECB = TIME_NEVER;
   for (int i = 0; i < NHW_AARCCMECB_TOTAL_INST; i++) {
     if (nhw_aar_st[i].Running) {
@@ -255,11 +257,11 @@ static void nhw_ECB_eval_interrupt(uint inst) {
      struct peri##_status *st = &nhw_##peri##_st[inst];                             \
      static struct nhw_subsc_mem task##_subscribed[NHW_AARCCMECB_TOTAL_INST];       \
                                                                                     \
-     nhw_dppi_common_subscribe_sideeffect(nhw_AARCCMECB_dppi_map[inst],             \
-                                          st->NRF_##PERI##_regs->SUBSCRIBE_##TASK_N,\
-                                          &task##_subscribed[inst],                 \
-                                          nhw_##PERI##_task##TASK_N##_wrap,         \
-                                          (void*) inst);                            \
+     nhw_dppi_common_subscribe_sideeffect_reg(nhw_AARCCMECB_dppi_map[inst],         \
+                                              &st->NRF_##PERI##_regs->SUBSCRIBE_##TASK_N,\
+                                              &task##_subscribed[inst],             \
+                                              nhw_##PERI##_task##TASK_N##_wrap,     \
+                                              (void*) inst);                        \
   }
 
 
@@ -272,7 +274,7 @@ static void nhw_AAR_stop(uint inst) {
   struct aar_status *st = &nhw_aar_st[inst];
   st->Running = false;
   st->Timer = TIME_NEVER;
-  update_master_timer();
+  nhw_AARCCMECB_update_master_timer();
 }
 
 static void nhw_AAR_resolve_logic(uint inst) {
@@ -283,12 +285,17 @@ static void nhw_AAR_resolve_logic(uint inst) {
   int ret;
   size_t n_access;
   uint32_t hash = 0, prand = 0, hash_check;
-  uint8_t irk[16];
   uint n_resolved = 0;
   uint n_iter = 0;
   uint8_t prand_buf[16], hash_check_buf[16];
 
 #define MAX_IRKS 4095
+#define IRKS_BATCH 32
+  /* IRKs are read from the job list in batches */
+  uint8_t irks[IRKS_BATCH][16];
+  size_t n_irks = 0; /* Number of IRKs in irks[] */
+  size_t irk_i = 0;  /* Next IRK to check in irks[] */
+  int rd_ret = 0;    /* Result of the last IRKs batch read */
 
 #define IF_NOT_READ_ERROR(ret) \
   if (ret < 0) { \
@@ -298,11 +305,11 @@ static void nhw_AAR_resolve_logic(uint inst) {
     return; \
   }
 
-  ret = nhw_EVDMA_start(&in_evdma, (void *)NRF_AAR_regs[inst]->IN.PTR);
+  ret = nhw_EVDMA_start(&in_evdma, nhw_dma_addr_to_ptr(NRF_AAR_regs[inst]->IN.PTR));
   if (ret) {
     bs_trace_error_time_line("AAR IN.PTR is NULL during start, that would have hard faulted\n");
   }
-  ret = nhw_EVDMA_start(&out_evdma, (void *)NRF_AAR_regs[inst]->OUT.PTR);
+  ret = nhw_EVDMA_start(&out_evdma, nhw_dma_addr_to_ptr(NRF_AAR_regs[inst]->OUT.PTR));
   if (ret) {
     bs_trace_error_time_line("AAR OUT.PTR is NULL, that would have hard faulted\n");
   }
@@ -333,16 +340,23 @@ static void nhw_AAR_resolve_logic(uint inst) {
   prand_buf[13] = (prand >> 16) & 0xFF;
 
   while ((n_resolved < NRF_AAR_regs[inst]->MAXRESOLVED) && (n_iter <= MAX_IRKS)) {
-    ret = nhw_EVDMA_access(&in_evdma, NHW_EVDMA_READ,
-                           irk, 16,
-                           &n_access, (n_iter == 0)?NHW_EVDMA_NEWJOB:NHW_EVDMA_CONTINUEJOB);
-    if (ret == -2) { //End of job list => End of IRK list
-      break;
+    if (irk_i >= n_irks) {
+      /* We run out of read IRKs, if the last batch read stopped short,
+       * this is where we would have hit that condition reading one by one */
+      if (rd_ret == -2) { //End of job list => End of IRK list
+        break;
+      }
+      else IF_NOT_READ_ERROR(rd_ret);
+
+      rd_ret = nhw_EVDMA_access_records(&in_evdma, NHW_EVDMA_READ,
+                                     (uint8_t *)irks, 16, BS_MIN(IRKS_BATCH, MAX_IRKS + 1 - n_iter),
+                                     &n_irks, (n_iter == 0)?NHW_EVDMA_NEWJOB:NHW_EVDMA_CONTINUEJOB);
+      irk_i = 0;
+      continue;
     }
-    else IF_NOT_READ_ERROR(ret);
 
     /* this aes_128 function takes and produces big endian results */
-    BLECrypt_if_aes_128((const uint8_t *)&irk, prand_buf, hash_check_buf);
+    BLECrypt_if_aes_128(irks[irk_i++], prand_buf, hash_check_buf);
 
     /* Endianess reversal to little endian */
     hash_check = hash_check_buf[15] | (uint32_t)hash_check_buf[14] << 8 | (uint32_t)hash_check_buf[13] << 16;
@@ -367,13 +381,14 @@ static void nhw_AAR_resolve_logic(uint inst) {
     n_iter++;
   }
 #undef IF_NOT_READ_ERROR
+#undef IRKS_BATCH
 
   //Very rough approximation of duration ceil( (20 + (8 + 20)*n_iter + 11*N_matches cc)/Clock_in_MHz ) micros
   uint clockMHz = nhw_aar_st[inst].clockMHz;
   bs_time_t t_duration = (20 + (8 + 20)*n_iter + 11*n_resolved + clockMHz - 1)/clockMHz;
 
   nhw_aar_st[inst].Timer = nsi_hws_get_time() + t_duration;
-  update_master_timer();
+  nhw_AARCCMECB_update_master_timer();
 }
 
 static void nhw_AAR_TASK_START_inner(uint inst) {
@@ -499,11 +514,11 @@ static void nhw_CCM_logic(uint inst) {
     return; \
   }
 
-  ret = nhw_EVDMA_start(&in_evdma, (void *)NRF_CCM_regs[inst]->IN.PTR);
+  ret = nhw_EVDMA_start(&in_evdma, nhw_dma_addr_to_ptr(NRF_CCM_regs[inst]->IN.PTR));
   if (ret) {
     bs_trace_error_time_line("CCM IN.PTR is NULL during start, that would have hard faulted\n");
   }
-  ret = nhw_EVDMA_start(&out_evdma, (void *)NRF_CCM_regs[inst]->OUT.PTR);
+  ret = nhw_EVDMA_start(&out_evdma, nhw_dma_addr_to_ptr(NRF_CCM_regs[inst]->OUT.PTR));
   if (ret) {
     bs_trace_error_time_line("CCM OUT.PTR is NULL during start, that would have hard faulted\n");
   }
@@ -729,7 +744,7 @@ static void nhw_ECB_stop(uint inst) {
   struct ecb_status *st = &nhw_ecb_st[inst];
   st->Running = false;
   st->Timer = TIME_NEVER;
-  update_master_timer();
+  nhw_AARCCMECB_update_master_timer();
 }
 
 static bool nhw_ECB_possible_abort(uint inst) {
@@ -754,7 +769,7 @@ static void nhw_ECB_logic(uint inst) {
 
   memset(input, 0, sizeof(input));
 
-  ret = nhw_EVDMA_start(&in_evdma, (void *)NRF_ECB_regs[inst].IN.PTR);
+  ret = nhw_EVDMA_start(&in_evdma, nhw_dma_addr_to_ptr(NRF_ECB_regs[inst].IN.PTR));
   if (ret) {
     bs_trace_error_time_line("ECB IN.PTR is NULL during start, that would have hard faulted\n");
   }
@@ -772,7 +787,7 @@ static void nhw_ECB_logic(uint inst) {
 
   BLECrypt_if_aes_128(key_be, input, output);
 
-  ret = nhw_EVDMA_start(&out_evdma, (void *)NRF_ECB_regs[inst].OUT.PTR);
+  ret = nhw_EVDMA_start(&out_evdma, nhw_dma_addr_to_ptr(NRF_ECB_regs[inst].OUT.PTR));
   if (ret) {
     bs_trace_error_time_line("ECB OUT.PTR is NULL during start, that would have hard faulted\n");
   }
@@ -788,7 +803,7 @@ static void nhw_ECB_logic(uint inst) {
 
   //Note [ECB1]
   nhw_ecb_st[inst].Timer = nsi_hws_get_time() + nhw_ecb_st[inst].t_ECB;
-  update_master_timer();
+  nhw_AARCCMECB_update_master_timer();
 }
 
 static void nhw_ECB_TASK_START(uint inst) {
@@ -849,4 +864,4 @@ static void nhw_AARCCMECB_timer_triggered(void) {
   nsi_hws_find_next_event();
 }
 
-NSI_HW_EVENT(Timer_AAR_CCM_ECB, nhw_AARCCMECB_timer_triggered, 50);
+NHW_HW_EVENT(Timer_AAR_CCM_ECB, nhw_AARCCMECB_timer_triggered, 50);
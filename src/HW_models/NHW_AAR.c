@@ -38,6 +38,8 @@
 #include "BLECrypt_if.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
+#include "NHW_dma_addr.h"
 
 #if NHW_AAR_TOTAL_INST > 1
 #error "This model only supports 1 instance so far"
@@ -139,7 +141,7 @@ static void nhw_aar_timer_triggered(void) {
   nhw_AAR_signal_EVENTS_END(0);
 }
 
-NSI_HW_EVENT(Timer_AAR, nhw_aar_timer_triggered, 50);
+NHW_HW_EVENT(Timer_AAR, nhw_aar_timer_triggered, 50);
 
 static inline uint32_t read_3_bytes_value(const uint8_t *ptr) {
   uint32_t value = ptr[0] | (ptr[1] << 8) | (ptr[2] << 16);
@@ -165,7 +167,7 @@ static int nhw_aar_resolve(int *good_irk) {
    * The AAR module always assumes the S0+Length+S1 occupy 3 bytes
    * independently of the RADIO config
    */
-  uint8_t *address_ptr = (uint8_t*)NRF_AAR_regs.ADDRPTR + 3;
+  uint8_t *address_ptr = (uint8_t*)nhw_dma_addr_to_ptr(NRF_AAR_regs.ADDRPTR) + 3;
 
   *good_irk = -1;
 
@@ -191,7 +193,7 @@ static int nhw_aar_resolve(int *good_irk) {
 
   for (i = 0 ; i < NRF_AAR_regs.NIRK; i++){
     /* The provided IRKs are assumed to be already big endian */
-    irkptr = ((const uint8_t*)NRF_AAR_regs.IRKPTR) + 16*i;
+    irkptr = ((const uint8_t*)nhw_dma_addr_to_ptr(NRF_AAR_regs.IRKPTR)) + 16*i;
 
     /* this aes_128 function takes and produces big endian results */
     BLECrypt_if_aes_128(
@@ -46,6 +46,7 @@
 #include "bs_tracing.h"
 #include "BLECrypt_if.h"
 #include "nsi_tasks.h"
+#include "NHW_dma_addr.h"
 
 NRF_CCM_Type NRF_CCM_regs;
 #if (NHW_HAS_DPPI)
@@ -131,13 +132,13 @@ static void nrf_ccm_encrypt_tx(void) {
   uint8_t ccm_nonce[NONCE_LEN];
   uint8_t aad;
 
-  cnfptr = (const uint8_t*)NRF_CCM_regs.CNFPTR;
+  cnfptr = (const uint8_t*)nhw_dma_addr_to_ptr(NRF_CCM_regs.CNFPTR);
   sk = cnfptr;
   tx_pkt_ctr = *(uint64_t*)(cnfptr + 16) & 0x7FFFFFFFFFULL;
   iv = &cnfptr[25];
 
-  inptr = (const uint8_t*)NRF_CCM_regs.INPTR;
-  outptr =  (uint8_t*)NRF_CCM_regs.OUTPTR;
+  inptr = (const uint8_t*)nhw_dma_addr_to_ptr(NRF_CCM_regs.INPTR);
+  outptr =  (uint8_t*)nhw_dma_addr_to_ptr(NRF_CCM_regs.OUTPTR);
 
   length = inptr[1];
   if (length > 0) {
@@ -183,14 +184,14 @@ static void nrf_ccm_decrypt_rx(bool crc_error) {
     return;
   }
 
-  cnfptr = (const uint8_t*)NRF_CCM_regs.CNFPTR;
+  cnfptr = (const uint8_t*)nhw_dma_addr_to_ptr(NRF_CCM_regs.CNFPTR);
   sk = cnfptr;
   memcpy(&rx_pkt_ctr, cnfptr + 16, 5);
   rx_pkt_ctr &= 0x7FFFFFFFFFULL;
   iv = &cnfptr[25];
 
-  inptr = (const uint8_t*)NRF_CCM_regs.INPTR;
-  outptr = (uint8_t*)NRF_CCM_regs.OUTPTR;
+  inptr = (const uint8_t*)nhw_dma_addr_to_ptr(NRF_CCM_regs.INPTR);
+  outptr = (uint8_t*)nhw_dma_addr_to_ptr(NRF_CCM_regs.OUTPTR);
 
   length = inptr[1];
   if (length > 4) {
@@ -26,6 +26,8 @@
 #include "BLECrypt_if.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
+#include "NHW_dma_addr.h"
 
 #if NHW_ECB_TOTAL_INST > 1
 #error "This model only supports 1 instance so far"
@@ -136,7 +138,7 @@ static void nhw_ecb_timer_triggered(void) {
   Timer_ECB = TIME_NEVER;
   nsi_hws_find_next_event();
 
-  ecbdata_t *ecbptr = (ecbdata_t *)NRF_ECB_regs.ECBDATAPTR;
+  ecbdata_t *ecbptr = (ecbdata_t *)nhw_dma_addr_to_ptr(NRF_ECB_regs.ECBDATAPTR);
 
   if (!ecbptr) {
     bs_trace_error_time_line("NRF_ECB_regs.ECBDATAPT is NULL\n");
@@ -150,4 +152,4 @@ static void nhw_ecb_timer_triggered(void) {
   }
 }
 
-NSI_HW_EVENT(Timer_ECB, nhw_ecb_timer_triggered, 50);
+NHW_HW_EVENT(Timer_ECB, nhw_ecb_timer_triggered, 50);
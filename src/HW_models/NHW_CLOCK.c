@@ -66,6 +66,7 @@
 #include "bs_utils.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 enum clock_states {Stopped = 0, Starting, Started, Stopping};
 
@@ -538,7 +539,7 @@ static void nhw_pwrclk_timer_triggered(void) {
   } /* LCOV_EXCL_STOP */
 }
 
-NSI_HW_EVENT(Timer_PWRCLK, nhw_pwrclk_timer_triggered, 50);
+NHW_HW_EVENT(Timer_PWRCLK, nhw_pwrclk_timer_triggered, 50);
 
 void nhw_clock_cheat_set_start_time(uint inst, int clock, int source, bs_time_t time) {
   for (int c = 0; c < NHW_CLKPWR_N_CLKS; c++) {
@@ -568,11 +569,11 @@ void nhw_clock_cheat_set_calibrate_time(uint inst, bs_time_t time) {
   {                                                                                 \
      struct clkpwr_status *this = &nhw_clkpwr_st[inst];                             \
                                                                                     \
-     nhw_dppi_common_subscribe_sideeffect(this->dppi_map,                           \
-                                          this->CLOCK_regs->SUBSCRIBE_##TASK_N,     \
-                                          &this->subscribed_##TASK_N,               \
-                                          nhw_clock_task##TASK_N##_wrap,            \
-                                          (void*) inst);                            \
+     nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,                       \
+                                              &this->CLOCK_regs->SUBSCRIBE_##TASK_N,    \
+                                              &this->subscribed_##TASK_N,           \
+                                              nhw_clock_task##TASK_N##_wrap,        \
+                                              (void*) inst);                        \
   }
 
 NRF_CLOCK_REGW_SIDEFFECTS_SUBSCRIBE(HFCLKSTART)
@@ -70,6 +70,13 @@ extern bs_time_t Timer_CRACEN_CM_AES;
 
 static NRF_CRACENCORE_CRYPTMSTRDMA_Type volatile *CMDMA_regs;
 
+/* The DMA address registers are split in LSB and MSB, so 64 bit hosts pointers fit in them */
+#if UINTPTR_MAX > UINT32_MAX
+#define CM_ADDR(lsb, msb) ((uintptr_t)(lsb) | ((uintptr_t)(msb) << 32))
+#else
+#define CM_ADDR(lsb, msb) ((uintptr_t)(lsb))
+#endif
+
 struct CM_descr {
   char *Address;
   union {
@@ -257,14 +264,14 @@ static void nhw_CRACEN_CM_load_pusher_descr(struct CM_descr *descr) {
   nhw_CRACEN_CM_load_descr(&CM_pusher_st, descr);
 
   CMDMA_regs->PUSHADDRLSB = (uintptr_t)descr;
-  CMDMA_regs->PUSHADDRMSB = (uintptr_t)descr;
+  CMDMA_regs->PUSHADDRMSB = (uint64_t)(uintptr_t)descr >> 32;
 }
 
 static void nhw_CRACEN_CM_load_fetcher_descr(struct CM_descr *descr) {
   nhw_CRACEN_CM_load_descr(&CM_fetcher_st, descr);
 
   CMDMA_regs->FETCHADDRLSB = (uintptr_t)descr;
-  CMDMA_regs->FETCHADDRMSB = (uintptr_t)descr;
+  CMDMA_regs->FETCHADDRMSB = (uint64_t)(uintptr_t)descr >> 32;
 }
 
 static void nhw_CRACEN_CM_start(int start) {
@@ -273,13 +280,13 @@ static void nhw_CRACEN_CM_start(int start) {
     if ((CMDMA_regs->CONFIG & CRACENCORE_CRYPTMSTRDMA_CONFIG_PUSHCTRLINDIRECT_Msk) == 0) { //Direct mode
       CM_pusher_st.Discard = (CMDMA_regs->PUSHLEN >> CRACENCORE_CRYPTMSTRDMA_PUSHLEN_PUSHDISCARD_Pos) & 0x1;
       CM_pusher_st.current_len = CMDMA_regs->PUSHLEN & CRACENCORE_CRYPTMSTRDMA_PUSHLEN_PUSHLEN_Msk;
-      CM_pusher_st.current_address = (char *)CMDMA_regs->PUSHADDRLSB;
+      CM_pusher_st.current_address = (char *)CM_ADDR(CMDMA_regs->PUSHADDRLSB, CMDMA_regs->PUSHADDRMSB);
       CM_pusher_st.Stop = true;
       CM_pusher_st.IntEn = false;
       CM_pusher_st.next = NULL;
       memset(&CM_pusher_st.tag, 0 , sizeof(CM_pusher_st.tag));
     } else { //Scatter mode
-      nhw_CRACEN_CM_load_pusher_descr((struct CM_descr *)CMDMA_regs->PUSHADDRLSB);
+      nhw_CRACEN_CM_load_pusher_descr((struct CM_descr *)CM_ADDR(CMDMA_regs->PUSHADDRLSB, CMDMA_regs->PUSHADDRMSB));
     }
     CMDMA_regs->STATUS |= CRACENCORE_CRYPTMSTRDMA_STATUS_PUSHBUSY_Msk
                         | CRACENCORE_CRYPTMSTRDMA_STATUS_PUSHWAITINGFIFO_Msk;
@@ -290,13 +297,13 @@ static void nhw_CRACEN_CM_start(int start) {
     if ((CMDMA_regs->CONFIG & CRACENCORE_CRYPTMSTRDMA_CONFIG_FETCHCTRLINDIRECT_Msk) == 0) { //Direct mode
       CM_fetcher_st.Discard = (CMDMA_regs->FETCHLEN >> CRACENCORE_CRYPTMSTRDMA_PUSHLEN_PUSHDISCARD_Pos) & 0x1;
       CM_fetcher_st.current_len = CMDMA_regs->FETCHLEN & CRACENCORE_CRYPTMSTRDMA_FETCHLEN_FETCHLEN_Msk;
-      CM_fetcher_st.current_address = (char *)CMDMA_regs->FETCHADDRLSB;
+      CM_fetcher_st.current_address = (char *)CM_ADDR(CMDMA_regs->FETCHADDRLSB, CMDMA_regs->FETCHADDRMSB);
       CM_fetcher_st.Stop = true;
       CM_fetcher_st.IntEn = false;
       CM_fetcher_st.next = NULL;
       memcpy(&CM_fetcher_st.tag, (char *)&CMDMA_regs->FETCHTAG , sizeof(uint32_t));
     } else {
-      nhw_CRACEN_CM_load_fetcher_descr((struct CM_descr *)CMDMA_regs->FETCHADDRLSB);
+      nhw_CRACEN_CM_load_fetcher_descr((struct CM_descr *)CM_ADDR(CMDMA_regs->FETCHADDRLSB, CMDMA_regs->FETCHADDRMSB));
     }
     CMDMA_regs->STATUS |= CRACENCORE_CRYPTMSTRDMA_STATUS_FETCHBUSY_Msk;
     nhw_CRACEN_CM_fetcher_feed();
@@ -31,6 +31,7 @@
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
 #include "bs_utils.h"
+#include "NHW_hws_profiler.h"
 
 NRF_CRACEN_Type NRF_CRACEN_regs;
 NRF_CRACENCORE_Type NRF_CRACENCORE_regs;
@@ -147,4 +148,4 @@ static void nhw_CRACEN_timer_triggered(void) {
 #endif
 }
 
-NSI_HW_EVENT(Timer_CRACEN, nhw_CRACEN_timer_triggered, 50);
+NHW_HW_EVENT(Timer_CRACEN, nhw_CRACEN_timer_triggered, 50);
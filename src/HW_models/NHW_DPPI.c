@@ -24,10 +24,11 @@
  *    * Both secure and non-secure bus accesses can read & modify all configuration
  *      registers (and therefore affect all channels and channel groups)
  *
- *  * At this point, if multiple events are sent to the same DPPI at the same "time"
- *    (same delta cycle) they are not merged. (Changing this behavior is possible:
- *    Future impl note: A list of pended callbacks could be created,
- *    and one delta cycle later it could be gone thru)
+ *  * By default, if multiple events are sent to the same DPPI channel at the same "time"
+ *    (same delta cycle) they are not merged, and each is delivered right away
+ *    (the subscribers' callbacks are called synchronously, and recursively for cascades).
+ *    Optionally (-dppi_queued command line option), events can be queued instead:
+ *    See "Queued delivery mode" below.
  *
  * Implementation spec:
  *   This file provides the implementation of the DPPI peripherals,
@@ -51,20 +52,49 @@
  *   When a peripheral publishes an event to a channel, the DPPI will go thru
  *   all currently subscribed peripherals and call their respective callbacks
  *   (the respective task handlers)
+ *
+ * Queued delivery mode:
+ *   Events signaled while another event is being delivered (a cascade, like
+ *   TIMER->DPPI->RADIO->DPPI->CCM..) are appended to a per DPPI instance queue instead of
+ *   being delivered recursively. The queues of all instances are drained iteratively by the
+ *   outermost nhw_dppi_event_signal() call, so the C stack does not grow with the cascade depth.
+ *   An event to a channel which is already queued, is merged with it, as the HW would see
+ *   both at the same time. (Events to a channel which was already delivered earlier in the
+ *   cascade are queued again, as they are caused by it).
+ *   Note that subscribers are called breadth first in this mode, instead of depth first.
+ *   PPIB bridges publish thru the DPPI, so events crossing them are queued just the same.
+ *   With this mode, at exit, how many deliveries were saved by merging events is printed.
+ *
+ * Activity statistics:
+ *   With the -dppi_stats_csv=<path> and/or -dppi_stats_json=<path> command line options,
+ *   the events signaled to each channel and the calls to each subscriber are counted,
+ *   and written at exit into those files. This is meant to find event storms (like a TIMER
+ *   COMPARE event routed at a high rate) which slow the simulation down.
+ *   Subscribers are identified by the peripheral name and offset, and the real HW address
+ *   of their SUBSCRIBE register (or if subscribed without one, by their callback and
+ *   parameter), and the DPPIs by their name and real HW address. The count of a
+ *   subscription which is removed is kept, and added to that of a later identical
+ *   subscription.
  */
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <inttypes.h>
 #include "bs_types.h"
 #include "bs_tracing.h"
 #include "bs_oswrap.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
 #include "NHW_common_types.h"
 #include "NHW_config.h"
 #include "NHW_DPPI.h"
 #include "NHW_peri_types.h"
+#include "NHW_misc.h"
 
 #define DPPI_ALLOC_CHUNK_SIZE 4
 #define SUBSCRIBE_EN_MASK (0x1UL << 31)
@@ -73,6 +103,8 @@
 struct dppi_registry_el {
   dppi_callback_t callback;
   void *param;
+  const volatile uint32_t *sub_reg; /* SUBSCRIBE register of this subscription (if known) */
+  uint64_t calls; /* Only counted with the activity statistics enabled */
 };
 
 typedef void (*dppi_callback_noparam_t)(void);
@@ -95,11 +127,44 @@ struct dppi_status {
 
   uint32_t *shadow_CHG; /*[n_chg] Shadowed/internal version of the CHG register to allow
                                   ignoring/reverting disabled writes to CHG */
+
+  /* Queued delivery mode: */
+  uint8_t *queue;     //[n_ch] Ring of channels pending delivery
+  uint q_head;        // Next entry to be delivered
+  uint q_used;        // Number of queued entries
+  uint32_t q_pending; // Mask of the channels currently queued
+
+  uint64_t *ch_signals; //[n_ch] Activity statistics: Events signaled to each channel
 };
 
 static struct dppi_status nhw_dppi_st[NHW_DPPI_TOTAL_INST];
 NRF_DPPIC_Type NRF_DPPIC_regs[NHW_DPPI_TOTAL_INST];
 
+static bool dppi_queued;
+static bool dppi_draining; /* The queues are being drained (an event is being delivered) */
+
+static struct {
+  uint64_t signaled;  /* Events signaled to enabled channels */
+  uint64_t merged;    /* Events merged with an already queued one in the same channel */
+  uint64_t delivered; /* Times the subscribers of a channel were called */
+  uint max_depth;     /* Maximum number of entries queued at the same time (all instances) */
+} dppi_q_stats;
+
+static char *dppi_stats_csv_path;
+static char *dppi_stats_json_path;
+static bool dppi_stats; /* Activity statistics enabled */
+
+/* Activity statistics of the subscriptions which have been removed */
+static struct dppi_retired_sub {
+  uint dppi_inst;
+  uint ch_n;
+  dppi_callback_t callback;
+  void *param;
+  const volatile uint32_t *sub_reg;
+  uint64_t calls;
+} *dppi_retired;
+static uint dppi_retired_used, dppi_retired_size;
+
 /*
  * Initialize all DPPI instances for this SOC
  */
@@ -135,6 +200,18 @@ static void nhw_dppi_init(void) {
     el->CHG_DIS_subscribed = (struct nhw_subsc_mem*)bs_calloc(n_chg, sizeof(struct nhw_subsc_mem));
 
     el->shadow_CHG = (uint32_t*)bs_calloc(n_chg, sizeof(uint32_t));
+
+    if (dppi_queued) {
+      if (n_ch > 32) { /* LCOV_EXCL_START */
+        bs_trace_error_line("%s: DPPI%i has more than 32 channels, which the queued delivery "
+                            "mode does not support\n", __func__, i);
+      } /* LCOV_EXCL_STOP */
+      el->queue = (uint8_t*)bs_calloc(n_ch, sizeof(uint8_t));
+    }
+
+    if (dppi_stats) {
+      el->ch_signals = (uint64_t*)bs_calloc(n_ch, sizeof(uint64_t));
+    }
   }
 }
 
@@ -170,11 +247,268 @@ static void nhw_dppi_free(void)
 
     free(nhw_dppi_st[i].shadow_CHG);
     nhw_dppi_st[i].shadow_CHG = NULL;
+
+    free(nhw_dppi_st[i].queue);
+    nhw_dppi_st[i].queue = NULL;
+
+    free(nhw_dppi_st[i].ch_signals);
+    nhw_dppi_st[i].ch_signals = NULL;
   }
+  free(dppi_retired);
+  dppi_retired = NULL;
 }
 
 NSI_TASK(nhw_dppi_free, ON_EXIT_PRE, 100);
 
+/*
+ * Activity statistics: Keep the calls count of a subscription which is being removed
+ */
+static void nhw_dppi_stats_retire(uint dppi_inst, uint ch_n, struct dppi_registry_el *reg_el)
+{
+  struct dppi_retired_sub *r;
+
+  if (reg_el->calls == 0) {
+    return;
+  }
+  for (uint i = 0; i < dppi_retired_used; i++) {
+    r = &dppi_retired[i];
+    if ((r->dppi_inst == dppi_inst) && (r->ch_n == ch_n)
+        && (r->callback == reg_el->callback) && (r->param == reg_el->param)) {
+      r->calls += reg_el->calls;
+      reg_el->calls = 0;
+      return;
+    }
+  }
+  if (dppi_retired_used >= dppi_retired_size) {
+    dppi_retired_size += 16;
+    dppi_retired = bs_realloc(dppi_retired, dppi_retired_size * sizeof(struct dppi_retired_sub));
+  }
+  r = &dppi_retired[dppi_retired_used++];
+  r->dppi_inst = dppi_inst;
+  r->ch_n = ch_n;
+  r->callback = reg_el->callback;
+  r->param = reg_el->param;
+  r->sub_reg = reg_el->sub_reg;
+  r->calls = reg_el->calls;
+  reg_el->calls = 0;
+}
+
+static int nhw_dppi_stats_cmp(const void *a, const void *b)
+{
+  const struct dppi_retired_sub *ra = (const struct dppi_retired_sub *)a;
+  const struct dppi_retired_sub *rb = (const struct dppi_retired_sub *)b;
+
+  if (ra->dppi_inst != rb->dppi_inst) {
+    return ra->dppi_inst < rb->dppi_inst ? -1 : 1;
+  }
+  if (ra->ch_n != rb->ch_n) {
+    return ra->ch_n < rb->ch_n ? -1 : 1;
+  }
+  if (ra->calls != rb->calls) {
+    return ra->calls < rb->calls ? 1 : -1;
+  }
+  return 0;
+}
+
+/*
+ * Print into <name> how a subscriber is identified in the activity statistics:
+ * The peripheral name and offset of its SUBSCRIBE register (like "TIMER00_S+0x080"),
+ * and into <addr> that register real HW address,
+ * or if that is not known, its callback and parameter into <name>, and an empty <addr>
+ */
+static void nhw_dppi_stats_subscriber_str(const struct dppi_retired_sub *r,
+                                          char *name, char *addr, size_t size)
+{
+  const char *per_name = NULL;
+  uint32_t offset;
+
+  if (r->sub_reg != NULL) {
+    per_name = nhw_try_per_addr_sim_to_name((const void *)r->sub_reg, &offset);
+  }
+  if (per_name != NULL) {
+    snprintf(name, size, "%s+0x%03"PRIX32, per_name, offset);
+    snprintf(addr, size, "0x%08"PRIXPTR,
+             (uintptr_t)nhw_try_convert_per_addr_sim_to_hw((const void *)r->sub_reg));
+  } else {
+    snprintf(name, size, "%p(%p)", (void *)r->callback, r->param);
+    addr[0] = 0;
+  }
+}
+
+/*
+ * Name of a DPPI instance in the activity statistics
+ */
+static const char *nhw_dppi_stats_name(uint dppi_inst)
+{
+  uint32_t offset;
+  const char *name = nhw_try_per_addr_sim_to_name(&NRF_DPPIC_regs[dppi_inst], &offset);
+
+  return name != NULL ? name : "";
+}
+
+static FILE *nhw_dppi_stats_open(const char *path)
+{
+  FILE *f = fopen(path, "w");
+
+  if (f == NULL) {
+    bs_trace_warning_line("Could not open %s to write the DPPI activity statistics (%i, %s)\n",
+                          path, errno, strerror(errno));
+  }
+  return f;
+}
+
+static void nhw_dppi_stats_write_csv(void)
+{
+  FILE *f = nhw_dppi_stats_open(dppi_stats_csv_path);
+  uint r = 0;
+
+  if (f == NULL) {
+    return;
+  }
+  fprintf(f, "dppi,name,address,channel,kind,subscriber,subscriber_address,count\n");
+  for (uint i = 0; i < NHW_DPPI_TOTAL_INST; i++) {
+    uintptr_t addr = (uintptr_t)nhw_try_convert_per_addr_sim_to_hw(&NRF_DPPIC_regs[i]);
+    const char *name = nhw_dppi_stats_name(i);
+
+    for (uint ch_n = 0; ch_n < nhw_dppi_st[i].n_ch; ch_n++) {
+      if (nhw_dppi_st[i].ch_signals[ch_n] != 0) {
+        fprintf(f, "%u,%s,0x%08"PRIXPTR",%u,signals,,,%"PRIu64"\n",
+                i, name, addr, ch_n, nhw_dppi_st[i].ch_signals[ch_n]);
+      }
+      for (; (r < dppi_retired_used) && (dppi_retired[r].dppi_inst == i)
+             && (dppi_retired[r].ch_n == ch_n); r++) {
+        char sub_name[48], sub_addr[48];
+
+        nhw_dppi_stats_subscriber_str(&dppi_retired[r], sub_name, sub_addr, sizeof(sub_name));
+        fprintf(f, "%u,%s,0x%08"PRIXPTR",%u,calls,%s,%s,%"PRIu64"\n",
+                i, name, addr, ch_n, sub_name, sub_addr, dppi_retired[r].calls);
+      }
+    }
+  }
+  fclose(f);
+}
+
+static void nhw_dppi_stats_write_json(void)
+{
+  FILE *f = nhw_dppi_stats_open(dppi_stats_json_path);
+  uint r = 0;
+
+  if (f == NULL) {
+    return;
+  }
+  fprintf(f, "{\n  \"dppi\": [");
+  for (uint i = 0; i < NHW_DPPI_TOTAL_INST; i++) {
+    uintptr_t addr = (uintptr_t)nhw_try_convert_per_addr_sim_to_hw(&NRF_DPPIC_regs[i]);
+    bool first_ch = true;
+
+    fprintf(f, "%s\n    {\"inst\": %u, \"name\": \"%s\", \"address\": \"0x%08"PRIXPTR"\", "
+            "\"channels\": [", i ? "," : "", i, nhw_dppi_stats_name(i), addr);
+    for (uint ch_n = 0; ch_n < nhw_dppi_st[i].n_ch; ch_n++) {
+      uint first = r;
+
+      while ((r < dppi_retired_used) && (dppi_retired[r].dppi_inst == i)
+             && (dppi_retired[r].ch_n == ch_n)) {
+        r++;
+      }
+      if ((nhw_dppi_st[i].ch_signals[ch_n] == 0) && (r == first)) {
+        continue;
+      }
+      fprintf(f, "%s\n      {\"channel\": %u, \"signals\": %"PRIu64", \"subscribers\": [",
+              first_ch ? "" : ",", ch_n, nhw_dppi_st[i].ch_signals[ch_n]);
+      first_ch = false;
+      for (uint j = first; j < r; j++) {
+        char sub_name[48], sub_addr[48];
+
+        nhw_dppi_stats_subscriber_str(&dppi_retired[j], sub_name, sub_addr, sizeof(sub_name));
+        fprintf(f, "%s\n        {\"subscriber\": \"%s\", \"address\": \"%s\", "
+                "\"calls\": %"PRIu64"}",
+                j != first ? "," : "", sub_name, sub_addr, dppi_retired[j].calls);
+      }
+      fprintf(f, "]}");
+    }
+    fprintf(f, "\n    ]}");
+  }
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+}
+
+static void nhw_dppi_write_stats(void)
+{
+  if (!dppi_stats) {
+    return;
+  }
+
+  /* Gather all subscriptions counts in the retired list, sorted by instance and channel */
+  for (uint i = 0; i < NHW_DPPI_TOTAL_INST; i++) {
+    for (uint ch_n = 0; ch_n < nhw_dppi_st[i].n_ch; ch_n++) {
+      for (uint j = 0; j < nhw_dppi_st[i].reg_used[ch_n]; j++) {
+        nhw_dppi_stats_retire(i, ch_n, &nhw_dppi_st[i].registry[ch_n][j]);
+      }
+    }
+  }
+  qsort(dppi_retired, dppi_retired_used, sizeof(struct dppi_retired_sub), nhw_dppi_stats_cmp);
+
+  if (dppi_stats_csv_path) {
+    nhw_dppi_stats_write_csv();
+  }
+  if (dppi_stats_json_path) {
+    nhw_dppi_stats_write_json();
+  }
+}
+
+NSI_TASK(nhw_dppi_write_stats, ON_EXIT_PRE, 11);
+
+static void nhw_dppi_print_q_stats(void)
+{
+  if (!dppi_queued) {
+    return;
+  }
+  bs_trace_raw(2, "DPPI queued delivery: %"PRIu64" events signaled, %"PRIu64" merged "
+               "(deliveries saved), %"PRIu64" delivered, max queue depth %u\n",
+               dppi_q_stats.signaled, dppi_q_stats.merged, dppi_q_stats.delivered,
+               dppi_q_stats.max_depth);
+}
+
+NSI_TASK(nhw_dppi_print_q_stats, ON_EXIT_PRE, 10);
+
+static void nhw_dppi_register_cmdline(void) {
+  static bs_args_struct_t args[] = {
+    { .is_switch = true,
+      .option = "dppi_queued",
+      .type = 'b',
+      .dest = (void *)&dppi_queued,
+      .descript = "Queue the DPPI events signaled while another is being delivered, "
+                  "instead of delivering them recursively (merging events to an already "
+                  "queued channel)"
+    },
+    { .option = "dppi_stats_csv",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&dppi_stats_csv_path,
+      .descript = "Count the events signaled to each DPPI channel and the calls to each "
+                  "subscriber, and write them at exit into this CSV file"
+    },
+    { .option = "dppi_stats_json",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&dppi_stats_json_path,
+      .descript = "Count the events signaled to each DPPI channel and the calls to each "
+                  "subscriber, and write them at exit into this JSON file"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args);
+}
+
+NSI_TASK(nhw_dppi_register_cmdline, PRE_BOOT_1, 100);
+
+static void nhw_dppi_post_cmdline(void) {
+  dppi_stats = (dppi_stats_csv_path != NULL) || (dppi_stats_json_path != NULL);
+}
+
+NSI_TASK(nhw_dppi_post_cmdline, PRE_BOOT_2, 100);
+
 static void nhw_dppi_check_inst_valid(unsigned int dppi_inst,
                                       const char* type)
 {
@@ -237,10 +571,11 @@ static void nhw_dppi_check_chg_valid(unsigned int dppi_inst,
  * Note: The pair {callback, param} is used to identify a registration
  *       Therefore 2 registrations may never use the same pair (it is an error to do so)
  */
-void nhw_dppi_channel_subscribe(unsigned int dppi_inst,
-                                unsigned int ch_n,
-                                dppi_callback_t callback,
-                                void *param)
+static void nhw_dppi_channel_subscribe_reg(unsigned int dppi_inst,
+                                           unsigned int ch_n,
+                                           dppi_callback_t callback,
+                                           void *param,
+                                           const volatile uint32_t *sub_reg)
 {
   nhw_dppi_check_ch_valid(dppi_inst, ch_n, "subscribe to");
 
@@ -264,9 +599,19 @@ void nhw_dppi_channel_subscribe(unsigned int dppi_inst,
   int n = this->reg_used[ch_n];
   this->registry[ch_n][n].callback = callback;
   this->registry[ch_n][n].param = param;
+  this->registry[ch_n][n].sub_reg = sub_reg;
+  this->registry[ch_n][n].calls = 0;
   this->reg_used[ch_n]++;
 }
 
+void nhw_dppi_channel_subscribe(unsigned int dppi_inst,
+                                unsigned int ch_n,
+                                dppi_callback_t callback,
+                                void *param)
+{
+  nhw_dppi_channel_subscribe_reg(dppi_inst, ch_n, callback, param, NULL);
+}
+
 static inline void nhw_dppi_shift_registration(struct dppi_registry_el *ch_reg,
                                                int off,
                                                int n)
@@ -274,9 +619,13 @@ static inline void nhw_dppi_shift_registration(struct dppi_registry_el *ch_reg,
   for (int i = off+1; i < n; i++) {
     ch_reg[i-1].callback = ch_reg[i].callback;
     ch_reg[i-1].param = ch_reg[i].param;
+    ch_reg[i-1].sub_reg = ch_reg[i].sub_reg;
+    ch_reg[i-1].calls = ch_reg[i].calls;
   }
   ch_reg[n-1].callback = NULL;
   ch_reg[n-1].param = NULL;
+  ch_reg[n-1].sub_reg = NULL;
+  ch_reg[n-1].calls = 0;
 }
 
 /*
@@ -302,6 +651,9 @@ void nhw_dppi_channel_unsubscribe(unsigned int dppi_inst,
   for (uint i = 0; i < this->reg_used[ch_n]; i++) {
     if ((ch_reg[i].callback == callback)
         && (ch_reg[i].param == param)) {
+      if (dppi_stats) {
+        nhw_dppi_stats_retire(dppi_inst, ch_n, &ch_reg[i]);
+      }
       nhw_dppi_shift_registration(ch_reg, i, this->reg_used[ch_n]);
       this->reg_used[ch_n]--;
       return;
@@ -313,26 +665,18 @@ void nhw_dppi_channel_unsubscribe(unsigned int dppi_inst,
 }
 
 /*
- * Signal an event to a channel from a peripheral
- * This will cause all peripherals which subscribed to that channel
- * to get their callbacks called.
- *
- * dppi_inst DPPI instance
- * ch_n      The channel in which the event is being published
+ * Call all the callbacks subscribed to a channel
  */
-void nhw_dppi_event_signal(uint dppi_inst, uint ch_n)
+static void nhw_dppi_deliver(uint dppi_inst, uint ch_n)
 {
-  nhw_dppi_check_ch_valid(dppi_inst, ch_n, "send event to");
   struct dppi_status *this = &nhw_dppi_st[dppi_inst];
-
-  if ((this->NRF_DPPIC_regs->CHEN & ((uint32_t)0x1 << ch_n)) == 0) {
-    return;
-  }
-
   struct dppi_registry_el *ch_reg = this->registry[ch_n];
 
   for (uint i = 0; i < this->reg_used[ch_n]; i++) {
     if (ch_reg[i].callback) { /* LCOV_EXCL_BR_LINE */
+      if (dppi_stats) {
+        ch_reg[i].calls++;
+      }
       if (ch_reg[i].param != (void*)DPPI_CB_NO_PARAM) {
         ch_reg[i].callback(ch_reg[i].param);
       } else {
@@ -346,6 +690,92 @@ void nhw_dppi_event_signal(uint dppi_inst, uint ch_n)
   }
 }
 
+/*
+ * Queued delivery mode: Queue an event, unless that channel is already queued
+ */
+static void nhw_dppi_enqueue(uint dppi_inst, uint ch_n)
+{
+  struct dppi_status *this = &nhw_dppi_st[dppi_inst];
+  uint32_t ch_mask = (uint32_t)0x1 << ch_n;
+
+  if (this->q_pending & ch_mask) {
+    dppi_q_stats.merged++;
+    return;
+  }
+  this->q_pending |= ch_mask;
+  this->queue[(this->q_head + this->q_used) % this->n_ch] = ch_n;
+  this->q_used++;
+
+  uint depth = 0;
+  for (int i = 0; i < NHW_DPPI_TOTAL_INST; i++) {
+    depth += nhw_dppi_st[i].q_used;
+  }
+  if (depth > dppi_q_stats.max_depth) {
+    dppi_q_stats.max_depth = depth;
+  }
+}
+
+/*
+ * Queued delivery mode: Deliver all queued events (and those they cause) until all queues are empty
+ */
+static void nhw_dppi_drain(void)
+{
+  bool pending;
+
+  dppi_draining = true;
+  do {
+    pending = false;
+    for (int i = 0; i < NHW_DPPI_TOTAL_INST; i++) {
+      struct dppi_status *this = &nhw_dppi_st[i];
+
+      while (this->q_used > 0) {
+        uint ch_n = this->queue[this->q_head];
+
+        this->q_head = (this->q_head + 1) % this->n_ch;
+        this->q_used--;
+        this->q_pending &= ~((uint32_t)0x1 << ch_n);
+        dppi_q_stats.delivered++;
+        nhw_dppi_deliver(i, ch_n);
+        pending = true;
+      }
+    }
+  } while (pending);
+  dppi_draining = false;
+}
+
+/*
+ * Signal an event to a channel from a peripheral
+ * This will cause all peripherals which subscribed to that channel
+ * to get their callbacks called.
+ *
+ * dppi_inst DPPI instance
+ * ch_n      The channel in which the event is being published
+ */
+void nhw_dppi_event_signal(uint dppi_inst, uint ch_n)
+{
+  nhw_dppi_check_ch_valid(dppi_inst, ch_n, "send event to");
+  struct dppi_status *this = &nhw_dppi_st[dppi_inst];
+
+  if (dppi_stats) {
+    this->ch_signals[ch_n]++;
+  }
+
+  if ((this->NRF_DPPIC_regs->CHEN & ((uint32_t)0x1 << ch_n)) == 0) {
+    return;
+  }
+
+  if (!dppi_queued) {
+    nhw_dppi_deliver(dppi_inst, ch_n);
+    return;
+  }
+
+  dppi_q_stats.signaled++;
+  nhw_dppi_enqueue(dppi_inst, ch_n);
+  if (!dppi_draining) {
+    nhw_dppi_drain();
+  }
+}
+
 static void nhw_dppi_task_chg_en(uint dppi_inst, uint n)
 {
   nhw_dppi_check_chg_valid(dppi_inst, n, "triggered TASK_CHGn_EN in");
@@ -409,11 +839,11 @@ void nhw_dppi_regw_sideeffects_SUBSCRIBE_CHG_EN(unsigned int dppi_inst, uint n)
   struct dppi_status *this = &nhw_dppi_st[dppi_inst];
   NRF_DPPIC_Type *regs = nhw_dppi_st[dppi_inst].NRF_DPPIC_regs;
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       regs->SUBSCRIBE_CHG[n].EN,
-                                       &this->CHG_EN_subscribed[n],
-                                       nhw_dppi_taskwrap_chg_en,
-                                       (void*)((dppi_inst << 16) + n));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &regs->SUBSCRIBE_CHG[n].EN,
+                                           &this->CHG_EN_subscribed[n],
+                                           nhw_dppi_taskwrap_chg_en,
+                                           (void*)((dppi_inst << 16) + n));
 }
 
 void nhw_dppi_regw_sideeffects_SUBSCRIBE_CHG_DIS(unsigned int dppi_inst, uint n)
@@ -423,11 +853,11 @@ void nhw_dppi_regw_sideeffects_SUBSCRIBE_CHG_DIS(unsigned int dppi_inst, uint n)
   struct dppi_status *this = &nhw_dppi_st[dppi_inst];
   NRF_DPPIC_Type *regs = nhw_dppi_st[dppi_inst].NRF_DPPIC_regs;
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       regs->SUBSCRIBE_CHG[n].DIS,
-                                       &this->CHG_DIS_subscribed[n],
-                                       nhw_dppi_taskwrap_chg_dis,
-                                       (void*)((dppi_inst << 16) + n));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &regs->SUBSCRIBE_CHG[n].DIS,
+                                           &this->CHG_DIS_subscribed[n],
+                                           nhw_dppi_taskwrap_chg_dis,
+                                           (void*)((dppi_inst << 16) + n));
 }
 
 /**
@@ -513,25 +943,22 @@ void nhw_dppi_event_signal_if(uint dppi_inst, uint32_t publish_reg) {
 
 /*
  * NOTE: This is not a DPPI function per se, but a common function
- * for all peripherals to handle the side-effects of any write to a SUBSCRIBE register
- *
- * dppi_inst      Which DPPI the peripheral is connected to
- * SUBSCRIBE_reg  Value of the SUBSCRIBE_<EVENT> register written by SW
- * last           Pointer to an static storage in the peripheral, which keeps
- *                the status of the subscription (is/wast it subscribed,
- *                and to which channel)
- *
- * callback & param: Parameters for nhw_dppi_channel_subscribe()
- *
+ * for all peripherals to check if a publish register is enabled
+ * (i.e. if signaling that event would reach the DPPI)
  */
-void nhw_dppi_common_subscribe_sideeffect(unsigned int dppi_inst,
-                                          uint32_t SUBSCRIBE_reg,
+bool nhw_dppi_publish_is_enabled(uint32_t publish_reg) {
+  return (publish_reg & SUBSCRIBE_EN_MASK) != 0;
+}
+
+static void nhw_dppi_subscribe_sideeffect(unsigned int dppi_inst,
+                                          uint32_t sub_val,
+                                          const volatile uint32_t *SUBSCRIBE_reg,
                                           struct nhw_subsc_mem *last,
                                           dppi_callback_t callback,
                                           void *param)
 {
-  bool new_is_subs = SUBSCRIBE_reg & SUBSCRIBE_EN_MASK;
-  unsigned int new_channel = SUBSCRIBE_reg & SUBSCRIBE_CHIDX_MASK;
+  bool new_is_subs = sub_val & SUBSCRIBE_EN_MASK;
+  unsigned int new_channel = sub_val & SUBSCRIBE_CHIDX_MASK;
 
   if ((last->is_subscribed == new_is_subs)
     && (last->subscribed_ch == new_channel)) {
@@ -548,9 +975,48 @@ void nhw_dppi_common_subscribe_sideeffect(unsigned int dppi_inst,
   last->is_subscribed = new_is_subs;
   last->subscribed_ch = new_channel;
   if (new_is_subs) {
-    nhw_dppi_channel_subscribe(dppi_inst,
-                               new_channel,
-                               callback,
-                               param);
+    nhw_dppi_channel_subscribe_reg(dppi_inst,
+                                   new_channel,
+                                   callback,
+                                   param,
+                                   SUBSCRIBE_reg);
   }
 }
+
+/*
+ * NOTE: This is not a DPPI function per se, but a common function
+ * for all peripherals to handle the side-effects of any write to a SUBSCRIBE register
+ *
+ * dppi_inst      Which DPPI the peripheral is connected to
+ * SUBSCRIBE_reg  The value of the SUBSCRIBE_<EVENT> register written by SW
+ * last           Pointer to an static storage in the peripheral, which keeps
+ *                the status of the subscription (is/wast it subscribed,
+ *                and to which channel)
+ *
+ * callback & param: Parameters for nhw_dppi_channel_subscribe()
+ *
+ * Subscriptions done thru this function are identified in the DPPI activity
+ * statistics by their callback and param, prefer nhw_dppi_common_subscribe_sideeffect_reg()
+ */
+void nhw_dppi_common_subscribe_sideeffect(unsigned int dppi_inst,
+                                          uint32_t SUBSCRIBE_reg,
+                                          struct nhw_subsc_mem *last,
+                                          dppi_callback_t callback,
+                                          void *param)
+{
+  nhw_dppi_subscribe_sideeffect(dppi_inst, SUBSCRIBE_reg, NULL, last, callback, param);
+}
+
+/*
+ * Like nhw_dppi_common_subscribe_sideeffect() but taking the address of the
+ * SUBSCRIBE_<EVENT> register instead of its value, so the subscription
+ * can be identified by that register in the DPPI activity statistics
+ */
+void nhw_dppi_common_subscribe_sideeffect_reg(unsigned int dppi_inst,
+                                              const volatile uint32_t *SUBSCRIBE_reg,
+                                              struct nhw_subsc_mem *last,
+                                              dppi_callback_t callback,
+                                              void *param)
+{
+  nhw_dppi_subscribe_sideeffect(dppi_inst, *SUBSCRIBE_reg, SUBSCRIBE_reg, last, callback, param);
+}
@@ -30,12 +30,18 @@ void nhw_dppi_channel_unsubscribe(unsigned int dppi_inst,
                                   void *param);
 void nhw_dppi_event_signal(unsigned int  dppi_inst, unsigned int  channel_nbr);
 void nhw_dppi_event_signal_if(unsigned int  dppi_inst, uint32_t publish_reg);
+bool nhw_dppi_publish_is_enabled(uint32_t publish_reg);
 
 void nhw_dppi_common_subscribe_sideeffect(unsigned int  dppi_inst,
                                           uint32_t SUBSCRIBE_reg,
                                           struct nhw_subsc_mem *last,
                                           dppi_callback_t callback,
                                           void *param);
+void nhw_dppi_common_subscribe_sideeffect_reg(unsigned int  dppi_inst,
+                                              const volatile uint32_t *SUBSCRIBE_reg,
+                                              struct nhw_subsc_mem *last,
+                                              dppi_callback_t callback,
+                                              void *param);
 
 void nhw_dppi_regw_sideeffects_TASK_CHGn_EN(uint dppi_inst, uint n);
 void nhw_dppi_regw_sideeffects_TASK_CHGn_DIS(uint dppi_inst, uint n);
@@ -167,11 +167,11 @@ void nhw_egu_regw_sideeffects_SUBSCRIBE_TRIGGER(uint inst, uint n) {
 
   nhw_egu_check_inst_event(inst, n, "subscribe");
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       this->NRF_EGU_regs->SUBSCRIBE_TRIGGER[n],
-                                       &this->subscribed[n],
-                                       nhw_egu_tasktrigger_wrap,
-                                       (void*)((inst << 16) + n));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &this->NRF_EGU_regs->SUBSCRIBE_TRIGGER[n],
+                                           &this->subscribed[n],
+                                           nhw_egu_tasktrigger_wrap,
+                                           (void*)((inst << 16) + n));
 }
 #endif /* NHW_HAS_DPPI */
 
@@ -22,6 +22,11 @@
 /**
  * Read the next job from the joblist into the EVDMA status structure
  * and move the joblist_ptr to point to the one after.
+ *
+ * Like in the real HW, job entries are only read from memory as they are needed, and a
+ * job with a NULL buffer pointer terminates the list (nothing is read after it).
+ * A job with a zero length is valid, but no data will be transferred from/to it.
+ *
  * returns
  *    true if the joblist ended (no new job)
  *    false otherwise
@@ -88,6 +93,99 @@ int nhw_EVDMA_start(EVDMA_status_t *st, void *joblist_ptr) {
   }
 }
 
+static void nhw_EVDMA_check_mode(EVDMA_status_t *st, bool read_not_write) {
+  if (   ( read_not_write && (st->mode == EVDMA_write))
+      || (!read_not_write && (st->mode == EVDMA_read)) ) {
+    bs_trace_error_time_line("Programming error\n");
+  } else {
+    if (read_not_write) {
+      st->mode = EVDMA_read;
+    } else {
+      st->mode = EVDMA_write;
+    }
+  }
+}
+
+/*
+ * Copy engine behind nhw_EVDMA_access() and nhw_EVDMA_access_records()
+ * See nhw_EVDMA_access_records() for the parameters and return values.
+ * Sets *n_bytes to the number of bytes actually read/written.
+ */
+static int nhw_EVDMA_access_bulk(EVDMA_status_t *st,
+                                 bool read_not_write,
+                                 uint8_t *periph_buf,
+                                 size_t rec_size,
+                                 size_t max_recs,
+                                 size_t *n_bytes,
+                                 bool start_new_job) {
+
+  size_t total = rec_size * max_recs;
+  size_t left = total;
+  bool rec_open = false; /* A record access has started but not yet completed */
+  int ret;
+
+  *n_bytes = 0;
+
+  if (st->joblist_ptr == NULL) {
+    bs_trace_warning_time_line("FW error: Job list pointer is NULL\n");
+    return -3;
+  }
+  nhw_EVDMA_check_mode(st, read_not_write);
+
+  do {
+    if (!rec_open) {
+      if (left == 0) {
+        ret = rec_size;
+        break;
+      }
+      if ((st->job_pend_length == 0) || start_new_job) {
+        start_new_job = false;
+        bool list_end = nhw_EVDMA_read_next_job(st);
+        if (list_end) {
+          ret = -2;
+          break;
+        }
+      }
+      rec_open = true;
+    }
+
+    size_t to_copy = BS_MIN(left, st->job_pend_length);
+
+    if (read_not_write) {
+      memcpy(periph_buf, st->job_buff, to_copy);
+    } else {
+      memcpy(st->job_buff, periph_buf, to_copy);
+    }
+    st->job_pend_length -= to_copy;
+    st->job_buff += to_copy;
+    periph_buf += to_copy;
+    left -= to_copy;
+
+    if ((to_copy > 0) && ((total - left) % rec_size == 0)) {
+      /* We finished exactly at the end of a record */
+      rec_open = false;
+      continue;
+    }
+
+    /* The current record is not yet done, and the job has no more data */
+    uint next_job_attrib;
+    bool list_end = nhw_EVDMA_peek_next_job_attrib(st, &next_job_attrib);
+    if (list_end) {
+      ret = -2;
+      break;
+    } else if (next_job_attrib != st->job_attrib) {
+      ret = -1;
+      break;
+    }
+
+    nhw_EVDMA_read_next_job(st);
+
+  } while (true);
+
+  *n_bytes = total - left;
+  return ret;
+}
+
 /*
  * Do an EVMA read/write of <nbytes>
  *
@@ -115,55 +213,67 @@ int nhw_EVDMA_access(EVDMA_status_t *st,
 
   *n_actual = 0;
 
-  if (st->joblist_ptr == NULL) {
-    bs_trace_warning_time_line("FW error: Job list pointer is NULL\n");
-    return -3;
-  }
-
-  if (   ( read_not_write && (st->mode == EVDMA_write))
-      || (!read_not_write && (st->mode == EVDMA_read)) ) {
-    bs_trace_error_time_line("Programming error\n");
-  } else {
-    if (read_not_write) {
-      st->mode = EVDMA_read;
-    } else {
-      st->mode = EVDMA_write;
+  if (nbytes == 0) {
+    if (st->joblist_ptr == NULL) {
+      bs_trace_warning_time_line("FW error: Job list pointer is NULL\n");
+      return -3;
     }
-  }
-
-  if ((st->job_pend_length == 0) || start_new_job) {
-    bool list_end = nhw_EVDMA_read_next_job(st);
-    if (list_end) {
-      return -2;
+    nhw_EVDMA_check_mode(st, read_not_write);
+    if ((st->job_pend_length == 0) || start_new_job) {
+      bool list_end = nhw_EVDMA_read_next_job(st);
+      if (list_end) {
+        return -2;
+      }
     }
+    return 0;
   }
 
-  do {
-    uint to_read = BS_MIN(nbytes - *n_actual, st->job_pend_length);
+  return nhw_EVDMA_access_bulk(st, read_not_write, periph_buf,
+                               nbytes, 1, n_actual, start_new_job);
+}
 
-    if (read_not_write) {
-      memcpy(periph_buf, st->job_buff, to_read);
-    } else {
-      memcpy(st->job_buff, periph_buf, to_read);
-    }
-    st->job_pend_length -= to_read;
-    st->job_buff += to_read;
-    *n_actual += to_read;
-    periph_buf += to_read;
+/*
+ * Bulk EVDMA read/write of up to <max_recs> records of <rec_size> bytes each.
+ *
+ * It behaves exactly as calling nhw_EVDMA_access() for <rec_size> bytes
+ * up to <max_recs> times (the first time with <start_new_job>, the following
+ * ones continuing the job), and stopping at the first call which did not
+ * fully succeed; but copies as much as possible in one go from/to each job buffer.
+ *
+ *  st             EVDMA internal status (will be updated)
+ *  read_not_write True for read, false for write access.
+ *  periph_buf     Buffer in the peripheral where the data will be written to/read from
+ *                 (with space for <rec_size> * <max_recs> bytes)
+ *  rec_size       Size of each record in bytes (> 0)
+ *  max_recs       Maximum number of records to read/write
+ *  n_recs         Number of complete records actually read/written
+ *  new_job        Skip to the next job even if the current one has pending data
+ *
+ *  returns: (what the last equivalent nhw_EVDMA_access() call would have returned)
+ *    >=0 (rec_size) read/written all <max_recs> records
+ *    -1 partial read/write (the record <n_recs> may have been partially read/written)
+ *    -2 end of job list reached (idem)
+ *    -3 error, joblist_ptr is invalid
+ */
+int nhw_EVDMA_access_records(EVDMA_status_t *st,
+                             bool read_not_write,
+                             uint8_t *periph_buf,
+                             size_t rec_size,
+                             size_t max_recs,
+                             size_t *n_recs,
+                             bool start_new_job) {
+  size_t n_bytes;
+  int ret;
 
-    if (*n_actual == nbytes) {
-      return nbytes;
-    }
+  *n_recs = 0;
 
-    uint next_job_attrib;
-    bool list_end = nhw_EVDMA_peek_next_job_attrib(st, &next_job_attrib);
-    if (list_end) {
-      return -2;
-    } else if (next_job_attrib != st->job_attrib) {
-      return -1;
-    }
+  if (rec_size == 0) {
+    bs_trace_error_time_line("Programming error\n");
+  }
 
-    nhw_EVDMA_read_next_job(st);
+  ret = nhw_EVDMA_access_bulk(st, read_not_write, periph_buf,
+                              rec_size, max_recs, &n_bytes, start_new_job);
+  *n_recs = n_bytes / rec_size;
 
-  } while (true);
+  return ret;
 }
@@ -38,6 +38,13 @@ int nhw_EVDMA_access(EVDMA_status_t *st,
                      size_t nbytes,
                      size_t *n_actual,
                      bool new_job);
+int nhw_EVDMA_access_records(EVDMA_status_t *st,
+                             bool read_not_write,
+                             uint8_t *periph_buf,
+                             size_t rec_size,
+                             size_t max_recs,
+                             size_t *n_recs,
+                             bool start_new_job);
 
 #define NHW_EVDMA_READ  true
 #define NHW_EVDMA_WRITE false
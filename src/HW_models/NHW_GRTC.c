@@ -64,6 +64,7 @@
 #include "NHW_DPPI.h"
 #include "NHW_templates.h"
 #include "irq_ctrl.h"
+#include "NHW_hws_profiler.h"
 
 struct grtc_status {
   NRF_GRTC_Type *NRF_GRTC_regs;
@@ -197,6 +198,8 @@ bs_time_t nhw_GRTC_counter_to_time(uint inst, uint64_t value) {
  * Find the CC register timer (CC_timers[][]) which will trigger earliest (if any)
  */
 static void nhw_GRTC_update_master_timer(void) {
+  bs_time_t old_timer = Timer_GRTC;
+
   Timer_GRTC = TIME_NEVER;
 
   for (uint cc = 0 ; cc < nhw_grtc_st.n_cc ; cc++) {
@@ -204,7 +207,7 @@ static void nhw_GRTC_update_master_timer(void) {
       Timer_GRTC = nhw_grtc_st.CC_timers[cc];
     }
   }
-  nsi_hws_find_next_event();
+  nhw_hws_timer_updated(old_timer, Timer_GRTC);
 }
 
 /**
@@ -390,11 +393,11 @@ void nhw_GRTC_regw_sideeffects_SUBSCRIBE_CAPTURE(uint inst, uint cc_n) {
 
   nhw_GRTC_check_valid_cc_index(inst, cc_n, "SUBSCRIBE_CAPTURE");
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       this->NRF_GRTC_regs->SUBSCRIBE_CAPTURE[cc_n],
-                                       &this->subscribed[cc_n],
-                                       nhw_GRTC_taskcapture_wrap,
-                                       (void*)((inst << 16) + cc_n));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &this->NRF_GRTC_regs->SUBSCRIBE_CAPTURE[cc_n],
+                                           &this->subscribed[cc_n],
+                                           nhw_GRTC_taskcapture_wrap,
+                                           (void*)((inst << 16) + cc_n));
 }
 
 void nhw_GRTC_regw_sideeffects_INTEN(uint inst, uint n) {
@@ -589,7 +592,7 @@ static void nhw_GRTC_timer_triggered(void) {
   nhw_GRTC_update_master_timer();
 }
 
-NSI_HW_EVENT(Timer_GRTC, nhw_GRTC_timer_triggered, 50);
+NHW_HW_EVENT(Timer_GRTC, nhw_GRTC_timer_triggered, 50);
 
 /*
  * Some SW relies on writing a past value to a CC, and having that triger right away
@@ -17,6 +17,16 @@
  * Notes:
  *   * Close enough events in the IPC channels are not merged.
  *     Note the spec does not specify t_IPC.
+ *   * RECEIVE_CNF must be written thru the HAL (nrf_ipc_receive_config_set()),
+ *     writing it directly from SW will not reconfigure the receive events.
+ *
+ * Implementation notes:
+ *   * Which receive events of each instance listen on each IPC channel is precalculated in a
+ *     routing table, which is updated when RECEIVE_CNF is written.
+ *     A receive event listening on several of the channels a send task sends on, is triggered
+ *     once per channel.
+ *   * A bitmask of the currently set EVENTS_RECEIVE is kept, to evaluate the interrupt
+ *     without checking each event register
  */
 
 #include <string.h>
@@ -31,6 +41,8 @@
 #include "irq_ctrl.h"
 #include "NHW_DPPI.h"
 
+#define NHW_IPC_MAX_CH 32 /* Maximum number of IPC channels (bits in SEND_CNF/RECEIVE_CNF) */
+
 struct ipc_status {
   NRF_IPC_Type *NRF_IPC_regs;
   uint n_ch;  /* Number of events configured in this IPC instance */
@@ -38,6 +50,11 @@ struct ipc_status {
   uint dppi_map;   //To which DPPI instance are this IPC subscribe&publish ports connected to
   //Which of the subscription ports are currently connected, and to which channel:
   struct nhw_subsc_mem* subscribed;   //[n_ch]
+
+  uint32_t events_pend; /* Which EVENTS_RECEIVE are currently set */
+  /* Routing table: For each IPC channel, which receive events of this instance
+   * listen on it (as a bitmask) */
+  uint32_t routes[NHW_IPC_MAX_CH];
 };
 
 static uint nhw_IPC_dppi_map[NHW_IPC_TOTAL_INST] = NHW_IPC_DPPI_MAP;
@@ -59,6 +76,8 @@ static void nhw_ipc_init(void) {
 
     nhw_ipc_st[i].dppi_map = nhw_IPC_dppi_map[i];
     nhw_ipc_st[i].subscribed = (struct nhw_subsc_mem*)bs_calloc(nhw_ipc_n_ch[i], sizeof(struct nhw_subsc_mem));
+    nhw_ipc_st[i].events_pend = 0;
+    memset(nhw_ipc_st[i].routes, 0, sizeof(nhw_ipc_st[i].routes));
   }
 }
 
@@ -83,18 +102,9 @@ static void nhw_IPC_eval_interrupt(uint inst) {
   static struct nhw_irq_mapping nhw_ipc_irq_map[NHW_IPC_TOTAL_INST] = NHW_IPC_INT_MAP;
   bool new_int_line = false;
 
-  struct ipc_status *this = &nhw_ipc_st[inst];
   NRF_IPC_Type *IPC_regs = &NRF_IPC_regs[inst];
 
-  uint32_t event_m = 0;
-
-  for (uint i = 0; i < this->n_ch; i++) {
-    if (IPC_regs->EVENTS_RECEIVE[i]) {
-      event_m |= 1<<i;
-    }
-  }
-
-  IPC_regs->INTPEND = IPC_regs->INTEN & event_m;
+  IPC_regs->INTPEND = IPC_regs->INTEN & nhw_ipc_st[inst].events_pend;
 
   new_int_line = (IPC_regs->INTPEND != 0);
 
@@ -109,26 +119,20 @@ static void nhw_IPC_eval_interrupt(uint inst) {
                              inst, what, ch, nhw_ipc_st[inst].n_ch); \
   }
 
-static void nhw_IPC_signal_EVENT(uint inst, uint ch) {
-  NRF_IPC_regs[inst].EVENTS_RECEIVE[ch] = 1;
-  nhw_IPC_eval_interrupt(inst);
-  nhw_dppi_event_signal_if(nhw_IPC_dppi_map[inst], NRF_IPC_regs[inst].PUBLISH_RECEIVE[ch]);
-}
-
 /*
- * Signal an event in channel <ch> in the IPC backbone
- * i.e. Check for all IPC peripherals, if they are receiving
- * in that channel, and if so have them signal the corresponding
- * EVENT RECEIVE
+ * Signal the receive events in <ev_mask> of this IPC instance
  */
-static void nhw_IPC_notify_ipc_ch(uint ch) {
-  for (uint inst = 0; inst < NHW_IPC_TOTAL_INST; inst++) {
-    uint ch_mask = 1 << ch;
-    for (uint i = 0; i < nhw_ipc_st[inst].n_ch; i++) {
-      if (NRF_IPC_regs[inst].RECEIVE_CNF[i] & ch_mask) {
-        nhw_IPC_signal_EVENT(inst, i);
-      }
-    }
+static void nhw_IPC_signal_EVENTS(uint inst, uint32_t ev_mask) {
+  uint32_t mask;
+
+  nhw_ipc_st[inst].events_pend |= ev_mask;
+  for (mask = ev_mask; mask; mask &= mask - 1) {
+    NRF_IPC_regs[inst].EVENTS_RECEIVE[__builtin_ctz(mask)] = 1;
+  }
+  nhw_IPC_eval_interrupt(inst);
+  for (mask = ev_mask; mask; mask &= mask - 1) {
+    nhw_dppi_event_signal_if(nhw_IPC_dppi_map[inst],
+                             NRF_IPC_regs[inst].PUBLISH_RECEIVE[__builtin_ctz(mask)]);
   }
 }
 
@@ -138,7 +142,11 @@ static void nhw_IPC_TASKS_SEND(uint inst, uint ch) {
   uint32_t send_cnf = NRF_IPC_regs[inst].SEND_CNF[ch];
 
   for (int i = __builtin_ffs(send_cnf) - 1; i >= 0; i = __builtin_ffs(send_cnf) - 1) {
-    nhw_IPC_notify_ipc_ch(i);
+    for (uint rx_inst = 0; rx_inst < NHW_IPC_TOTAL_INST; rx_inst++) {
+      if (nhw_ipc_st[rx_inst].routes[i]) {
+        nhw_IPC_signal_EVENTS(rx_inst, nhw_ipc_st[rx_inst].routes[i]);
+      }
+    }
     send_cnf &= ~(1 << i);
   }
 }
@@ -161,15 +169,41 @@ void nhw_IPC_regw_sideeffects_SUBSCRIBE_SEND(uint inst, uint ch) {
 
   CHECK_VALID_CHANNEL(inst, ch, "SUBSCRIBE");
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       this->NRF_IPC_regs->SUBSCRIBE_SEND[ch],
-                                       &this->subscribed[ch],
-                                       nhw_IPC_tasks_send_wrap,
-                                       (void*)((inst << 16) + ch));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &this->NRF_IPC_regs->SUBSCRIBE_SEND[ch],
+                                           &this->subscribed[ch],
+                                           nhw_IPC_tasks_send_wrap,
+                                           (void*)((inst << 16) + ch));
 }
 
 NHW_SIDEEFFECTS_INTEN(IPC, NRF_IPC_regs[inst]., NRF_IPC_regs[inst].INTEN)
 NHW_SIDEEFFECTS_INTSET(IPC, NRF_IPC_regs[inst]., NRF_IPC_regs[inst].INTEN)
 NHW_SIDEEFFECTS_INTCLR(IPC, NRF_IPC_regs[inst]., NRF_IPC_regs[inst].INTEN)
 
-NHW_SIDEEFFECTS_EVENTS(IPC)
+void nhw_IPC_regw_sideeffects_RECEIVE_CNF(uint inst, uint ch) {
+  CHECK_VALID_CHANNEL(inst, ch, "RECEIVE_CNF");
+
+  uint32_t receive_cnf = NRF_IPC_regs[inst].RECEIVE_CNF[ch];
+  uint32_t ev_bit = 1 << ch;
+
+  /* Update in which IPC channels this event listens */
+  for (uint i = 0; i < NHW_IPC_MAX_CH; i++) {
+    if ((receive_cnf >> i) & 1) {
+      nhw_ipc_st[inst].routes[i] |= ev_bit;
+    } else {
+      nhw_ipc_st[inst].routes[i] &= ~ev_bit;
+    }
+  }
+}
+
+void nhw_IPC_regw_sideeffects_EVENTS_all(uint inst) {
+  struct ipc_status *this = &nhw_ipc_st[inst];
+
+  this->events_pend = 0;
+  for (uint i = 0; i < this->n_ch; i++) {
+    if (NRF_IPC_regs[inst].EVENTS_RECEIVE[i]) {
+      this->events_pend |= 1 << i;
+    }
+  }
+  nhw_IPC_eval_interrupt(inst);
+}
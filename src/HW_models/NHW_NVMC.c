@@ -81,6 +81,8 @@
 #include "NHW_peri_types.h"
 #include "NHW_NVMC.h"
 #include "NHW_NVM_backend.h"
+#include "HW_utils.h"
+#include "NHW_hws_profiler.h"
 
 NRF_UICR_Type *NRF_UICR_regs_p[NHW_NVMC_UICR_TOTAL_INST];
 NRF_NVMC_Type *NRF_NVMC_regs_p[NHW_NVMC_UICR_TOTAL_INST];
@@ -211,6 +213,7 @@ static void nhw_nvmc_complete_erase(uint inst) {
   uint base_address = erase_page*this->flash_page_size;
 
   memset(&this->flash_st.storage[base_address], 0xFF, this->flash_page_size);
+  nhw_nvm_mark_dirty(&this->flash_st, base_address, this->flash_page_size);
 
   this->time_under_erase[erase_page] = 0;
   this->page_erased[erase_page] = true;
@@ -232,6 +235,7 @@ static void nhw_nvmc_complete_erase_partial(uint inst){
 static void nhw_nvmc_complete_erase_uicr(uint inst){
   struct hw_nvmc_st_t *this = &hw_nvmc_st[inst];
   (void)memset(this->uicr_st.storage, 0xFF, this->uicr_st.size);
+  nhw_nvm_mark_dirty(&this->uicr_st, 0, this->uicr_st.size);
 }
 
 /*
@@ -241,6 +245,7 @@ static void nhw_nvmc_complete_erase_all(uint inst){
   struct hw_nvmc_st_t *this = &hw_nvmc_st[inst];
   nhw_nvmc_complete_erase_uicr(inst);
   (void)memset(this->flash_st.storage, 0xFF, this->flash_st.size);
+  nhw_nvm_mark_dirty(&this->flash_st, 0, this->flash_st.size);
 
   memset(this->time_under_erase, 0, this->flash_n_pages*sizeof(bs_time_t));
   memset(this->page_erased, true, this->flash_n_pages*sizeof(bool));
@@ -288,7 +293,7 @@ static void nhw_nvmc_timer_triggered(void){
   nhw_nvmc_find_next_event();
 }
 
-NSI_HW_EVENT(Timer_NVMC, nhw_nvmc_timer_triggered, 50);
+NHW_HW_EVENT(Timer_NVMC, nhw_nvmc_timer_triggered, 50);
 
 bs_time_t nhw_nvmc_time_to_ready(uint inst) {
   if (NRF_NVMC_regs[inst].READY) {
@@ -344,7 +349,7 @@ bs_time_t nhw_nvmc_time_to_ready(uint inst) {
 
 #define OUT_OF_FLASH_ERROR(addr) \
    bs_trace_error_time_line("%s: Attempted access outside of flash and UICR areas (0x%X)\n",\
-    __func__, address)
+    __func__, addr)
 
 void nhw_nvmc_erase_page(uint inst, uint32_t address){
   ERASE_ENABLED_CHECK(inst, "ERASEPAGE");
@@ -526,6 +531,7 @@ void nhw_nmvc_write_word(uint32_t address, uint32_t value){
    * set to 1 bits which are 0.
    */
   *(uint32_t*)&backend->storage[offset] &= value;
+  nhw_nvm_mark_dirty(backend, offset, sizeof(uint32_t));
 
   this->flash_op = flash_write;
   NRF_NVMC_regs[inst].READY = 0;
@@ -535,6 +541,82 @@ void nhw_nmvc_write_word(uint32_t address, uint32_t value){
   nhw_nvmc_find_next_event();
 }
 
+/*
+ * Program a buffer into a flash array (flash or uicr) in one go
+ *
+ * Where address is an address in either a "hard" flash address
+ * (meaning in the 0x00..00 range for nrf52, or also in the 0x010..00 range for nrf53)
+ * Or a "soft" address inside an UICR range (meaning an address gotten as an offset from
+ * NRF_UICR_BASE/NRF_UICR_S/NS_BASE)
+ *
+ * This is equivalent to programming the buffer word by word with nhw_nmvc_write_word(),
+ * and waiting for the NVMC to be ready after each word. But it is done in one step,
+ * with the NVMC being busy for the whole (accumulated) programming time.
+ *
+ * Both the address and size must be word aligned, and the whole buffer must fit in the
+ * same flash or UICR area.
+ * Note that erasing pages by writing 0xFFFFFFFF (nrf53) is not supported thru this function,
+ * the NVMC must be in write mode.
+ */
+void nhw_nmvc_write_buffer(uint32_t address, const void *src, size_t size){
+  if (((address & 3) != 0) || ((size & 3) != 0)){
+    bs_trace_error_line_time("%s: write to non word aligned address %u (or size %zu), "
+            "this would have hard-faulted in real HW\n",
+            __func__, address, size);
+  }
+
+  if (size == 0) {
+    return;
+  }
+
+  int offset;
+  nvm_storage_state_t *backend;
+  uint inst;
+
+  nhw_nvmc_address_location(address, &inst, &backend, &offset);
+
+  if (offset + size > backend->size) {
+    /* Report the first address which falls out of the flash/UICR */
+    OUT_OF_FLASH_ERROR(address + (backend->size - offset));
+  }
+
+  struct hw_nvmc_st_t *this = &hw_nvmc_st[inst];
+
+  BUSY_CHECK(inst, "write");
+
+  if ((NRF_NVMC_regs[inst].CONFIG & NVMC_CONFIG_WEN_Msk) != NVMC_CONFIG_WEN_Wen) {
+    bs_trace_warning_line_time("%s: write while write is not enabled in "
+        "CONFIG (%u), it will be ignored\n",
+        __func__, NRF_NVMC_regs[inst].CONFIG);
+    return;
+  }
+
+  if (backend == &this->flash_st) {
+    uint first_page = offset / this->flash_page_size;
+    uint last_page = (offset + size - 1) / this->flash_page_size;
+
+    for (uint page = first_page; page <= last_page; page++) {
+      uint page_offset = page * this->flash_page_size;
+      CHECK_PARTIAL_ERASE(inst, page_offset, "write");
+      this->page_erased[page] = false;
+    }
+  }
+
+  /*
+   * Writing to flash clears to 0 bits which were one, but does not
+   * set to 1 bits which are 0.
+   */
+  hwu_and_into(&backend->storage[offset], (const uint8_t *)src, size);
+  nhw_nvm_mark_dirty(backend, offset, size);
+
+  this->flash_op = flash_write;
+  NRF_NVMC_regs[inst].READY = 0;
+  NRF_NVMC_regs[inst].READYNEXT = 0;
+
+  this->timer = nsi_hws_get_time() + (size / 4) * NHW_NVMC_FLASH_T_WRITE;
+  nhw_nvmc_find_next_event();
+}
+
 /**
  * Read from the flash array (flash or uicr)
  *
@@ -628,7 +710,7 @@ void nhw_nmvc_read_buffer(void *dest, uint32_t address, size_t size) {
   }
 
   if (offset + size > backend->size) {
-    OUT_OF_FLASH_ERROR(address + size);
+    OUT_OF_FLASH_ERROR(address + (backend->size - offset));
   }
 
   (void)memcpy(dest, &backend->storage[offset], size);
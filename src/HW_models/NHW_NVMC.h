@@ -24,6 +24,7 @@ void nhw_nvmc_erase_page(uint inst, uint32_t address);
 void nhw_nvmc_erase_page_partial(uint inst, uint32_t address);
 
 void nhw_nmvc_write_word(uint32_t address, uint32_t value);
+void nhw_nmvc_write_buffer(uint32_t address, const void *src, size_t size);
 uint32_t nhw_nmvc_read_word(uint32_t address);
 uint16_t nhw_nmvc_read_halfword(uint32_t address);
 uint8_t nhw_nmvc_read_byte(uint32_t address);
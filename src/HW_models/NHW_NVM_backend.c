@@ -8,8 +8,36 @@
  * Backend for the Non-Volatile Memory devices
  * which can use files on disk or just host RAM
  * to keep their content.
+ *
+ * For file backed storages, the pages modified thru the NVM controller models
+ * are tracked, so that, depending on the selected flush policy (nvm_flush command
+ * line option), only those are msync'ed to disk:
+ *   * never (default): Writeback is left to the OS.
+ *   * exit: The modified pages are flushed when the program exits
+ *           (unless the file is removed at exit, <storage>_rm).
+ *   * <N>: The modified pages are flushed every N simulated ms, and on exit.
+ *
+ * Note: Writes done directly thru the storage pointer (and not thru the NVM controller
+ * models) are not tracked. They still reach the file, but at the OS discretion.
+ *
+ * Storages can also be set in overlay mode (<storage>_overlay command line option).
+ * In this mode a base image file is mapped copy-on-write (MAP_PRIVATE): its content is
+ * used, but modifications only affect the process' private copy of the modified pages.
+ * Optionally, the pages which differ from the base image can be saved at exit to a
+ * delta file (<storage>_overlay_delta), which will be re-applied on top of the
+ * base image at boot if it exists.
+ * This allows many parallel simulations to share the same (read only) base image.
+ *
+ * For faster startups with large storages, file backed storages are advised to the OS as
+ * soon to be needed (MADV_WILLNEED). And optionally (nvm_prefault) they can be fully
+ * prefaulted at startup (MAP_POPULATE). In RAM storages can optionally be backed by
+ * transparent huge pages (nvm_hugepages).
+ * The time spent initializing each storage is reported (with verbosity level 3 or higher).
  */
 
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE /* For MAP_ANONYMOUS, MAP_POPULATE & madvise() */
+
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -19,9 +47,261 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <inttypes.h>
+#include <time.h>
 #include "bs_tracing.h"
 #include "bs_oswrap.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
+#include "nsi_hw_scheduler.h"
+#include "nsi_tasks.h"
+#include "nsi_hws_models_if.h"
 #include "NHW_NVM_backend.h"
+#include "NHW_hws_profiler.h"
+
+enum nvm_flush_policy_t {NVM_FLUSH_NEVER = 0, NVM_FLUSH_EXIT, NVM_FLUSH_PERIODIC};
+
+static enum nvm_flush_policy_t flush_policy = NVM_FLUSH_NEVER;
+static bs_time_t flush_period = TIME_NEVER;
+static bs_time_t Timer_NVM_flush = TIME_NEVER;
+
+static size_t host_page_size;
+
+static bool prefault;
+static bool hugepages;
+
+/* Extra flags for file mmap()s */
+static inline int nhw_nvm_mmap_flags(void) {
+  return prefault ? MAP_POPULATE : 0;
+}
+
+/* Advise the OS we will soon need the whole mapping */
+static void nhw_nvm_advise_willneed(nvm_storage_state_t *st, void *addr, size_t len) {
+  if ((len > 0) && (madvise(addr, len, MADV_WILLNEED) != 0)) {
+    bs_trace_warning_line("%s: madvise(MADV_WILLNEED) failed for %s storage: %s\n",
+        __func__, st->type_s, strerror(errno));
+  }
+}
+
+/*
+ * Allocate the memory for an in RAM storage
+ * (backed by transparent huge pages if so configured)
+ */
+static void nhw_nvm_allocate_in_ram(nvm_storage_state_t *st) {
+  st->in_ram_mmap = false;
+
+  if (!hugepages) {
+    st->storage = (uint8_t *)bs_malloc(st->size);
+    return;
+  }
+
+  st->storage = mmap(NULL, st->size, PROT_WRITE | PROT_READ,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (st->storage == MAP_FAILED) {
+    bs_trace_error_line("%s: Failed to allocate %s storage: %s\n",
+        __func__, st->type_s, strerror(errno));
+  }
+  st->in_ram_mmap = true;
+#if defined(MADV_HUGEPAGE)
+  if (madvise(st->storage, st->size, MADV_HUGEPAGE) != 0) {
+    bs_trace_warning_line("%s: madvise(MADV_HUGEPAGE) failed for %s storage: %s\n",
+        __func__, st->type_s, strerror(errno));
+  }
+#else
+  bs_trace_warning_line("%s: Huge pages are not supported in this host\n", __func__);
+#endif
+}
+
+#define NVM_MAX_STORAGES 8
+/* File backed storages currently initialized */
+static nvm_storage_state_t *nvm_storages[NVM_MAX_STORAGES];
+
+static void nhw_nvm_register_storage(nvm_storage_state_t *st) {
+  for (int i = 0; i < NVM_MAX_STORAGES; i++) {
+    if (nvm_storages[i] == NULL) {
+      nvm_storages[i] = st;
+      return;
+    }
+  }
+  bs_trace_error_line("%s: Too many NVM storages, increase NVM_MAX_STORAGES\n", __func__);
+}
+
+static void nhw_nvm_unregister_storage(nvm_storage_state_t *st) {
+  for (int i = 0; i < NVM_MAX_STORAGES; i++) {
+    if (nvm_storages[i] == st) {
+      nvm_storages[i] = NULL;
+    }
+  }
+}
+
+static inline size_t nhw_nvm_n_pages(nvm_storage_state_t *st) {
+  return (st->size + host_page_size - 1) / host_page_size;
+}
+
+/*
+ * Overlay mode delta file format:
+ *   A header, followed by <n_chunks> chunks each made of
+ *   a uint32_t offset and MIN(page_size, storage_size - offset) bytes of content
+ */
+struct nvm_delta_header_t {
+  char magic[8];
+  uint32_t storage_size;
+  uint32_t page_size;
+  uint32_t n_chunks;
+};
+
+#define NVM_DELTA_MAGIC "NHWNVMD1"
+
+/**
+ * Apply (if it exists) the overlay delta file on top of the storage
+ */
+static void nhw_nvm_apply_overlay_delta(nvm_storage_state_t *st) {
+  struct nvm_delta_header_t header;
+  FILE *file = fopen(st->delta_path, "rb");
+
+  if (file == NULL) {
+    return; /* Nothing to apply yet */
+  }
+
+  if ((fread(&header, sizeof(header), 1, file) != 1)
+      || (memcmp(header.magic, NVM_DELTA_MAGIC, sizeof(header.magic)) != 0)
+      || (header.storage_size != st->size)
+      || (header.page_size == 0)) {
+    bs_trace_error_line("%s: %s overlay delta file %s is corrupted or does not match this "
+        "device (%u != %zu)\n", __func__, st->type_s, st->delta_path,
+        header.storage_size, st->size);
+  }
+
+  for (uint32_t i = 0; i < header.n_chunks; i++) {
+    uint32_t offset;
+
+    if ((fread(&offset, sizeof(offset), 1, file) != 1) || (offset >= st->size)) {
+      bs_trace_error_line("%s: %s overlay delta file %s is corrupted\n",
+          __func__, st->type_s, st->delta_path);
+    }
+    size_t len = BS_MIN(header.page_size, st->size - offset);
+    if (fread(&st->storage[offset], len, 1, file) != 1) {
+      bs_trace_error_line("%s: %s overlay delta file %s is corrupted\n",
+          __func__, st->type_s, st->delta_path);
+    }
+  }
+
+  fclose(file);
+}
+
+/**
+ * Save in the overlay delta file the pages which differ from the base image
+ */
+static void nhw_nvm_save_overlay_delta(nvm_storage_state_t *st) {
+  struct nvm_delta_header_t header;
+  uint8_t *base_page = (uint8_t *)bs_malloc(host_page_size);
+  FILE *file;
+
+  bs_create_folders_in_path(st->delta_path);
+  file = fopen(st->delta_path, "wb");
+  if (file == NULL) {
+    bs_trace_warning_line("%s: Failed to open %s overlay delta file %s: %s\n",
+        __func__, st->type_s, st->delta_path, strerror(errno));
+    free(base_page);
+    return;
+  }
+
+  memcpy(header.magic, NVM_DELTA_MAGIC, sizeof(header.magic));
+  header.storage_size = st->size;
+  header.page_size = host_page_size;
+  header.n_chunks = 0;
+  bool ok = (fwrite(&header, sizeof(header), 1, file) == 1);
+
+  for (size_t offset = 0; ok && (offset < st->size); offset += host_page_size) {
+    size_t len = BS_MIN(host_page_size, st->size - offset);
+    size_t base_len = 0;
+
+    /* What the base image does not cover, is erased */
+    memset(base_page, 0xFF, len);
+    if (offset < st->overlay_base_size) {
+      base_len = BS_MIN(len, st->overlay_base_size - offset);
+      if (pread(st->fd, base_page, base_len, offset) != (ssize_t)base_len) {
+        bs_trace_warning_line("%s: Failed to read %s base image %s: %s\n",
+            __func__, st->type_s, st->overlay_path, strerror(errno));
+        ok = false;
+        break;
+      }
+    }
+
+    if (memcmp(base_page, &st->storage[offset], len) != 0) {
+      uint32_t offset32 = offset;
+      ok = (fwrite(&offset32, sizeof(offset32), 1, file) == 1)
+           && (fwrite(&st->storage[offset], len, 1, file) == 1);
+      header.n_chunks++;
+    }
+  }
+
+  if (ok) {
+    ok = (fseek(file, 0, SEEK_SET) == 0)
+         && (fwrite(&header, sizeof(header), 1, file) == 1);
+  }
+  if ((fclose(file) != 0) || !ok) {
+    bs_trace_warning_line("%s: Failed to write %s overlay delta file %s\n",
+        __func__, st->type_s, st->delta_path);
+  }
+
+  free(base_page);
+}
+
+/**
+ * Map the storage copy-on-write on top of its base image
+ * (and apply the delta file if there is one)
+ */
+static void nhw_nvm_initialize_overlay(nvm_storage_state_t *st) {
+  struct stat f_stat;
+
+  st->fd = open(st->overlay_path, O_RDONLY);
+  if (st->fd == -1) {
+    bs_trace_error_line("%s: Failed to open %s base image %s: %s\n",
+        __func__, st->type_s, st->overlay_path, strerror(errno));
+  }
+
+  if (fstat(st->fd, &f_stat)) {
+    bs_trace_error_line("%s: Failed to get status of %s base image %s: %s\n",
+        __func__, st->type_s, st->overlay_path, strerror(errno));
+  }
+
+  st->overlay_base_size = BS_MIN((size_t)f_stat.st_size, st->size);
+  /* We can only map full pages of the base image */
+  size_t mapped_size = st->overlay_base_size / host_page_size * host_page_size;
+
+  /* We reserve the whole storage as private memory, and map the base image over it */
+  st->storage = mmap(NULL, st->size, PROT_WRITE | PROT_READ,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (st->storage == MAP_FAILED) {
+    bs_trace_error_line("%s: Failed to allocate %s storage: %s\n",
+        __func__, st->type_s, strerror(errno));
+  }
+
+  if (mapped_size > 0) {
+    void *ptr = mmap(st->storage, mapped_size, PROT_WRITE | PROT_READ,
+                     MAP_PRIVATE | MAP_FIXED | nhw_nvm_mmap_flags(), st->fd, 0);
+    if (ptr == MAP_FAILED) {
+      bs_trace_error_line("%s: Failed to mmap %s base image %s: %s\n",
+          __func__, st->type_s, st->overlay_path, strerror(errno));
+    }
+    nhw_nvm_advise_willneed(st, ptr, mapped_size);
+  }
+
+  /* The tail not covered by the base image is erased, except its last partial page */
+  (void)memset(st->storage + mapped_size, 0xFF, st->size - mapped_size);
+  if (st->overlay_base_size > mapped_size) {
+    size_t tail = st->overlay_base_size - mapped_size;
+    if (pread(st->fd, st->storage + mapped_size, tail, mapped_size) != (ssize_t)tail) {
+      bs_trace_error_line("%s: Failed to read %s base image %s: %s\n",
+          __func__, st->type_s, st->overlay_path, strerror(errno));
+    }
+  }
+
+  if (st->delta_path != NULL) {
+    nhw_nvm_apply_overlay_delta(st);
+  }
+}
 
 /**
  * At boot, do whatever is necessary for a given storage
@@ -33,9 +313,22 @@ void nhw_nvm_initialize_data_storage(nvm_storage_state_t *st){
 
   st->fd = -1;
   st->storage = NULL;
+  st->dirty_pages = NULL;
+
+  if (host_page_size == 0) {
+    host_page_size = sysconf(_SC_PAGESIZE);
+  }
 
   if (st->in_ram == true) {
-    st->storage = (uint8_t *)bs_malloc(st->size);
+    nhw_nvm_allocate_in_ram(st);
+
+  } else if (st->overlay_path != NULL) {
+    nhw_nvm_initialize_overlay(st);
+
+    if (st->erase_at_start == true) {
+      (void)memset(st->storage, 0xFF, st->size);
+    }
+    return;
 
   } else {
 
@@ -57,19 +350,104 @@ void nhw_nvm_initialize_data_storage(nvm_storage_state_t *st){
           __func__, st->type_s, st->file_path, strerror(errno));
     }
 
-    st->storage = mmap(NULL, st->size, PROT_WRITE | PROT_READ, MAP_SHARED, st->fd, 0);
+    st->storage = mmap(NULL, st->size, PROT_WRITE | PROT_READ,
+                       MAP_SHARED | nhw_nvm_mmap_flags(), st->fd, 0);
     if (st->storage == MAP_FAILED) {
       bs_trace_error_line("%s: Failed to mmap %s device file %s: %s\n",
           __func__, st->type_s, st->file_path, strerror(errno));
     }
+    nhw_nvm_advise_willneed(st, st->storage, st->size);
+
+    /* The modified pages only need tracking if they will ever be flushed */
+    if ((flush_policy == NVM_FLUSH_PERIODIC)
+        || ((flush_policy == NVM_FLUSH_EXIT) && !st->rm_at_exit)) {
+      st->dirty_pages = (uint32_t *)bs_calloc((nhw_nvm_n_pages(st) + 31) / 32, sizeof(uint32_t));
+    }
+    st->flushed_bytes = 0;
+    nhw_nvm_register_storage(st);
+
+    if ((flush_policy == NVM_FLUSH_PERIODIC) && (Timer_NVM_flush == TIME_NEVER)) {
+      Timer_NVM_flush = nsi_hws_get_time() + flush_period;
+      nsi_hws_find_next_event();
+    }
   }
 
   if ((st->erase_at_start == true) || (st->in_ram == true) || (f_stat.st_size == 0)) {
     /* Erase the memory unit by pulling all bits to the configured erase value */
     (void)memset(st->storage, 0xFF, st->size);
+    nhw_nvm_mark_dirty(st, 0, st->size);
+  }
+}
+
+/**
+ * Mark the storage range [offset, offset + size) as modified,
+ * so it will be flushed to disk according to the flush policy.
+ */
+void nhw_nvm_mark_dirty(nvm_storage_state_t *st, size_t offset, size_t size) {
+  if ((st->dirty_pages == NULL) || (size == 0)) {
+    return;
+  }
+
+  size_t first = offset / host_page_size;
+  size_t last = (offset + size - 1) / host_page_size;
+
+  for (size_t page = first; page <= last; page++) {
+    st->dirty_pages[page / 32] |= (uint32_t)1 << (page % 32);
+  }
+}
+
+/**
+ * Flush (msync) to disk the storage pages which were modified since the last flush.
+ * Consecutive modified pages are flushed together.
+ */
+void nhw_nvm_flush_storage(nvm_storage_state_t *st) {
+  if (st->dirty_pages == NULL) {
+    return;
+  }
+
+  size_t n_pages = nhw_nvm_n_pages(st);
+  size_t page = 0;
+
+  while (page < n_pages) {
+    if (st->dirty_pages[page / 32] == 0) {
+      page = (page / 32 + 1) * 32;
+      continue;
+    }
+    if ((st->dirty_pages[page / 32] & ((uint32_t)1 << (page % 32))) == 0) {
+      page++;
+      continue;
+    }
+
+    size_t first = page;
+    while ((page < n_pages) && (st->dirty_pages[page / 32] & ((uint32_t)1 << (page % 32)))) {
+      st->dirty_pages[page / 32] &= ~((uint32_t)1 << (page % 32));
+      page++;
+    }
+
+    size_t start = first * host_page_size;
+    size_t len = BS_MIN(page * host_page_size, st->size) - start;
+
+    if (msync(st->storage + start, len, MS_SYNC) == -1) {
+      bs_trace_warning_line("%s: Failed to msync %s device file %s: %s\n",
+          __func__, st->type_s, st->file_path, strerror(errno));
+    } else {
+      st->flushed_bytes += len;
+    }
+  }
+}
+
+static void nhw_nvm_flush_timer_triggered(void) {
+  for (int i = 0; i < NVM_MAX_STORAGES; i++) {
+    if (nvm_storages[i] != NULL) {
+      nhw_nvm_flush_storage(nvm_storages[i]);
+    }
   }
+  Timer_NVM_flush += flush_period;
+  nsi_hws_find_next_event();
 }
 
+NHW_HW_EVENT(Timer_NVM_flush, nhw_nvm_flush_timer_triggered, 900);
+
 void nhw_nvm_init_storage(nvm_storage_state_t *st, struct nhw_nvm_st_args_t *args,
                           size_t size, char *type_s)
 {
@@ -79,8 +457,28 @@ void nhw_nvm_init_storage(nvm_storage_state_t *st, struct nhw_nvm_st_args_t *arg
   st->in_ram         = args->in_ram;
   st->size           = size;
   st->type_s         = type_s;
+  st->overlay_path   = args->overlay;
+  st->delta_path     = args->delta;
+
+  if ((st->overlay_path != NULL) && (st->file_path != NULL) && (st->in_ram == false)) {
+    bs_trace_warning_line("Both a file (%s) and a base image (%s) were provided for the %s, "
+        "the file will be ignored\n", st->file_path, st->overlay_path, type_s);
+  }
+  if ((st->delta_path != NULL) && ((st->overlay_path == NULL) || (st->in_ram == true))) {
+    bs_trace_warning_line("An overlay delta file was provided for the %s, but it is not in "
+        "overlay mode, it will be ignored\n", type_s);
+  }
+
+  struct timespec t_start, t_end;
 
+  clock_gettime(CLOCK_MONOTONIC, &t_start);
   nhw_nvm_initialize_data_storage(st);
+  clock_gettime(CLOCK_MONOTONIC, &t_end);
+
+  double init_ms = (t_end.tv_sec - t_start.tv_sec) * 1e3
+                   + (t_end.tv_nsec - t_start.tv_nsec) * 1e-6;
+  bs_trace_info(3, "%s storage (%zu bytes) initialized in %.3f ms\n",
+                type_s, size, init_ms);
 }
 
 /**
@@ -92,17 +490,48 @@ void nhw_nvm_clear_storage(nvm_storage_state_t *st){
 
   if (st->in_ram == true) {
     if (st->storage != NULL) {
-      free(st->storage);
+      if (st->in_ram_mmap) {
+        munmap(st->storage, st->size);
+      } else {
+        free(st->storage);
+      }
+      st->storage = NULL;
+    }
+    return;
+  }
+
+  if (st->overlay_path != NULL) {
+    if ((st->storage != MAP_FAILED) && (st->storage != NULL)) {
+      if (st->delta_path != NULL) {
+        nhw_nvm_save_overlay_delta(st);
+      }
+      munmap(st->storage, st->size);
       st->storage = NULL;
     }
+    if (st->fd != -1) {
+      close(st->fd);
+      st->fd = -1;
+    }
     return;
   }
 
   if ((st->storage != MAP_FAILED) && (st->storage != NULL)) {
+    /* There is no point in flushing a file we are about to remove */
+    if ((flush_policy != NVM_FLUSH_NEVER) && !st->rm_at_exit) {
+      nhw_nvm_flush_storage(st);
+      bs_trace_info(2, "%s device file %s: %"PRIu64" bytes flushed\n",
+                    st->type_s, st->file_path, st->flushed_bytes);
+    }
     munmap(st->storage, st->size);
     st->storage = NULL;
   }
 
+  if (st->dirty_pages != NULL) {
+    free(st->dirty_pages);
+    st->dirty_pages = NULL;
+  }
+  nhw_nvm_unregister_storage(st);
+
   if (st->fd != -1) {
     close(st->fd);
     st->fd = -1;
@@ -114,3 +543,55 @@ void nhw_nvm_clear_storage(nvm_storage_state_t *st){
     st->file_path = NULL;
   }
 }
+
+static char *flush_policy_s;
+
+static void arg_nvm_flush_found(char *argv, int offset) {
+  (void) offset;
+
+  if (strcmp(flush_policy_s, "never") == 0) {
+    flush_policy = NVM_FLUSH_NEVER;
+  } else if (strcmp(flush_policy_s, "exit") == 0) {
+    flush_policy = NVM_FLUSH_EXIT;
+  } else {
+    char *endptr;
+    double period_ms = strtod(flush_policy_s, &endptr);
+
+    if ((*endptr != 0) || (period_ms < 1e-3)) {
+      bs_trace_error_line("nvm_flush must be set to never, exit, or a period in ms (%s)\n", argv);
+    }
+    flush_policy = NVM_FLUSH_PERIODIC;
+    flush_period = period_ms * 1000;
+  }
+}
+
+static void nhw_nvm_backend_register_cmd_args(void) {
+  static bs_args_struct_t args_struct_toadd[] = {
+    { .option = "nvm_flush",
+      .name = "policy",
+      .type = 's',
+      .dest = (void*)&flush_policy_s,
+      .call_when_found = arg_nvm_flush_found,
+      .descript = "When to flush to disk the modified pages of file backed NVM storages "
+                  "(flash, RRAM, UICR): never (default, left to the OS), exit, or "
+                  "<N>: every N simulated ms and on exit"
+    },
+    { .is_switch = true,
+      .option = "nvm_prefault",
+      .type = 'b',
+      .dest = (void*)&prefault,
+      .descript = "Prefault (MAP_POPULATE) file backed NVM storages at startup"
+    },
+    { .is_switch = true,
+      .option = "nvm_hugepages",
+      .type = 'b',
+      .dest = (void*)&hugepages,
+      .descript = "Back in RAM NVM storages with transparent huge pages (MADV_HUGEPAGE)"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args_struct_toadd);
+}
+
+NSI_TASK(nhw_nvm_backend_register_cmd_args, PRE_BOOT_1, 100);
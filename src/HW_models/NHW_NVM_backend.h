@@ -24,6 +24,12 @@ typedef struct {
   bool erase_at_start;
   bool rm_at_exit;
   bool in_ram;
+  bool in_ram_mmap; /* The in RAM storage was mmap'ed instead of malloc'ed */
+  uint32_t *dirty_pages; /* Bitmap of modified host pages not yet flushed (only if they will be flushed) */
+  uint64_t flushed_bytes; /* Bytes flushed to disk (msync'ed) so far */
+  const char *overlay_path; /* If set, base image mapped copy-on-write (the file is never modified) */
+  const char *delta_path; /* (overlay mode) File where the pages which differ from the base image are kept */
+  size_t overlay_base_size; /* (overlay mode) How much of the storage is covered by the base image */
 } nvm_storage_state_t;
 
 struct nhw_nvm_st_args_t {
@@ -31,12 +37,16 @@ struct nhw_nvm_st_args_t {
   bool erase;
   bool rm;
   bool in_ram;
+  char *overlay;
+  char *delta;
 };
 
 void nhw_nvm_initialize_data_storage(nvm_storage_state_t *st);
 void nhw_nvm_clear_storage(nvm_storage_state_t *st);
 void nhw_nvm_init_storage(nvm_storage_state_t *st, struct nhw_nvm_st_args_t *args,
                           size_t size, char *type);
+void nhw_nvm_mark_dirty(nvm_storage_state_t *st, size_t offset, size_t size);
+void nhw_nvm_flush_storage(nvm_storage_state_t *st);
 
 #define _NVM_BACKEND_PARAMS(x, real_x, arg, X, descr_prefix)                  \
 { .is_switch = true,                                                          \
@@ -67,12 +77,30 @@ void nhw_nvm_init_storage(nvm_storage_state_t *st, struct nhw_nvm_st_args_t *arg
   .descript = descr_prefix "Remove the " # X " file when terminating the execution "\
                "(default no)"                                                 \
 },                                                                            \
+{ .option = NSI_STRINGIFY(x) "_overlay",                                      \
+  .name = "path",                                                             \
+  .type = 's',                                                                \
+  .dest = (void*)&nvmc_args. arg .overlay,                                    \
+  .call_when_found = arg_##real_x##_file_found,                               \
+  .descript = descr_prefix "Path to a base image for the " #X " which is "    \
+  "mapped copy-on-write: its content is used but the file is never modified " \
+  "(takes precedence over " NSI_STRINGIFY(x) "_file, toggles "                \
+  NSI_STRINGIFY(x) "_in_ram to false)"                                        \
+},                                                                            \
+{ .option = NSI_STRINGIFY(x) "_overlay_delta",                                \
+  .name = "path",                                                             \
+  .type = 's',                                                                \
+  .dest = (void*)&nvmc_args. arg .delta,                                      \
+  .descript = descr_prefix "(with " NSI_STRINGIFY(x) "_overlay) File where "  \
+  "the " #X " pages which differ from the base image are saved at exit. "     \
+  "If it exists at boot, it is applied on top of the base image"              \
+},                                                                            \
 { .is_switch = true,                                                          \
   .option = NSI_STRINGIFY(x) "_in_ram",                                       \
   .type = 'b',                                                                \
   .call_when_found = arg_##real_x##_in_ram_found,                             \
   .descript = descr_prefix "(default)  Instead of a file, keep the " #X " content in RAM."\
-        "If this is set " NSI_STRINGIFY(x) "_erase/_file & _rm "              \
+        "If this is set " NSI_STRINGIFY(x) "_erase/_file/_overlay & _rm "     \
         "are ignored, and the " #X " content is always reset at startup"      \
 }
 
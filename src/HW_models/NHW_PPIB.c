@@ -21,6 +21,10 @@
  *   * Just like in real HW, TASKS_SEND and EVENT_RECEIVE registers are not
  *     connected to anything. The HW model does not toggle them or react to
  *     them being written.
+ *
+ *   * Events are transferred to the mate PPIB and published there right away, in the
+ *     same delta cycle. If the DPPI queued delivery mode is enabled (-dppi_queued), they
+ *     are queued and merged in the mate's DPPI as any other event (see NHW_DPPI.c).
  */
 
 #include <string.h>
@@ -154,11 +158,11 @@ void nhw_PPIB_regw_sideeffects_SUBSCRIBE_SEND(uint inst, uint ppib_ch){
 
   nhw_ppib_hardwired_check(NRF_PPIB_regs[inst].SUBSCRIBE_SEND[ppib_ch], ppib_ch);
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       this->NRF_PPIB_regs->SUBSCRIBE_SEND[ppib_ch],
-                                       &this->subscribed[ppib_ch],
-                                       nhw_ppib_tasksend_wrap,
-                                       (void*)((inst << 16) + ppib_ch));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &this->NRF_PPIB_regs->SUBSCRIBE_SEND[ppib_ch],
+                                           &this->subscribed[ppib_ch],
+                                           nhw_ppib_tasksend_wrap,
+                                           (void*)((inst << 16) + ppib_ch));
 }
 
 /*
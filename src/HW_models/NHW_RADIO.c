@@ -215,6 +215,9 @@
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
 #include "weak_stubs.h"
+#include "NHW_dma_addr.h"
+#include "NHW_hws_profiler.h"
+#include "NHW_misc.h"
 
 #if NHW_RADIO_TOTAL_INST > 1
 #error "This model only supports 1 instance so far"
@@ -465,6 +468,7 @@ static void abort_if_needed(void) {
    */
   if ( radio_sub_state == RX_WAIT_FOR_ADDRESS_END ){
     //we answer immediately to the phy rejecting the packet
+    nhw_pre_block();
     p2G4_dev_rxv2_cont_after_addr_nc_b(false, NULL);
     radio_sub_state = SUB_STATE_INVALID;
   }
@@ -887,7 +891,7 @@ static void nhw_radio_timer_triggered(void) {
   }
 }
 
-NSI_HW_EVENT(Timer_RADIO, nhw_radio_timer_triggered, 990 /*We want the radio to be one of the very last to avoid unnecessary abort re-evaluations to the Phy*/);
+NHW_HW_EVENT(Timer_RADIO, nhw_radio_timer_triggered, 990 /*We want the radio to be one of the very last to avoid unnecessary abort re-evaluations to the Phy*/);
 
 /**
  * The abort reevaluation timer has just triggered,
@@ -910,7 +914,7 @@ static void nhw_radio_timer_abort_reeval_triggered(void) {
   }
 }
 
-NSI_HW_EVENT(Timer_RADIO_abort_reeval, nhw_radio_timer_abort_reeval_triggered, 999 /* Purposely the last (all other events must have been evaluated before) */);
+NHW_HW_EVENT(Timer_RADIO_abort_reeval, nhw_radio_timer_abort_reeval_triggered, 999 /* Purposely the last (all other events must have been evaluated before) */);
 
 /**
  * Handle all possible responses to a Tx request from the Phy
@@ -960,6 +964,7 @@ static void Tx_abort_eval_respond(void) {
 
   update_abort_struct(abort, &abort_next_recheck_time);
 
+  nhw_pre_block();
   int ret = p2G4_dev_provide_new_tx_abort_nc_b(abort);
 
   handle_Tx_response(ret);
@@ -1074,9 +1079,11 @@ static void start_Tx(void) {
     int ret;
     if (tx_status.codedphy) {
       //Request the FEC1 Tx from the Phy:
+      nhw_pre_block();
       ret = p2G4_dev_req_txv2_nc_b(&tx_status.tx_req_fec1, &CI, &tx_status.tx_resp);
     } else { /* not codedphy */
       //Request the Tx from the Phy:
+      nhw_pre_block();
       ret = p2G4_dev_req_txv2_nc_b(&tx_status.tx_req, tx_buf, &tx_status.tx_resp);
     }
     handle_Tx_response(ret);
@@ -1093,6 +1100,7 @@ static void start_Tx_FEC2(void) {
   int ret;
   update_abort_struct(&tx_status.tx_req.abort, &abort_next_recheck_time);
   tx_status.tx_req.phy_address = 0; /* An invalid address */
+  nhw_pre_block();
   ret = p2G4_dev_req_txv2_nc_b(&tx_status.tx_req, tx_buf, &tx_status.tx_resp);
   handle_Tx_response(ret);
 }
@@ -1204,19 +1212,21 @@ static void Rx_handle_address_end_response(bs_time_t address_time) {
 
   rx_status.CRC_End_Time = rx_status.PAYLOAD_End_Time + rx_status.CRC_duration + TERM2_duration; //Provisional value (if we are accepting the packet)
 
+  uint8_t *packet = (uint8_t *)nhw_dma_addr_to_ptr(NRF_RADIO_regs.PACKETPTR);
+
   //Copy the whole packet (S0, lenght, S1 & payload) excluding the CRC.
   if (nhwra_mode_is_ble()) {
     if (rx_status.rx_resp.packet_size >= 5) { /*At least the header and CRC, otherwise better to not try to copy it*/
-      ((uint8_t*)NRF_RADIO_regs.PACKETPTR)[0] = rx_buf[0];
-      ((uint8_t*)NRF_RADIO_regs.PACKETPTR)[1] = rx_buf[1];
+      packet[0] = rx_buf[0];
+      packet[1] = rx_buf[1];
       /* We cheat a bit and copy the whole packet already (The AAR block will look in Adv packets after 64 bits)*/
-      memcpy(&((uint8_t*)NRF_RADIO_regs.PACKETPTR)[2 + rx_status.S1Offset],
+      memcpy(&packet[2 + rx_status.S1Offset],
           &rx_buf[2] , length);
     }
   } else if (nhwra_mode_is_154()) {
     if (rx_status.rx_resp.packet_size >= 3) { /*At least the header and CRC, otherwise better to not try to copy it*/
-            ((uint8_t*)NRF_RADIO_regs.PACKETPTR)[0] = rx_buf[0];
-            memcpy(&((uint8_t*)NRF_RADIO_regs.PACKETPTR)[1 + rx_status.S1Offset],
+            packet[0] = rx_buf[0];
+            memcpy(&packet[1 + rx_status.S1Offset],
                 &rx_buf[1] , length);
           }
   } //Eventually this should be generalized with the packet configuration
@@ -1227,7 +1237,7 @@ static void Rx_handle_address_end_response(bs_time_t address_time) {
     double RSSI = p2G4_RSSI_value_to_dBm(rx_status.rx_resp.rssi.RSSI) + cheat_options.rx_power_offset;
     uint8_t LQI = nhwra_dBm_to_modem_LQIformat(RSSI);
     //Eventually this should be generalized with the packet configuration:
-    ((uint8_t*)NRF_RADIO_regs.PACKETPTR)[1 + rx_status.S1Offset + length] = LQI;
+    packet[1 + rx_status.S1Offset + length] = LQI;
   }
 
 }
@@ -1308,6 +1318,7 @@ static p2G4_rssi_power_t Rx_abort_imm_RSSI(void) {
   rssi_req.antenna_gain = rx_req->antenna_gain;
   memcpy(&rssi_req.radio_params, &rx_req->radio_params, sizeof(p2G4_radioparams_t));
 
+  nhw_pre_block();
   int ret = p2G4_dev_req_imm_RSSI_nc_b(&rssi_req, &rssi_resp);
 
   if (ret == -1) {
@@ -1328,6 +1339,7 @@ static void Rx_abort_eval_respond(void) {
   p2G4_abort_t *abort = &rx_status.rx_req.abort;
   update_abort_struct(abort, &abort_next_recheck_time);
 
+  nhw_pre_block();
   int ret = p2G4_dev_provide_new_rxv2_abort_nc_b(abort);
 
   handle_Rx_response(ret);
@@ -1386,10 +1398,12 @@ static void start_Rx(void) {
   //attempt to receive
   int ret;
   if (rx_status.codedphy) {
+    nhw_pre_block();
     ret = p2G4_dev_req_rxv2_nc_b(&rx_status.rx_req_fec1, rx_addresses,
                                  &rx_status.rx_resp, &rx_pkt_buffer_ptr,
                                  _NRF_MAX_PACKET_SIZE);
   } else {
+    nhw_pre_block();
     ret = p2G4_dev_req_rxv2_nc_b(&rx_status.rx_req, rx_addresses,
                                  &rx_status.rx_resp,&rx_pkt_buffer_ptr,
                                  _NRF_MAX_PACKET_SIZE);
@@ -1429,6 +1443,7 @@ static void start_Rx_FEC2(void) {
 
   int ret;
 
+  nhw_pre_block();
   ret = p2G4_dev_req_rxv2_nc_b(&rx_status.rx_req, NULL,
                                &rx_status.rx_resp, &rx_pkt_buffer_ptr,
                                _NRF_MAX_PACKET_SIZE);
@@ -1465,6 +1480,7 @@ static void Rx_Addr_received(void) {
   }
 
   update_abort_struct(&rx_status.rx_req.abort, &abort_next_recheck_time);
+  nhw_pre_block();
   int ret = p2G4_dev_rxv2_cont_after_addr_nc_b(accept_packet, &rx_status.rx_req.abort);
 
   if ( accept_packet ){ /* Always true for CodedPhy FEC1 */
@@ -1590,6 +1606,7 @@ static void CCA_abort_eval_respond(void) {
 
   update_abort_struct(abort, &abort_next_recheck_time);
 
+  nhw_pre_block();
   int ret = p2G4_dev_provide_new_cca_abort_nc_b(abort);
 
   handle_CCA_response(ret);
@@ -1615,6 +1632,7 @@ static void start_CCA_ED(bool CCA_not_ED){
   nhwra_set_Timer_RADIO(cca_status.CCA_end_time);
 
   //Request the CCA from the Phy:
+  nhw_pre_block();
   int ret = p2G4_dev_req_cca_nc_b(&cca_status.cca_req, &cca_status.cca_resp);
   handle_CCA_response(ret);
 }
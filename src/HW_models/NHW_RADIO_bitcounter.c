@@ -23,6 +23,7 @@
 #include "nsi_hw_scheduler.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 static bs_time_t Timer_RADIO_bitcounter = TIME_NEVER;
 
@@ -38,7 +39,7 @@ static void nrf_radio_bitcounter_timer_triggered(void) {
   //Note that we leave the bit counter running, so a new BCC can be programmed to make it trigger later
 }
 
-NSI_HW_EVENT(Timer_RADIO_bitcounter, nrf_radio_bitcounter_timer_triggered, 50);
+NHW_HW_EVENT(Timer_RADIO_bitcounter, nrf_radio_bitcounter_timer_triggered, 50);
 
 void nhw_RADIO_TASK_BCSTART(void) {
   /* Note that we do not validate that the end of the address has been received */
@@ -24,6 +24,7 @@
 #include "NHW_RADIO_timings.h"
 #include "NRF_HWLowL.h"
 #include "nsi_hw_scheduler.h"
+#include "NHW_dma_addr.h"
 
 extern NRF_RADIO_Type NRF_RADIO_regs;
 static double cheat_tx_power_offset;
@@ -755,14 +756,16 @@ uint nhwra_tx_copy_payload(uint8_t *tx_buf){
   LFLenb = (NRF_RADIO_regs.PCNF0 & RADIO_PCNF0_LFLEN_Msk) >> RADIO_PCNF0_LFLEN_Pos;
   LFLenB = (LFLenb + 7)/8;
 
+  uint8_t *packet = (uint8_t *)nhw_dma_addr_to_ptr(NRF_RADIO_regs.PACKETPTR);
+
   //copy from RAM to Tx buffer
   i = 0;
   if (S0Len) {
-    tx_buf[0] = ((uint8_t*)NRF_RADIO_regs.PACKETPTR)[0];
+    tx_buf[0] = packet[0];
     i++;
   }
   for (int j = 0; j < LFLenB; j++){ //Copy up to 2 Length bytes
-    tx_buf[i] = ((uint8_t*)NRF_RADIO_regs.PACKETPTR)[i];
+    tx_buf[i] = packet[i];
     i++;
   }
   int S1Off = 0;
@@ -794,7 +797,7 @@ uint nhwra_tx_copy_payload(uint8_t *tx_buf){
   }
 
   int copy_len = payload_len + S1LenB;
-  memcpy(&tx_buf[i], &((uint8_t*)NRF_RADIO_regs.PACKETPTR)[i + S1Off], copy_len);
+  memcpy(&tx_buf[i], &packet[i + S1Off], copy_len);
   return payload_len;
 }
 
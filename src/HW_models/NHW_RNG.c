@@ -36,6 +36,7 @@
 #include "bs_rand_main.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 NRF_RNG_Type NRF_RNG_regs;
 static bs_time_t Timer_RNG = TIME_NEVER; //Time when the next random number will be ready
@@ -148,4 +149,4 @@ static void nhw_rng_timer_triggered(void) {
   nhw_RNG_signal_VALRDY(0);
 }
 
-NSI_HW_EVENT(Timer_RNG, nhw_rng_timer_triggered, 50);
+NHW_HW_EVENT(Timer_RNG, nhw_rng_timer_triggered, 50);
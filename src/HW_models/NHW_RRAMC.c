@@ -156,6 +156,7 @@ NSI_TASK(nhw_RRAMC_uicr_clean_up, ON_EXIT_PRE, 100);
 static void nhw_RRAMC_erase_uicr(uint inst){
   struct hw_rramc_st_t *this = &hw_rramc_st[inst];
   (void)memset(this->uicr_st.storage, 0xFF, this->uicr_st.size);
+  nhw_nvm_mark_dirty(&this->uicr_st, 0, this->uicr_st.size);
 }
 
 /*
@@ -165,6 +166,7 @@ static void nhw_RRAMC_erase_all(uint inst){
   struct hw_rramc_st_t *this = &hw_rramc_st[inst];
   nhw_RRAMC_erase_uicr(inst);
   (void)memset(this->rram_st.storage, 0xFF, this->rram_st.size);
+  nhw_nvm_mark_dirty(&this->rram_st, 0, this->rram_st.size);
 }
 
 void nhw_RRAMC_regw_sideeffects_ERASEALL(uint inst) {
@@ -232,6 +234,7 @@ void nhw_RRAMC_write_word(uint32_t address, uint32_t value){
   nhw_RRAMC_address_location(address, &inst, &backend, &offset);
 
   *(uint32_t*)&backend->storage[offset] = value;
+  nhw_nvm_mark_dirty(backend, offset, sizeof(uint32_t));
 }
 
 /*
@@ -256,6 +259,7 @@ void nhw_RRAMC_write_halfword(uint32_t address, uint16_t value){
   nhw_RRAMC_address_location(address, &inst, &backend, &offset);
 
   *(uint16_t*)&backend->storage[offset] = value;
+  nhw_nvm_mark_dirty(backend, offset, sizeof(uint16_t));
 }
 
 /*
@@ -274,6 +278,7 @@ void nhw_RRAMC_write_byte(uint32_t address, uint8_t value){
   nhw_RRAMC_address_location(address, &inst, &backend, &offset);
 
   *(uint8_t*)&backend->storage[offset] = value;
+  nhw_nvm_mark_dirty(backend, offset, sizeof(uint8_t));
 }
 
 /**
@@ -339,11 +344,12 @@ void nhw_RRAMC_write_buffer(uint32_t address, void *src, size_t size) {
 
   nhw_RRAMC_address_location(address, &inst, &backend, &offset);
 
-  if (offset + size >= backend->size) {
+  if (offset + size > backend->size) {
     OUT_OF_RRAM_ERROR(address + size);
   }
 
   (void)memcpy(&backend->storage[offset], src, size);
+  nhw_nvm_mark_dirty(backend, offset, size);
 }
 
 /**
@@ -369,7 +375,7 @@ void nhw_RRAMC_read_buffer(void *dest, uint32_t address, size_t size) {
 
   nhw_RRAMC_address_location(address, &inst, &backend, &offset);
 
-  if (offset + size >= backend->size) {
+  if (offset + size > backend->size) {
     OUT_OF_RRAM_ERROR(address + size);
   }
 
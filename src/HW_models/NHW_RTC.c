@@ -102,6 +102,7 @@
 #include "NHW_CLOCK.h"
 #include "irq_ctrl.h"
 #include "NHW_RTC.h"
+#include "NHW_hws_profiler.h"
 
 #define RTC_COUNTER_MASK 0xFFFFFF /*24 bits*/
 #define RTC_TRIGGER_OVERFLOW_COUNTER_VALUE 0xFFFFF0
@@ -325,6 +326,8 @@ static bs_time_t get_counter_match_time(uint rtc, uint64_t counter_match, uint64
 }
 
 static void nhw_rtc_update_master_timer(void) {
+  bs_time_t old_timer = Timer_RTC;
+
   Timer_RTC = TIME_NEVER;
   for (int rtc = 0; rtc < NHW_RTC_TOTAL_INST ; rtc++) {
     struct rtc_status *this = &nhw_rtc_st[rtc];
@@ -342,14 +345,14 @@ static void nhw_rtc_update_master_timer(void) {
       Timer_RTC = this->overflow_timer;
     }
   }
-  nsi_hws_find_next_event();
+  nhw_hws_timer_updated(old_timer, Timer_RTC);
 }
 
 /**
  * Save in cc_timers[cc] the *next* time when this RTC will match the
  * CC[cc] register
  */
-static void update_cc_timer(uint rtc, uint cc) {
+static void nhw_rtc_update_cc_timer(uint rtc, uint cc) {
   uint64_t match_sub_us; // Only to comply to the interface
   nhw_rtc_st[rtc].cc_timers[cc] = get_counter_match_time(rtc, NRF_RTC_regs[rtc].CC[cc] & RTC_COUNTER_MASK, &match_sub_us);
 }
@@ -358,9 +361,9 @@ static void update_cc_timer(uint rtc, uint cc) {
  * Update all cc_timers[*] for a RTC instance
  * to the *next* time when they will match
  */
-static void update_all_cc_timers(uint rtc) {
+static void nhw_rtc_update_all_cc_timers(uint rtc) {
   for (int cc = 0 ; cc < nhw_rtc_st[rtc].n_CCs; cc++) {
-    update_cc_timer(rtc, cc);
+    nhw_rtc_update_cc_timer(rtc, cc);
   }
 }
 
@@ -371,7 +374,7 @@ static void update_overflow_timer(uint rtc) {
 
 static void update_timers(int rtc)
 {
-  update_all_cc_timers(rtc);
+  nhw_rtc_update_all_cc_timers(rtc);
   update_overflow_timer(rtc);
   nhw_rtc_update_master_timer();
 }
@@ -440,7 +443,7 @@ static void nhw_rtc_timer_triggered(void) {
 
     for (int cc = 0 ; cc < rtc_el->n_CCs ; cc++) {
       if (rtc_el->cc_timers[cc] == match_time ){ //This CC is matching now
-        update_cc_timer(rtc, cc); //Next time it will match
+        nhw_rtc_update_cc_timer(rtc, cc); //Next time it will match
         nhw_rtc_signal_COMPARE(rtc, cc);
       }
     }
@@ -453,7 +456,7 @@ static void nhw_rtc_timer_triggered(void) {
   nhw_rtc_update_master_timer();
 }
 
-NSI_HW_EVENT(Timer_RTC, nhw_rtc_timer_triggered, 50);
+NHW_HW_EVENT(Timer_RTC, nhw_rtc_timer_triggered, 50);
 
 /**
  * Check if an EVTEN or INTEN has the tick event set
@@ -776,11 +779,11 @@ static void nhw_rtc_taskcapture_wrap(void* param) {
 void nhw_rtc_regw_sideeffects_SUBSCRIBE_CAPTURE(uint inst, uint cc_n) {
   struct rtc_status *this = &nhw_rtc_st[inst];
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       this->NRF_RTC_regs->SUBSCRIBE_CAPTURE[cc_n],
-                                       &this->subscribed_CAPTURE[cc_n],
-                                       nhw_rtc_taskcapture_wrap,
-                                       (void*)((inst << 16) + cc_n));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &this->NRF_RTC_regs->SUBSCRIBE_CAPTURE[cc_n],
+                                           &this->subscribed_CAPTURE[cc_n],
+                                           nhw_rtc_taskcapture_wrap,
+                                           (void*)((inst << 16) + cc_n));
 }
 
 #define NHW_RTC_REGW_SIDEFFECTS_SUBSCRIBE(TASK_N)                                 \
@@ -793,11 +796,11 @@ void nhw_rtc_regw_sideeffects_SUBSCRIBE_CAPTURE(uint inst, uint cc_n) {
   {                                                                               \
      struct rtc_status *this = &nhw_rtc_st[inst];                                 \
                                                                                   \
-     nhw_dppi_common_subscribe_sideeffect(this->dppi_map,                         \
-                                          this->NRF_RTC_regs->SUBSCRIBE_##TASK_N, \
-                                          &this->subscribed_##TASK_N,             \
-                                          nhw_rtc_task##TASK_N##_wrap,            \
-                                          (void*) inst);                          \
+     nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,                     \
+                                              &this->NRF_RTC_regs->SUBSCRIBE_##TASK_N, \
+                                              &this->subscribed_##TASK_N,         \
+                                              nhw_rtc_task##TASK_N##_wrap,        \
+                                              (void*) inst);                      \
   }
 
 NHW_RTC_REGW_SIDEFFECTS_SUBSCRIBE(START)
@@ -863,7 +866,7 @@ void nhw_rtc_regw_sideeffects_CC(uint rtc, uint cc_n) {
   struct rtc_status *this = &nhw_rtc_st[rtc];
 
   if (this->running == true) {
-    update_cc_timer(rtc, cc_n);
+    nhw_rtc_update_cc_timer(rtc, cc_n);
     nhw_rtc_update_master_timer();
   }
 }
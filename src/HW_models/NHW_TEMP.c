@@ -31,6 +31,7 @@
 #include "NHW_peri_types.h"
 #include "NHW_xPPI.h"
 #include "irq_ctrl.h"
+#include "NHW_hws_profiler.h"
 
 #if NHW_TEMP_TOTAL_INST > 1
 #error "This model only supports 1 instance so far"
@@ -184,4 +185,4 @@ static void nhw_temp_timer_triggered(void) {
   nhw_TEMP_signal_EVENTS_DATARDY(0);
 }
 
-NSI_HW_EVENT(Timer_TEMP, nhw_temp_timer_triggered, 50);
+NHW_HW_EVENT(Timer_TEMP, nhw_temp_timer_triggered, 50);
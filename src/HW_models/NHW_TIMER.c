@@ -48,6 +48,7 @@
 #include "bs_oswrap.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 #define N_TIMERS NHW_TIMER_TOTAL_INST
 #define N_MAX_CC NHW_TIMER_MAX_N_CC
@@ -200,6 +201,8 @@ static uint64_t time_of_1_counter_wrap(int t){
  * Find the CC register timer (CC_timers[][]) which will trigger earliest (if any)
  */
 static void update_master_timer(void) {
+  bs_time_t old_timer = Timer_TIMERs;
+
   Timer_TIMERs = TIME_NEVER;
 
   for ( int t = 0 ; t < N_TIMERS ; t++){
@@ -213,7 +216,7 @@ static void update_master_timer(void) {
       }
     }
   }
-  nsi_hws_find_next_event();
+  nhw_hws_timer_updated(old_timer, Timer_TIMERs);
 }
 
 /**
@@ -481,11 +484,11 @@ static void nhw_timer_taskcapture_wrap(void* param) {
 void nhw_timer_regw_sideeffects_SUBSCRIBE_CAPTURE(uint inst, uint cc_n) {
   struct timer_status *this = &nhw_timer_st[inst];
 
-  nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                       this->NRF_TIMER_regs->SUBSCRIBE_CAPTURE[cc_n],
-                                       &this->subscribed_CAPTURE[cc_n],
-                                       nhw_timer_taskcapture_wrap,
-                                       (void*)((inst << 16) + cc_n));
+  nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                           &this->NRF_TIMER_regs->SUBSCRIBE_CAPTURE[cc_n],
+                                           &this->subscribed_CAPTURE[cc_n],
+                                           nhw_timer_taskcapture_wrap,
+                                           (void*)((inst << 16) + cc_n));
 }
 
 #define NHW_TIMER_REGW_SIDEFFECTS_SUBSCRIBE(TASK_N)                                 \
@@ -498,11 +501,11 @@ void nhw_timer_regw_sideeffects_SUBSCRIBE_CAPTURE(uint inst, uint cc_n) {
   {                                                                                 \
      struct timer_status *this = &nhw_timer_st[inst];                               \
                                                                                     \
-     nhw_dppi_common_subscribe_sideeffect(this->dppi_map,                           \
-                                          this->NRF_TIMER_regs->SUBSCRIBE_##TASK_N, \
-                                          &this->subscribed_##TASK_N,               \
-                                          nhw_timer_task##TASK_N##_wrap,            \
-                                          (void*) inst);                            \
+     nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,                       \
+                                              &this->NRF_TIMER_regs->SUBSCRIBE_##TASK_N, \
+                                              &this->subscribed_##TASK_N,           \
+                                              nhw_timer_task##TASK_N##_wrap,        \
+                                              (void*) inst);                        \
   }
 
 NHW_TIMER_REGW_SIDEFFECTS_SUBSCRIBE(START)
@@ -592,7 +595,7 @@ static void nhw_hw_model_timer_timer_triggered(void) {
   update_master_timer();
 }
 
-NSI_HW_EVENT(Timer_TIMERs, nhw_hw_model_timer_timer_triggered, 50);
+NHW_HW_EVENT(Timer_TIMERs, nhw_hw_model_timer_timer_triggered, 50);
 
 #if (NHW_HAS_PPI)
 void nhw_timer0_TASK_START(void) { nhw_timer_TASK_START(0); }
@@ -76,6 +76,18 @@
  * Implementation notes:
  *   * As for the 54 the data in the line can be a configurable amount between 4 and 9bits (due to address bit),
  *     the "byte" parameters were increased to 16bits. But the naming was kept in most of them as "byte".
+ *
+ *   * (UARTE) Tx DMA fast path: When nobody can observe the individual Tx bytes (no Tx backend or
+ *     Tx byte callback, and TXDRDY is neither enabled as interrupt nor routed to the (D)PPI),
+ *     the model does not spend one timer event per byte. Instead it jumps directly to the start of the
+ *     last byte (where ENDTX is generated), and pushes all the skipped bytes into the Tx log at once
+ *     (with their correct timestamps).
+ *     If anything that could observe the individual bytes happens meanwhile (TXDRDY interrupt enabled
+ *     or TXDRDY event cleared, STOPTX, CONFIG written, CTS raised, ...) the model brings the DMA
+ *     status up to that moment and continues byte by byte.
+ *     Changes to the TXDRDY (D)PPI routing, or to the BAUDRATE, while a transfer is ongoing are only
+ *     noticed at the end of the transfer. The fast path can be disabled with the command line
+ *     option -uart_tx_dma_bytewise
  */
 
 #include <stdbool.h>
@@ -98,6 +110,8 @@
 #include "nsi_hw_scheduler.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_dma_addr.h"
+#include "NHW_hws_profiler.h"
 
 static struct uarte_status nhw_uarte_st[NHW_UARTE_TOTAL_INST];
 NRF_UARTE_Type NRF_UARTE_regs[NHW_UARTE_TOTAL_INST];
@@ -130,6 +144,9 @@ static void nhw_UARTE_Tx_send_byte(unsigned int inst, struct uarte_status *u_el)
 static void nhw_UART_Tx_queue_byte(uint inst, struct uarte_status *u_el, uint16_t byte);
 static void nhw_UARTE_Rx_DMA_attempt(uint inst, struct uarte_status *u_el);
 static void raise_RTS_R(uint inst, struct uarte_status *u_el);
+static void nhw_uarte_tx_fast_stop(uint inst, struct uarte_status *u_el);
+
+static bool nhw_uarte_tx_fast_disabled;
 
 static void nhw_uarte_init(void) {
 #if (NHW_HAS_DPPI)
@@ -196,6 +213,9 @@ NSI_TASK(nhw_uarte_init, HW_INIT, 200); /* Allow backend to be registered before
 static void nhw_uarte_cleanup(void) {
   for (int i = 0; i < NHW_UARTE_TOTAL_INST; i++) {
     struct uarte_status *u_el = &nhw_uarte_st[i];
+    if (u_el->tx_fast) { /* Let's get the bytes sent until now into the log */
+      nhw_uarte_tx_fast_stop(i, u_el);
+    }
     if (u_el->Tx_log_file) {
       fclose(u_el->Tx_log_file);
       u_el->Tx_log_file = NULL;
@@ -226,6 +246,9 @@ NSI_TASK(nhw_uarte_cleanup, ON_EXIT_PRE, 100);
 uart_rtxb_cb_f nhw_uarte_register_rx_cb(int inst, uart_rtxb_cb_f cb, bool Rx_NotTx) {
   struct uarte_status *u_el = &nhw_uarte_st[inst];
   uart_rtxb_cb_f prev = u_el->trx_callbacks[(int) Rx_NotTx];
+  if (!Rx_NotTx && u_el->tx_fast) {
+    nhw_uarte_tx_fast_stop(inst, u_el);
+  }
   u_el->trx_callbacks[(int) Rx_NotTx] = cb;
   return prev;
 }
@@ -406,7 +429,7 @@ static void nhw_UARTE_Rx_DMA_attempt(uint inst, struct uarte_status * u_el) {
     return;
   }
 
-  uint8_t *p = (uint8_t *)(u_el->RXD_PTR + u_el->RXD_AMOUNT);
+  uint8_t *p = (uint8_t *)nhw_dma_addr_to_ptr(u_el->RXD_PTR) + u_el->RXD_AMOUNT;
 
   while (u_el->Rx_FIFO_cnt && (u_el->RXD_AMOUNT < u_el->RXD_MAXCNT)) {
     uint8_t value = Rx_FIFO_pop(inst, u_el);
@@ -574,6 +597,9 @@ void nhw_UARTE_CTS_raised(uint inst) {
   if (nhw_uarte_st[inst].CTS_blocking == true) {
     return;
   }
+  if (nhw_uarte_st[inst].tx_fast) {
+    nhw_uarte_tx_fast_stop(inst, &nhw_uarte_st[inst]);
+  }
   nhw_uarte_st[inst].CTS_blocking = true;
 
   if ( !(uart_enabled(inst) || uarte_enabled(inst)) ) {
@@ -589,6 +615,13 @@ static void nhw_UARTE_eval_interrupt(uint inst) {
   bool new_int_line = false;
   uint32_t inten = NRF_UARTE_regs[inst].INTEN;
 
+  if (nhw_uarte_st[inst].tx_fast
+      && ((inten & UARTE_INTENSET_TXDRDY_Msk) || !NRF_UARTE_regs[inst].EVENTS_TXDRDY)) {
+    /* Somebody became interested in the individual TXDRDY events
+     * (its interrupt was enabled, or the event was cleared) */
+    nhw_uarte_tx_fast_stop(inst, &nhw_uarte_st[inst]);
+  }
+
   NHW_CHECK_INTERRUPT(UARTE, NRF_UARTE_regs[inst]., CTS, inten)
   NHW_CHECK_INTERRUPT(UARTE, NRF_UARTE_regs[inst]., NCTS, inten)
   NHW_CHECK_INTERRUPT(UARTE, NRF_UARTE_regs[inst]., RXDRDY, inten)
@@ -770,7 +803,7 @@ static uint16_t nhw_UART_prep_Tx_data(uint inst, struct uarte_status *u_el, uint
 
 static void nHW_UARTE_Tx_DMA_byte(int inst, struct uarte_status *u_el)
 {
-  uint8_t *ptr = (uint8_t *)(u_el->TXD_PTR + u_el->TXD_AMOUNT);
+  uint8_t *ptr = (uint8_t *)nhw_dma_addr_to_ptr(u_el->TXD_PTR) + u_el->TXD_AMOUNT;
 
   uint16_t data = nhw_UART_prep_Tx_data(inst, u_el, *ptr);
 
@@ -840,6 +873,10 @@ void nhw_UARTE_TASK_STOPTX(uint inst)
 {
   struct uarte_status * u_el = &nhw_uarte_st[inst];
 
+  if (u_el->tx_fast) {
+    nhw_uarte_tx_fast_stop(inst, u_el);
+  }
+
   /* STOP behavior is slightly different in UART and UART-E modes */
   if (uart_enabled(inst)) {
     if (u_el->tx_status > Tx_Idle) {
@@ -928,6 +965,75 @@ static void nhw_UART_Tx_queue_byte(uint inst, struct uarte_status *u_el, uint16_
   }
 }
 
+/*
+ * Could anybody observe the individual bytes (or their TXDRDY events) of a Tx DMA?
+ */
+static bool nhw_uarte_tx_bytes_observed(uint inst, struct uarte_status *u_el) {
+  if (u_el->backend.tx_byte_f || u_el->trx_callbacks[0]) {
+    return true;
+  }
+  if (NRF_UARTE_regs[inst].INTEN & UARTE_INTENSET_TXDRDY_Msk) {
+    return true;
+  }
+#if (NHW_HAS_PPI)
+  return nrf_ppi_event_is_routed(inst == 0 ? UARTE0_EVENTS_TXDRDY : UARTE1_EVENTS_TXDRDY);
+#elif (NHW_HAS_DPPI)
+  return nhw_dppi_publish_is_enabled(NRF_UARTE_regs[inst].PUBLISH_TXDRDY);
+#else
+  return false;
+#endif
+}
+
+/*
+ * Called after a Tx DMA byte has started being sent:
+ * If nobody can observe it, skip directly to the start of the last byte,
+ * instead of waiting for each byte to be done.
+ */
+static void nhw_uarte_tx_fast_try(uint inst, struct uarte_status *u_el) {
+  if (nhw_uarte_tx_fast_disabled
+      || (u_el->tx_dma_status != DMAing) || (u_el->tx_status != Txing)
+      || (u_el->TXD_AMOUNT + 2 > u_el->TXD_MAXCNT)
+      || nhw_uarte_tx_bytes_observed(inst, u_el)) {
+    return;
+  }
+
+  bs_time_t byte_time = nhw_uarte_one_byte_time(inst);
+
+  u_el->tx_fast = true;
+  /* When the first byte of the DMA started (assuming no pauses) */
+  u_el->tx_fast_start = u_el->Tx_byte_done_timer - u_el->TXD_AMOUNT*byte_time;
+  u_el->Tx_byte_done_timer = u_el->tx_fast_start + (u_el->TXD_MAXCNT - 1)*byte_time;
+  nhw_uarte_update_timer();
+}
+
+/*
+ * Leave the Tx DMA fast path:
+ * Push out all bytes which would have started being sent before now,
+ * and continue normally (byte by byte) from the one currently in the line.
+ */
+static void nhw_uarte_tx_fast_stop(uint inst, struct uarte_status *u_el) {
+  bs_time_t byte_time = nhw_uarte_one_byte_time(inst);
+  bs_time_t now = nsi_hws_get_time();
+  uint32_t started = (now - u_el->tx_fast_start + byte_time - 1) / byte_time;
+
+  u_el->tx_fast = false;
+
+  for (uint32_t i = u_el->TXD_AMOUNT; i < started; i++) {
+    uint8_t *ptr = (uint8_t *)nhw_dma_addr_to_ptr(u_el->TXD_PTR) + i;
+
+    u_el->TXD_AMOUNT = i;
+    u_el->Tx_byte = nhw_UART_prep_Tx_data(inst, u_el, *ptr);
+    if (u_el->Tx_log_file) {
+      fprintf(u_el->Tx_log_file, "%"PRItime",0x%02X\n",
+              u_el->tx_fast_start + i*byte_time, u_el->Tx_byte);
+    }
+  }
+  u_el->TXD_AMOUNT = BS_MAX(u_el->TXD_AMOUNT, started);
+
+  u_el->Tx_byte_done_timer = u_el->tx_fast_start + u_el->TXD_AMOUNT*byte_time;
+  nhw_uarte_update_timer();
+}
+
 #if (NHW_UARTE_HAS_FRAMETIMEOUT)
 static void nhw_uart_maybe_program_frametimeout(int inst) {
   if (!(NRF_UARTE_regs[inst].CONFIG & UARTE_CONFIG_FRAMETIMEOUT_Msk)) {
@@ -974,6 +1080,11 @@ static void nhw_uart_Rx_TO_timer_triggered(int inst, struct uarte_status *u_el)
 
 static void nhw_uart_Tx_byte_done_timer_triggered(int inst, struct uarte_status *u_el)
 {
+  if (u_el->tx_fast) {
+    /* We reached the start of the last byte, let's finish normally */
+    nhw_uarte_tx_fast_stop(inst, u_el);
+  }
+
   u_el->Tx_byte_done_timer = TIME_NEVER;
   nhw_UARTE_signal_EVENTS_TXDRDY(inst);
 
@@ -987,6 +1098,7 @@ static void nhw_uart_Tx_byte_done_timer_triggered(int inst, struct uarte_status
 
   if (u_el->tx_dma_status == DMAing) {
     nHW_UARTE_Tx_DMA_byte(inst, u_el);
+    nhw_uarte_tx_fast_try(inst, u_el);
   }
 }
 
@@ -1024,7 +1136,7 @@ static void nhw_uart_timer_common_triggered(void)
   }
 }
 
-NSI_HW_EVENT(Timer_UART_common, nhw_uart_timer_common_triggered, 50);
+NHW_HW_EVENT(Timer_UART_common, nhw_uart_timer_common_triggered, 50);
 
 void nhw_UARTE_TASK_FLUSHRX(uint inst) {
   if (!uarte_enabled(inst)) {
@@ -1056,6 +1168,10 @@ void nhw_UARTE_TASK_SUSPEND(uint inst) {
 void nhw_UARTE_regw_sideeffects_ENABLE(unsigned int inst) {
   struct uarte_status * u_el = &nhw_uarte_st[inst];
 
+  if (u_el->tx_fast) {
+    nhw_uarte_tx_fast_stop(inst, u_el);
+  }
+
   if (NRF_UARTE_regs[inst].ENABLE != 0) {
     propagate_RTS_R(inst, u_el);
     return;
@@ -1098,6 +1214,9 @@ void nhw_UARTE_regw_sideeffects_ENABLE(unsigned int inst) {
 }
 
 void nhw_UARTE_regw_sideeffects_CONFIG(unsigned int inst) {
+  if (nhw_uarte_st[inst].tx_fast) {
+    nhw_uarte_tx_fast_stop(inst, &nhw_uarte_st[inst]);
+  }
 #if defined(UARTE_CONFIG_FRAMESIZE_Msk)
   uint frame_size = nhw_uarte_get_frame_size(inst);
   NRF_UARTE_regs[inst].CONFIG &= ~UARTE_CONFIG_FRAMESIZE_Msk;
@@ -1352,11 +1471,11 @@ void nhw_UARTE_regw_sideeffects_TASKS_SUSPEND(unsigned int inst) {
      static struct nhw_subsc_mem TASK_N##_subscribed[NHW_UARTE_TOTAL_INST];          \
      struct uarte_status *this = &nhw_uarte_st[inst];                                \
                                                                                      \
-     nhw_dppi_common_subscribe_sideeffect(this->dppi_map,                            \
-                                          this->UARTE_regs[inst]->SUBSCRIBE_##TASK_ST_N,\
-                                          &TASK_N##_subscribed[inst],                \
-                                          nhw_UARTE_TASK_##TASK_N##_wrap,            \
-                                          (void*) inst);                             \
+     nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,                        \
+                                              &this->UARTE_regs[inst]->SUBSCRIBE_##TASK_ST_N,\
+                                              &TASK_N##_subscribed[inst],            \
+                                              nhw_UARTE_TASK_##TASK_N##_wrap,        \
+                                              (void*) inst);                         \
   }
 
 #if (NHW_HAS_DPPI)
@@ -1385,11 +1504,11 @@ void nhw_UARTE_regw_sideeffects_SUBSCRIBE_DMA_RX_ENABLEMATCH(uint inst, uint i)
    struct uarte_status *this = &nhw_uarte_st[inst];
    uint param = (inst << 8 || (i & 0xFF));
 
-   nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                        this->UARTE_regs[inst]->SUBSCRIBE_DMA.RX.ENABLEMATCH[i],
-                                        &this->DMA_RX_ENABLEMATCH_subscribed[i],
-                                        nhw_UARTE_TASK_nhw_UARTE_TASK_DMA_RX_ENABLEMATCH_wrap,
-                                        (void*) param);
+   nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                            &this->UARTE_regs[inst]->SUBSCRIBE_DMA.RX.ENABLEMATCH[i],
+                                            &this->DMA_RX_ENABLEMATCH_subscribed[i],
+                                            nhw_UARTE_TASK_nhw_UARTE_TASK_DMA_RX_ENABLEMATCH_wrap,
+                                            (void*) param);
 }
 
 static void nhw_UARTE_TASK_nhw_UARTE_TASK_DMA_RX_DISABLEMATCH_wrap(void* param)
@@ -1404,11 +1523,11 @@ void nhw_UARTE_regw_sideeffects_SUBSCRIBE_DMA_RX_DISABLEMATCH(uint inst, uint i)
    struct uarte_status *this = &nhw_uarte_st[inst];
    uint param = (inst << 8 || (i & 0xFF));
 
-   nhw_dppi_common_subscribe_sideeffect(this->dppi_map,
-                                        this->UARTE_regs[inst]->SUBSCRIBE_DMA.RX.DISABLEMATCH[i],
-                                        &this->DMA_RX_DISABLEMATCH_subscribed[i],
-                                        nhw_UARTE_TASK_nhw_UARTE_TASK_DMA_RX_DISABLEMATCH_wrap,
-                                        (void*) param);
+   nhw_dppi_common_subscribe_sideeffect_reg(this->dppi_map,
+                                            &this->UARTE_regs[inst]->SUBSCRIBE_DMA.RX.DISABLEMATCH[i],
+                                            &this->DMA_RX_DISABLEMATCH_subscribed[i],
+                                            nhw_UARTE_TASK_nhw_UARTE_TASK_DMA_RX_DISABLEMATCH_wrap,
+                                            (void*) param);
 }
 #endif
 #endif /* NHW_HAS_DPPI */
@@ -1448,6 +1567,13 @@ static void nhw_uart_register_cmdline(void) {
       .call_when_found = uart_list,
       .descript = "List available UARTs"
     },
+    { .is_switch = true,
+      .option = "uart_tx_dma_bytewise",
+      .type = 'b',
+      .dest = &nhw_uarte_tx_fast_disabled,
+      .descript = "Model every UARTE Tx DMA byte (and its TXDRDY event) even when nobody can "
+                  "observe them (By default these are skipped over when possible)"
+    },
     ARG_TABLE_ENDMARKER
   };
 
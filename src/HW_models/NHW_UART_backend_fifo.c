@@ -23,6 +23,16 @@
  *     an API with any stability promise, if you connect your own UART model to its FIFO
  *     you should expect that to break eventually.
  *
+ *   * If both sides support it (protocol version 2), consecutive bytes are sent in bursts,
+ *     messages are buffered, and NOPs which would be superseded by a later message are not sent.
+ *     Buffered messages are written to the FIFO before this device may block waiting for any
+ *     other process (this or another UART, the Phy, a GPIO bus; see nhw_pre_block()), when the
+ *     buffer is full, or when they have been buffered for UFIFO_TX_MAX_BUF_TIME.
+ *     With -uart_fifob_protocol=1 the legacy one message per write() behavior can be forced.
+ *
+ *   * Instead of FIFOs, a shared memory ring buffer (see NHW_UART_backend_fifo_shm.c) can be
+ *     used as transport for each UART (both devices must select it).
+ *
  *   * When both Tx and Rx are off, CTS toggles will not generate the events in the right
  *     time but those events will be generated in bursts (as we are not monitoring constantly the input)
  *     Therefore for the UART(not E), a toggle of CTS will not trigger the StartRx/StopRx
@@ -49,9 +59,12 @@
 #include "NHW_peri_types.h"
 #include "NHW_UART_backend_if.h"
 #include "NHW_UART_backend_fifo.h"
+#include "NHW_UART_backend_fifo_shm.h"
 #include "nsi_hw_scheduler.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
+#include "NHW_misc.h"
 
 static bs_time_t Timer_UFIFO = TIME_NEVER;
 
@@ -72,11 +85,26 @@ static bs_time_t Timer_UFIFO = TIME_NEVER;
  */
 #define CONFIG_RELEVANT_MASK 0x3FFE
 
+/* Sizes of the user space Tx and Rx buffers (used with protocol version >= 2)
+ * The Tx buffer should not be bigger than PIPE_BUF so each write is atomic */
+#define UFIFO_TX_BUF_SIZE 4096
+#define UFIFO_RX_BUF_SIZE 16384
+/* Maximum simulated time (in us) messages are kept in the Tx buffer (with protocol version >= 2) */
+#define UFIFO_TX_MAX_BUF_TIME 1000
+
 struct line_params {
   uint32_t config;
   uint32_t baud;
 };
 
+struct ufifo_burst {
+  bs_time_t time; /* End time of the first frame */
+  bs_time_t period;
+  uint16_t n;
+  uint16_t idx; /* (Rx only) Next byte to be handed to the UART */
+  uint16_t data[UFIFO_MAX_BURST];
+};
+
 struct ufifo_st_t {
   bs_time_t Rx_timer;
   bs_time_t Tx_timer;
@@ -87,19 +115,36 @@ struct ufifo_st_t {
   int fifo_tx; /* File descriptor for tx */
   int fifo_rx; /* File descriptor for rx */
 
+  bool use_shm; /* Use shared memory rings instead of FIFOs */
+  struct nhw_ushm_ring *tx_ring;
+  struct nhw_ushm_ring *rx_ring;
+
   bool enabled; /* Has it been chosen for this instance in the command line (and not yet disconnected) */
   bool tx_on;
   bool rx_on;
   bool rx_low_dutyc_mode;
   bool disconnected;
 
+  uint proto; /* Protocol version used towards the other side */
+
   struct line_params tx_line_params;
 
+  char tx_buf[UFIFO_TX_BUF_SIZE];
+  size_t tx_buf_len;
+  ssize_t tx_nop_off; /* Offset in tx_buf of a NOP which is the last buffered message, or -1 */
+  bs_time_t tx_buf_since; /* Simulated time when something was first buffered, or TIME_NEVER */
+  struct ufifo_burst tx_burst; /* Burst being collected */
+
   char last_rx_msg[UFIFO_BIGGEST_MSG];
   bool last_rx_msg_pending; /* The message in last_rx_msg is between pre and post processing (1)
                                       or already processed (0) */
 
 
+  char rx_buf[UFIFO_RX_BUF_SIZE];
+  size_t rx_buf_pos;
+  size_t rx_buf_len;
+  struct ufifo_burst rx_burst; /* Burst being handed to the UART byte by byte */
+
   struct line_params rx_line_params;
   bool cts; /* CTS signal we are getting from other device (starts high => not clear) */
   uint16_t rx_byte;
@@ -109,15 +154,20 @@ struct ufifo_st_t ufifo_st[NHW_UARTE_TOTAL_INST];
 
 static bool uf_dont_terminate_on_disconnect;
 static double uf_mdt;
+static uint32_t uf_max_proto = UINT32_MAX;
 
 static void nhw_ufifo_update_timer(void);
 static void nhw_ufifo_create_fifos(uint inst, struct ufifo_st_t *u_el);
+static void nhw_ufifo_create_rings(uint inst, struct ufifo_st_t *u_el);
 static void nhw_ufifo_tx_byte(uint inst, uint16_t data);
 static void nhw_ufifo_RTS_pin_toggle(uint inst, bool new_level);
 static void nhw_ufifo_enable_notify(uint inst, uint8_t tx_enabled, uint8_t rx_enabled);
 static void uf_Rx_handle_old_input(uint inst, struct ufifo_st_t *u_el);
+static void tx_hello(struct ufifo_st_t *u_el);
+static void tx_flush_all(void);
 
 static void nhw_ufifo_backend_init(void) {
+  bool any_enabled = false;
 
   /* Let's make sure we ignore broken pipe signals even if we are not connected to a Phy*/
   signal(SIGPIPE, SIG_IGN);
@@ -138,10 +188,20 @@ static void nhw_ufifo_backend_init(void) {
 
     u_el->cts = true;
 
+    u_el->proto = 1; /* Until we hear otherwise from the other side */
+    u_el->tx_nop_off = -1;
+    u_el->tx_buf_since = TIME_NEVER;
+
     if (!u_el->enabled) {
       continue;
     }
-    nhw_ufifo_create_fifos(i, u_el);
+    any_enabled = true;
+    if (u_el->use_shm) {
+      nhw_ufifo_create_rings(i, u_el);
+    } else {
+      nhw_ufifo_create_fifos(i, u_el);
+    }
+    tx_hello(u_el);
 
     struct backend_if st;
     st.tx_byte_f = nhw_ufifo_tx_byte;
@@ -155,13 +215,26 @@ static void nhw_ufifo_backend_init(void) {
     u_el->Rx_timer = uf_mdt;
     u_el->rx_low_dutyc_mode = true;
   }
+  if (any_enabled) {
+    nhw_register_pre_block_hook(tx_flush_all);
+  }
   nhw_ufifo_update_timer();
 }
 
 NSI_TASK(nhw_ufifo_backend_init, HW_INIT, 100); /* this must be before the uart itself */
 
-static void write_to_tx_fifo(struct ufifo_st_t *u_el, void *ptr, size_t size) {
-  int res = write(u_el->fifo_tx, ptr, size);
+static bool uf_tx_is_open(struct ufifo_st_t *u_el) {
+  return (u_el->fifo_tx != -1) || (u_el->tx_ring != NULL);
+}
+
+static void tx_write_raw(struct ufifo_st_t *u_el, void *ptr, size_t size) {
+  int res;
+
+  if (u_el->use_shm) {
+    res = nhw_ushm_write(u_el->tx_ring, ptr, size);
+  } else {
+    res = write(u_el->fifo_tx, ptr, size);
+  }
 
   if (res != (int)size) {
     u_el->disconnected = true;
@@ -175,6 +248,141 @@ static void write_to_tx_fifo(struct ufifo_st_t *u_el, void *ptr, size_t size) {
   }
 }
 
+static void tx_flush_buf(struct ufifo_st_t *u_el) {
+  if (u_el->tx_buf_len > 0) {
+    tx_write_raw(u_el, u_el->tx_buf, u_el->tx_buf_len);
+    u_el->tx_buf_len = 0;
+  }
+  u_el->tx_nop_off = -1;
+  u_el->tx_buf_since = TIME_NEVER;
+}
+
+static void tx_mark_buffered(struct ufifo_st_t *u_el) {
+  if (u_el->tx_buf_since == TIME_NEVER) {
+    u_el->tx_buf_since = nsi_hws_get_time();
+  }
+}
+
+/*
+ * Append a message to the Tx buffer
+ *
+ * If the last buffered message is a NOP, and this message time is not earlier,
+ * that NOP is dropped, as this message will move the other side horizon at least as far.
+ */
+static void tx_buffer_msg(struct ufifo_st_t *u_el, void *ptr, size_t size) {
+  bs_time_t time = ((struct ufifo_msg_header *)ptr)->time;
+
+  if (u_el->tx_nop_off >= 0) {
+    struct ufifo_msg_header *nop = (struct ufifo_msg_header *)&u_el->tx_buf[u_el->tx_nop_off];
+    if (time >= nop->time) {
+      u_el->tx_buf_len = u_el->tx_nop_off;
+    }
+    u_el->tx_nop_off = -1;
+  }
+  if (u_el->tx_buf_len + size > UFIFO_TX_BUF_SIZE) {
+    tx_flush_buf(u_el);
+  }
+  memcpy(&u_el->tx_buf[u_el->tx_buf_len], ptr, size);
+  u_el->tx_buf_len += size;
+  tx_mark_buffered(u_el);
+}
+
+/*
+ * Move the burst being collected (if any) into the Tx buffer
+ */
+static void tx_burst_close(struct ufifo_st_t *u_el) {
+  struct ufifo_burst *burst = &u_el->tx_burst;
+  uint n = burst->n;
+
+  if (n == 0) {
+    return;
+  }
+  burst->n = 0;
+
+  if (n == 1) {
+    struct ufifo_msg_tx msg;
+    msg.header.time = burst->time;
+    msg.header.size = sizeof(msg);
+    msg.header.msg_type = ufifo_TX_BYTE;
+    msg.data = burst->data[0];
+    tx_buffer_msg(u_el, (void *)&msg, sizeof(msg));
+  } else {
+    char buf[sizeof(struct ufifo_msg_tx_burst) + UFIFO_MAX_BURST*sizeof(uint16_t)];
+    struct ufifo_msg_tx_burst *msg = (struct ufifo_msg_tx_burst *)buf;
+    size_t size = sizeof(struct ufifo_msg_tx_burst) + n*sizeof(uint16_t);
+
+    msg->header.time = burst->time;
+    msg->header.size = size;
+    msg->header.msg_type = ufifo_TX_BURST;
+    msg->period = burst->period;
+    msg->n = n;
+    memcpy(msg->data, burst->data, n*sizeof(uint16_t));
+    tx_buffer_msg(u_el, (void *)msg, size);
+  }
+}
+
+/*
+ * Add a byte to the burst being collected, starting a new burst if it does not fit in it
+ */
+static void tx_burst_add(struct ufifo_st_t *u_el, bs_time_t time, bs_time_t period, uint16_t data) {
+  struct ufifo_burst *burst = &u_el->tx_burst;
+
+  if ((burst->n > 0) &&
+      ((burst->n >= UFIFO_MAX_BURST) || (burst->period != period)
+       || (burst->time + burst->n*period != time))) {
+    tx_burst_close(u_el);
+  }
+  if (burst->n == 0) {
+    burst->time = time;
+    burst->period = period;
+  }
+  burst->data[burst->n++] = data;
+  tx_mark_buffered(u_el);
+}
+
+/*
+ * Send everything this instance has pending
+ */
+static void tx_flush(struct ufifo_st_t *u_el) {
+  tx_burst_close(u_el);
+  tx_flush_buf(u_el);
+}
+
+/*
+ * Send what this instance has pending if it has been buffered for too long
+ * (so the other side does not get our messages arbitrarily late even if we never block)
+ */
+static void tx_flush_if_old(struct ufifo_st_t *u_el) {
+  if ((u_el->tx_buf_since != TIME_NEVER)
+      && (nsi_hws_get_time() >= u_el->tx_buf_since + UFIFO_TX_MAX_BUF_TIME)) {
+    tx_flush(u_el);
+  }
+}
+
+/*
+ * Send everything all instances have pending
+ * (registered with nhw_register_pre_block_hook(), so it is called before this device may
+ * block waiting for another process)
+ */
+static void tx_flush_all(void) {
+  for (int i = 0; i < NHW_UARTE_TOTAL_INST; i++) {
+    struct ufifo_st_t *u_el = &ufifo_st[i];
+    if (uf_tx_is_open(u_el) && !u_el->disconnected) {
+      tx_flush(u_el);
+    }
+  }
+}
+
+static void write_to_tx_fifo(struct ufifo_st_t *u_el, void *ptr, size_t size) {
+  if (u_el->proto < 2) {
+    tx_write_raw(u_el, ptr, size);
+  } else {
+    tx_burst_close(u_el);
+    tx_buffer_msg(u_el, ptr, size);
+    tx_flush_if_old(u_el);
+  }
+}
+
 static void tx_set_next_tx_timer(struct ufifo_st_t *u_el, bs_time_t last_act) {
   u_el->Tx_timer = BS_MAX(last_act, u_el->Tx_timer);
   nhw_ufifo_update_timer();
@@ -201,10 +409,35 @@ static void tx_nop(struct ufifo_st_t *u_el, bs_time_t t) {
   msg.size = sizeof(msg);
   msg.msg_type = ufifo_NOP;
 
-  write_to_tx_fifo(u_el, (void *)&msg, sizeof(msg));
+  if (u_el->proto >= 2) {
+    tx_burst_close(u_el);
+    if (u_el->tx_nop_off >= 0) {
+      /* The previous NOP was not sent yet, we just move it forward */
+      ((struct ufifo_msg_header *)&u_el->tx_buf[u_el->tx_nop_off])->time = t;
+    } else {
+      tx_buffer_msg(u_el, (void *)&msg, sizeof(msg));
+      u_el->tx_nop_off = u_el->tx_buf_len - sizeof(msg);
+    }
+    tx_flush_if_old(u_el);
+  } else {
+    write_to_tx_fifo(u_el, (void *)&msg, sizeof(msg));
+  }
   tx_set_next_tx_timer(u_el, msg.time);
 }
 
+/*
+ * Tell the other side which protocol version we support.
+ * This is a NOP for devices which do not support the negotiation
+ */
+static void tx_hello(struct ufifo_st_t *u_el) {
+  struct ufifo_msg_header msg;
+  msg.time = 0;
+  msg.size = UFIFO_HELLO_MAGIC | uf_max_proto;
+  msg.msg_type = ufifo_NOP;
+
+  tx_write_raw(u_el, (void *)&msg, sizeof(msg));
+}
+
 static void tx_disconnect(struct ufifo_st_t *u_el) {
   struct ufifo_msg_header msg;
   msg.time = 0;
@@ -212,6 +445,7 @@ static void tx_disconnect(struct ufifo_st_t *u_el) {
   msg.msg_type = ufifo_DISCONNECT;
 
   write_to_tx_fifo(u_el, (void *)&msg, sizeof(msg));
+  tx_flush(u_el);
 }
 
 static void nhw_ufifo_tx_byte(uint inst, uint16_t data) {
@@ -226,14 +460,22 @@ static void nhw_ufifo_tx_byte(uint inst, uint16_t data) {
     tx_sync_line_params(inst, u_el);
   }
 
-  struct ufifo_msg_tx msg;
-  msg.header.time = nsi_hws_get_time() + nhw_uarte_one_byte_time(inst);
-  msg.header.size = sizeof(msg);
-  msg.header.msg_type = ufifo_TX_BYTE;
-  msg.data = data;
+  bs_time_t byte_time = nhw_uarte_one_byte_time(inst);
+  bs_time_t end_time = nsi_hws_get_time() + byte_time;
 
-  write_to_tx_fifo(u_el, (void *)&msg, sizeof(msg));
-  tx_set_next_tx_timer(u_el, msg.header.time);
+  if (u_el->proto >= 2) {
+    tx_burst_add(u_el, end_time, byte_time, data);
+    tx_flush_if_old(u_el);
+  } else {
+    struct ufifo_msg_tx msg;
+    msg.header.time = end_time;
+    msg.header.size = sizeof(msg);
+    msg.header.msg_type = ufifo_TX_BYTE;
+    msg.data = data;
+
+    write_to_tx_fifo(u_el, (void *)&msg, sizeof(msg));
+  }
+  tx_set_next_tx_timer(u_el, end_time);
 }
 
 static void nhw_ufifo_RTS_pin_toggle(uint inst, bool new_level) {
@@ -273,6 +515,8 @@ static void nhw_ufifo_enable_notify(uint inst, uint8_t tx_enabled, uint8_t rx_en
 }
 
 static void nhw_ufifo_update_timer(void) {
+  bs_time_t old_timer = Timer_UFIFO;
+
   Timer_UFIFO = TIME_NEVER;
   for (int i = 0; i < NHW_UARTE_TOTAL_INST; i++) {
     struct ufifo_st_t * u_el = &ufifo_st[i];
@@ -282,7 +526,7 @@ static void nhw_ufifo_update_timer(void) {
     bs_time_t smaller = BS_MIN(u_el->Rx_timer, u_el->Tx_timer);
     Timer_UFIFO = BS_MIN(Timer_UFIFO, smaller);
   }
-  nsi_hws_find_next_event();
+  nhw_hws_timer_updated(old_timer, Timer_UFIFO);
 }
 
 static void uf_propage_cts(uint inst, struct ufifo_st_t *u_el) {
@@ -293,26 +537,101 @@ static void uf_propage_cts(uint inst, struct ufifo_st_t *u_el) {
   }
 }
 
-static int uf_rx_lowlevel_read(struct ufifo_st_t *u_el, void *buf, size_t size) {
-  int ret = read(u_el->fifo_rx, buf, size);
-  if (ret != (int)size) {
-    u_el->disconnected = true;
-    if (ret == 0) {
-      bs_trace_error_time_line("UART: Other end disconnected unexpectedly\n");
+/*
+ * Ensure there is at least <size> bytes in the Rx buffer, blocking reading from the FIFO if needed
+ *
+ * With protocol version 1 we read just what is needed.
+ * Otherwise we read as much as is available.
+ * Before we may block, we let all backends send whatever they have pending
+ * (not only this one), as the other side may be waiting for it.
+ */
+static void uf_rx_fill(struct ufifo_st_t *u_el, size_t size) {
+  size_t avail = u_el->rx_buf_len - u_el->rx_buf_pos;
+
+  if (avail >= size) {
+    return;
+  }
+  memmove(u_el->rx_buf, &u_el->rx_buf[u_el->rx_buf_pos], avail);
+  u_el->rx_buf_pos = 0;
+  u_el->rx_buf_len = avail;
+
+  while (u_el->rx_buf_len < size) {
+    size_t req;
+    nhw_pre_block();
+    if (u_el->proto >= 2) {
+      req = UFIFO_RX_BUF_SIZE - u_el->rx_buf_len;
+    } else {
+      req = size - u_el->rx_buf_len;
+    }
+    int ret;
+    if (u_el->use_shm) {
+      ret = nhw_ushm_read(u_el->rx_ring, &u_el->rx_buf[u_el->rx_buf_len], req);
     } else {
-      bs_trace_error_time_line("UART: Read interrupted, or other unexpected error => terminating (%i, %s)\n",
-                               ret, strerror(errno));
+      ret = read(u_el->fifo_rx, &u_el->rx_buf[u_el->rx_buf_len], req);
     }
+    if (ret <= 0) {
+      u_el->disconnected = true;
+      if (ret == 0) {
+        bs_trace_error_time_line("UART: Other end disconnected unexpectedly\n");
+      } else {
+        bs_trace_error_time_line("UART: Read interrupted, or other unexpected error => terminating (%i, %s)\n",
+                                 ret, strerror(errno));
+      }
+    }
+    u_el->rx_buf_len += ret;
   }
-  return ret;
+}
+
+static void uf_rx_lowlevel_read(struct ufifo_st_t *u_el, void *buf, size_t size) {
+  uf_rx_fill(u_el, size);
+  memcpy(buf, &u_el->rx_buf[u_el->rx_buf_pos], size);
+  u_el->rx_buf_pos += size;
 }
 
 /*
- * Get one message from the Rx FIFO
+ * Place the next byte of the Rx burst in last_rx_msg as if it was a TX_BYTE message
+ */
+static void uf_rx_next_burst_byte(struct ufifo_st_t *u_el) {
+  struct ufifo_msg_tx *msg = (struct ufifo_msg_tx *)u_el->last_rx_msg;
+  struct ufifo_burst *burst = &u_el->rx_burst;
+
+  msg->header.time = burst->time + burst->idx*burst->period;
+  msg->header.size = sizeof(struct ufifo_msg_tx);
+  msg->header.msg_type = ufifo_TX_BYTE;
+  msg->data = burst->data[burst->idx++];
+  u_el->rx_byte = msg->data;
+}
+
+static void uf_rx_get_burst(struct ufifo_st_t *u_el) {
+  struct ufifo_msg_tx_burst *msg = (struct ufifo_msg_tx_burst *)u_el->last_rx_msg;
+  struct ufifo_burst *burst = &u_el->rx_burst;
+
+  uf_rx_lowlevel_read(u_el, (char *)msg + UFIFO_MSG_HEADER_SIZE, UFIFO_MSG_TX_BURST_BODY_SIZE);
+  if ((msg->n == 0) || (msg->n > UFIFO_MAX_BURST)
+      || (msg->header.size != sizeof(struct ufifo_msg_tx_burst) + msg->n*sizeof(uint16_t))) {
+    bs_trace_error_time_line("Corrupted stream\n");
+  }
+  burst->time = msg->header.time;
+  burst->period = msg->period;
+  burst->n = msg->n;
+  burst->idx = 0;
+  uf_rx_lowlevel_read(u_el, burst->data, burst->n*sizeof(uint16_t));
+  uf_rx_next_burst_byte(u_el);
+}
+
+static void uf_rx_hello(uint inst, struct ufifo_st_t *u_el, uint version) {
+  u_el->proto = BS_MIN(version, uf_max_proto);
+  bs_trace_raw_time(3, "UART%i: Other end supports FIFO protocol version %u, using %u\n",
+                    inst, version, u_el->proto);
+}
+
+/*
+ * Get one message from the Rx FIFO (or the next byte of a burst)
  * And for
- *   NOP: do nothing
+ *   NOP: do nothing (or if it is a HELLO, set the protocol version)
  *   MODE_CHANGE: update u_el->rx_line_params
  *   TX_BYTE: copy byte to u_el->rx_byte
+ *   TX_BURST: save it, and copy its first byte to u_el->rx_byte, as if it were a TX_BYTE
  *   RTS_CTS_TOGGLE: update u_el->cts
  *   DISCONNECT: Disconnect this FIFO instance (set timers in never, and disconnect from peripheral)
  *
@@ -321,6 +640,11 @@ static int uf_rx_lowlevel_read(struct ufifo_st_t *u_el, void *buf, size_t size)
 static int uf_rx_get_one_msg(uint inst, struct ufifo_st_t *u_el) {
   struct ufifo_msg_header *buf = (struct ufifo_msg_header *)u_el->last_rx_msg;
 
+  if (u_el->rx_burst.idx < u_el->rx_burst.n) {
+    uf_rx_next_burst_byte(u_el);
+    return buf->msg_type;
+  }
+
   uf_rx_lowlevel_read(u_el, (void *)buf, UFIFO_MSG_HEADER_SIZE);
 
   switch (buf->msg_type) {
@@ -350,7 +674,13 @@ static int uf_rx_get_one_msg(uint inst, struct ufifo_st_t *u_el) {
       uf_rx_lowlevel_read(u_el, (char *)buf + UFIFO_MSG_HEADER_SIZE, UFIFO_MSG_TXL_BODY_SIZE);
       u_el->rx_byte = ((struct ufifo_msg_tx *)buf)->data;
       break;
+    case ufifo_TX_BURST:
+      uf_rx_get_burst(u_el);
+      break;
     case ufifo_NOP:
+      if ((buf->size & ~UFIFO_HELLO_VERSION_MASK) == UFIFO_HELLO_MAGIC) {
+        uf_rx_hello(inst, u_el, buf->size & UFIFO_HELLO_VERSION_MASK);
+      }
       break;
     case ufifo_RTS_CTS_TOGGLE:
       uf_rx_lowlevel_read(u_el, (char *)buf + UFIFO_MSG_HEADER_SIZE, UFIFO_MSG_RTS_CTS_BODY_SIZE);
@@ -512,6 +842,7 @@ static void nhw_ufifo_handle_RxTimer(int inst, struct ufifo_st_t *u_el) {
     u_el->rx_low_dutyc_mode = true;
     u_el->Rx_timer = nsi_hws_get_time() + uf_mdt;
     nhw_ufifo_update_timer();
+    tx_flush(u_el);
   }
 }
 
@@ -524,6 +855,10 @@ static void nhw_ufifo_handle_TxTimer(int inst, struct ufifo_st_t *u_el) {
   u_el->Tx_timer = t;
 
   tx_nop(u_el, t);
+  if (u_el->rx_low_dutyc_mode) {
+    /* We won't be reading (and therefore flushing) for a while, so let's not hold the other side */
+    tx_flush(u_el);
+  }
 }
 
 static void nhw_ufifo_timer_triggered(void) {
@@ -540,7 +875,7 @@ static void nhw_ufifo_timer_triggered(void) {
   nhw_ufifo_update_timer();
 }
 
-NSI_HW_EVENT(Timer_UFIFO, nhw_ufifo_timer_triggered, 900); /* Let's let as many timers as possible evaluate before this one */
+NHW_HW_EVENT(Timer_UFIFO, nhw_ufifo_timer_triggered, 900); /* Let's let as many timers as possible evaluate before this one */
 
 static void uf_parse_mdt(char *argv, int offset) {
   (void) offset;
@@ -549,31 +884,49 @@ static void uf_parse_mdt(char *argv, int offset) {
   }
 }
 
+static void uf_parse_proto(char *argv, int offset) {
+  (void) offset;
+  if (uf_max_proto < 1 || uf_max_proto > UFIFO_PROTOCOL_VERSION) {
+    bs_trace_error_line("uart_fifob_protocol must be set to a value between 1 and %i (%s)\n",
+                        UFIFO_PROTOCOL_VERSION, argv);
+  }
+}
+
 static void nhw_ufifo_backend_register_cmdline(void) {
-  static bs_args_struct_t args2[2*NHW_UARTE_TOTAL_INST + 1 /* End marker */];
+  static bs_args_struct_t args2[3*NHW_UARTE_TOTAL_INST + 1 /* End marker */];
   static char descr_tx[] = "Path to the FIFO to be used for Tx (it will be created automatically). "
                            "Remember to cross them between devices. "
                            "Setting this option enables the FIFO backend for this UART";
   static char descr_rx[] = "Path to the FIFO to be used for Rx (it will be created automatically)";
+  static char descr_shm[] = "Use shared memory ring buffers instead of FIFOs as transport. "
+                            "The txfile and rxfile paths are then used for the files backing "
+                            "the rings (place them in /dev/shm/). Both devices must select it";
 #define OPTION_LEN (4 + 2 + 13 + 1)
-  static char options[NHW_UARTE_TOTAL_INST][2][OPTION_LEN];
+  static char options[NHW_UARTE_TOTAL_INST][3][OPTION_LEN];
   static char opt_name[]= "path";
 
   for (int i = 0 ; i < NHW_UARTE_TOTAL_INST; i++) {
     snprintf(options[i][0], OPTION_LEN, "uart%i_fifob_txfile", i);
     snprintf(options[i][1], OPTION_LEN, "uart%i_fifob_rxfile", i);
-
-    args2[2*i].option = options[i][0];
-    args2[2*i].name = opt_name;
-    args2[2*i].type = 's';
-    args2[2*i].dest = &ufifo_st[i].fifo_Tx_path;
-    args2[2*i].descript = descr_tx;
-
-    args2[2*i + 1].option = options[i][1];
-    args2[2*i + 1].name = opt_name;
-    args2[2*i + 1].type = 's';
-    args2[2*i + 1].dest = &ufifo_st[i].fifo_Rx_path;
-    args2[2*i + 1].descript = descr_rx;
+    snprintf(options[i][2], OPTION_LEN, "uart%i_fifob_shm", i);
+
+    args2[3*i].option = options[i][0];
+    args2[3*i].name = opt_name;
+    args2[3*i].type = 's';
+    args2[3*i].dest = &ufifo_st[i].fifo_Tx_path;
+    args2[3*i].descript = descr_tx;
+
+    args2[3*i + 1].option = options[i][1];
+    args2[3*i + 1].name = opt_name;
+    args2[3*i + 1].type = 's';
+    args2[3*i + 1].dest = &ufifo_st[i].fifo_Rx_path;
+    args2[3*i + 1].descript = descr_rx;
+
+    args2[3*i + 2].is_switch = true;
+    args2[3*i + 2].option = options[i][2];
+    args2[3*i + 2].type = 'b';
+    args2[3*i + 2].dest = &ufifo_st[i].use_shm;
+    args2[3*i + 2].descript = descr_shm;
   }
 
   bs_add_extra_dynargs(args2);
@@ -598,6 +951,15 @@ static void nhw_ufifo_backend_register_cmdline(void) {
                   "(This only makes sense if you have registered a short or a PPI event in the CTS signal "
                   "events). The smaller the value the greater the overhead."
     },
+    { .option = "uart_fifob_protocol",
+      .name = "version",
+      .type = 'u',
+      .call_when_found = uf_parse_proto,
+      .dest = (void *)&uf_max_proto,
+      .descript = "(By default the newest) Highest protocol version the FIFO backend will use. "
+                  "The version actually used is the highest both sides support. "
+                  "Set to 1 to disable the batching of bytes and buffering of messages"
+    },
     ARG_TABLE_ENDMARKER
   };
 
@@ -625,6 +987,9 @@ static void nhw_ufifo_backend_post_cmdline(void) {
   if (isnan(uf_mdt)) {
     uf_mdt = 10000;
   }
+  if (uf_max_proto == UINT32_MAX) {
+    uf_max_proto = UFIFO_PROTOCOL_VERSION;
+  }
 }
 
 NSI_TASK(nhw_ufifo_backend_post_cmdline, PRE_BOOT_2, 200);
@@ -675,10 +1040,38 @@ static void nhw_ufifo_create_fifos(uint inst, struct ufifo_st_t *u_el) {
 
 }
 
+/*
+ * Create our Tx shared memory ring, attach to the one the other device creates for our Rx,
+ * and wait until the other side has attached to ours.
+ */
+static void nhw_ufifo_create_rings(uint inst, struct ufifo_st_t *u_el) {
+  bs_trace_raw_time(9, "Creating UART%i backend shared memory rings\n", inst);
+
+  bs_create_folders_in_path(u_el->fifo_Tx_path);
+  bs_create_folders_in_path(u_el->fifo_Rx_path);
+
+  u_el->tx_ring = nhw_ushm_create_tx(u_el->fifo_Tx_path);
+  u_el->rx_ring = nhw_ushm_attach_rx(u_el->fifo_Rx_path);
+  nhw_ushm_wait_for_reader(u_el->tx_ring, u_el->fifo_Tx_path);
+}
+
 static void nhw_ufifo_backend_cleanup(void) {
   bs_trace_raw_time(9, "Cleaning up UART backend FIFOs\n");
   for (int i = 0; i < NHW_UARTE_TOTAL_INST; i++) {
     struct ufifo_st_t *u_el = &ufifo_st[i];
+    if ((u_el->fifo_Tx_path) && (u_el->tx_ring != NULL)) {
+      if (!u_el->disconnected) {
+        tx_disconnect(u_el);
+      }
+      nhw_ushm_close(u_el->tx_ring, u_el->fifo_Tx_path);
+      u_el->tx_ring = NULL;
+      u_el->fifo_Tx_path = NULL;
+    }
+    if ((u_el->fifo_Rx_path) && (u_el->rx_ring != NULL)) {
+      nhw_ushm_close(u_el->rx_ring, u_el->fifo_Rx_path);
+      u_el->rx_ring = NULL;
+      u_el->fifo_Rx_path = NULL;
+    }
     if ((u_el->fifo_Tx_path) && (u_el->fifo_tx != -1)) {
       if (!u_el->disconnected) {
         tx_disconnect(u_el);
@@ -39,11 +39,30 @@ extern "C"{
  *
  *    <uint64_t time> DISCONNECT <msg_size>
  *          The other side is disconnecting gracefully
+ *
+ *   Protocol version negotiation:
+ *    Right after both FIFOs are open, each side sends a HELLO, which is a NOP with time 0
+ *    and a msg_size of UFIFO_HELLO_MAGIC | <version>. Each side then uses the smallest of
+ *    both versions. A device which does not send a HELLO is a version 1 device
+ *    (and for those the HELLO is just a NOP they ignore).
+ *
+ *   Version 2 adds:
+ *    <uint64_t time> TX_BURST <msg_size>
+ *          <uint32_t period> <uint16_t n> <uint16_t data[n]>
+ *          (time is when the first frame ends, frame i ends at time + i*period)
+ *
+ *    And in version 2 consecutive NOPs may be coalesced, so only the last one is sent,
+ *    and messages are buffered, and only sent before the device blocks waiting for input.
  */
 
+#define UFIFO_PROTOCOL_VERSION 2
+#define UFIFO_HELLO_MAGIC 0xF000
+#define UFIFO_HELLO_VERSION_MASK 0x0FFF
+
 struct ufifo_msg_header {
   bs_time_t time;
-  enum {ufifo_NOP=0, ufifo_MODE_CHANGE, ufifo_TX_BYTE, ufifo_RTS_CTS_TOGGLE, ufifo_DISCONNECT} msg_type;
+  enum {ufifo_NOP=0, ufifo_MODE_CHANGE, ufifo_TX_BYTE, ufifo_RTS_CTS_TOGGLE, ufifo_DISCONNECT,
+        ufifo_TX_BURST} msg_type;
   uint16_t size;
 } __attribute__ ((packed));
 
@@ -63,10 +82,20 @@ struct ufifo_msg_mode_change {
   uint32_t config;
 } __attribute__ ((packed));
 
+struct ufifo_msg_tx_burst {
+  struct ufifo_msg_header header;
+  uint32_t period;
+  uint16_t n;
+  uint16_t data[];
+} __attribute__ ((packed));
+
+#define UFIFO_MAX_BURST 64
+
 #define UFIFO_MSG_HEADER_SIZE (sizeof(struct ufifo_msg_header))
 #define UFIFO_MSG_TXL_BODY_SIZE (sizeof(struct ufifo_msg_tx) - sizeof(struct ufifo_msg_header))
 #define UFIFO_MSG_RTS_CTS_BODY_SIZE (sizeof(struct ufifo_msg_rts_cts) - sizeof(struct ufifo_msg_header))
 #define UFIFO_MSG_MODE_CHANGE_BODY_SIZE (sizeof(struct ufifo_msg_mode_change) - sizeof(struct ufifo_msg_header))
+#define UFIFO_MSG_TX_BURST_BODY_SIZE (sizeof(struct ufifo_msg_tx_burst) - sizeof(struct ufifo_msg_header))
 
 #define UFIFO_BIGGEST_MSG (sizeof(struct ufifo_msg_mode_change))
 
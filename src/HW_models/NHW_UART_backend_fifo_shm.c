@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Shared memory transport for the UART FIFO backend (also used by the GPIO bus backend)
+ *
+ * Instead of a FIFO, each direction of the link is a lock-free single producer/single consumer
+ * ring buffer in a shared memory file (which should be in a tmpfs like /dev/shm/).
+ * So, as long as the ring is neither empty nor full, sending or receiving does not require
+ * any syscall.
+ * When the ring is empty (full) the reader (writer) waits on a futex until the other side
+ * moves the ring head (tail).
+ *
+ * The writer side creates the ring (replacing any stale one), and the reader attaches to it.
+ * Once both are attached, the writer removes the file (the mapping stays valid for both),
+ * so it is not left behind, and the reader cannot remove a ring created by a later run.
+ * nhw_ushm_write() and nhw_ushm_read() behave like write() and read() on a blocking pipe.
+ */
+
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE /* For syscall() */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "bs_types.h"
+#include "bs_tracing.h"
+#include "NHW_UART_backend_fifo_shm.h"
+
+#define USHM_MAGIC 0x4D485355
+#define USHM_RING_SIZE (1024*1024) /* Must be a power of 2 */
+#define USHM_SPIN 200 /* Times we check the ring before waiting in the futex */
+#define USHM_WAIT_TIMEOUT_MS 500 /* How often we check if the other side is still alive while waiting */
+#define USHM_POLL_PERIOD_NS 1000000 /* While waiting for the other side to connect */
+
+struct nhw_ushm_ring {
+  uint32_t magic;
+  uint32_t size;
+  int32_t writer_pid;
+  int32_t reader_pid;
+  uint32_t closed; /* Set by either side when it disconnects */
+
+  uint32_t head __attribute__((aligned(64))); /* Bytes written so far (only written by the writer) */
+  uint32_t reader_waiting;
+
+  uint32_t tail __attribute__((aligned(64))); /* Bytes read so far (only written by the reader) */
+  uint32_t writer_waiting;
+
+  char data[] __attribute__((aligned(64)));
+};
+
+#define USHM_FILE_SIZE (sizeof(struct nhw_ushm_ring) + USHM_RING_SIZE)
+
+static void ushm_sleep_poll_period(void) {
+  struct timespec ts = {0, USHM_POLL_PERIOD_NS};
+  (void)nanosleep(&ts, NULL);
+}
+
+static bool ushm_pid_alive(int32_t pid) {
+  return (pid > 0) && ((kill(pid, 0) == 0) || (errno == EPERM));
+}
+
+/*
+ * Wait until the value in <addr> is not <val> anymore.
+ *
+ * Returns 0 if it changed, or -1 if the other side disconnected (or died) in the meanwhile
+ */
+static int ushm_wait(struct nhw_ushm_ring *ring, uint32_t *addr, uint32_t val,
+                     uint32_t *waiting, int32_t peer_pid) {
+  struct timespec ts = {USHM_WAIT_TIMEOUT_MS / 1000, (USHM_WAIT_TIMEOUT_MS % 1000) * 1000000};
+  int ret = 0;
+
+  for (int i = 0; i < USHM_SPIN; i++) {
+    if (__atomic_load_n(addr, __ATOMIC_ACQUIRE) != val) {
+      return 0;
+    }
+  }
+
+  while (true) {
+    /* Note the other side checks *waiting after updating *addr (and we in the opposite order) */
+    __atomic_store_n(waiting, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(addr, __ATOMIC_SEQ_CST) != val) {
+      break;
+    }
+    if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE)) {
+      ret = -1;
+      break;
+    }
+    if ((syscall(SYS_futex, addr, FUTEX_WAIT, val, &ts, NULL, 0) == -1)
+        && (errno == ETIMEDOUT) && !ushm_pid_alive(peer_pid)) {
+      ret = -1;
+      break;
+    }
+  }
+  __atomic_store_n(waiting, 0, __ATOMIC_RELAXED);
+  return ret;
+}
+
+static void ushm_wake(uint32_t *addr, uint32_t *waiting) {
+  if (__atomic_load_n(waiting, __ATOMIC_SEQ_CST)) {
+    (void)syscall(SYS_futex, addr, FUTEX_WAKE, 1, NULL, NULL, 0);
+  }
+}
+
+static struct nhw_ushm_ring *ushm_map(int fd, const char *path) {
+  void *ptr = mmap(NULL, USHM_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (ptr == MAP_FAILED) {
+    bs_trace_error_line("Couldn't map shared memory ring %s (%i, %s)\n",
+                        path, errno, strerror(errno));
+  }
+  return (struct nhw_ushm_ring *)ptr;
+}
+
+/*
+ * Create a new (empty) ring in <path> for us to write into,
+ * replacing any possible stale one left by a previous run
+ */
+struct nhw_ushm_ring *nhw_ushm_create_tx(const char *path) {
+  char tmp_path[strlen(path) + 16];
+  struct nhw_ushm_ring *ring;
+  int fd;
+
+  snprintf(tmp_path, sizeof(tmp_path), "%s.%i", path, (int)getpid());
+
+  fd = open(tmp_path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd == -1) {
+    bs_trace_error_line("Couldn't create shared memory ring %s (%i, %s)\n",
+                        tmp_path, errno, strerror(errno));
+  }
+  if (ftruncate(fd, USHM_FILE_SIZE) != 0) {
+    bs_trace_error_line("Couldn't size shared memory ring %s (%i, %s)\n",
+                        tmp_path, errno, strerror(errno));
+  }
+  ring = ushm_map(fd, tmp_path);
+  (void)close(fd);
+
+  ring->size = USHM_RING_SIZE;
+  ring->writer_pid = getpid();
+  __atomic_store_n(&ring->magic, USHM_MAGIC, __ATOMIC_RELEASE);
+
+  if (rename(tmp_path, path) != 0) {
+    bs_trace_error_line("Couldn't create shared memory ring %s (%i, %s)\n",
+                        path, errno, strerror(errno));
+  }
+  return ring;
+}
+
+/*
+ * Attach as reader to the ring in <path>,
+ * waiting until the other side has created it if needed
+ */
+struct nhw_ushm_ring *nhw_ushm_attach_rx(const char *path) {
+  bool reported = false;
+
+  while (true) {
+    int fd = open(path, O_RDWR);
+
+    if (fd != -1) {
+      struct stat st;
+      struct nhw_ushm_ring *ring = NULL;
+
+      if ((fstat(fd, &st) != 0) || !S_ISREG(st.st_mode)) {
+        bs_trace_error_line("%s is not a shared memory ring "
+                            "(is the other side using the FIFO transport?)\n", path);
+      }
+      if (st.st_size == USHM_FILE_SIZE) {
+        int32_t no_reader = 0;
+
+        ring = ushm_map(fd, path);
+        if ((__atomic_load_n(&ring->magic, __ATOMIC_ACQUIRE) != USHM_MAGIC)
+            || !ushm_pid_alive(ring->writer_pid)
+            || !__atomic_compare_exchange_n(&ring->reader_pid, &no_reader, getpid(),
+                                            false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+          /* Stale ring from a previous run, or not yet initialized */
+          (void)munmap(ring, USHM_FILE_SIZE);
+          ring = NULL;
+        }
+      }
+      (void)close(fd);
+      if (ring) {
+        return ring;
+      }
+    }
+    if (!reported) {
+      bs_trace_raw_time(3, "Waiting for the other side to create the shared memory ring %s\n",
+                        path);
+      reported = true;
+    }
+    ushm_sleep_poll_period();
+  }
+}
+
+/*
+ * Wait until the other side has attached as reader to our Tx ring,
+ * and remove the ring file, as it is not needed anymore
+ */
+void nhw_ushm_wait_for_reader(struct nhw_ushm_ring *ring, const char *path) {
+  if (__atomic_load_n(&ring->reader_pid, __ATOMIC_ACQUIRE) == 0) {
+    bs_trace_raw_time(3, "Waiting for the other side to attach to the shared memory ring %s\n",
+                      path);
+  }
+  while (__atomic_load_n(&ring->reader_pid, __ATOMIC_ACQUIRE) == 0) {
+    ushm_sleep_poll_period();
+  }
+  (void)remove(path);
+}
+
+/*
+ * Write <size> bytes into the ring, blocking while it is full
+ *
+ * Returns <size> or -1 (with errno = EPIPE) if the reader disconnected
+ */
+int nhw_ushm_write(struct nhw_ushm_ring *ring, const void *buf, size_t size) {
+  const char *src = (const char *)buf;
+  uint32_t head = ring->head;
+  size_t left = size;
+
+  while (left > 0) {
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint32_t space = ring->size - (head - tail);
+
+    if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE)) {
+      errno = EPIPE;
+      return -1;
+    }
+    if (space == 0) {
+      if (ushm_wait(ring, &ring->tail, tail, &ring->writer_waiting, ring->reader_pid) != 0) {
+        errno = EPIPE;
+        return -1;
+      }
+      continue;
+    }
+
+    uint32_t chunk = BS_MIN(left, space);
+    uint32_t offset = head & (ring->size - 1);
+    uint32_t first = BS_MIN(chunk, ring->size - offset);
+
+    memcpy(&ring->data[offset], src, first);
+    memcpy(ring->data, src + first, chunk - first);
+    head += chunk;
+    src += chunk;
+    left -= chunk;
+
+    __atomic_store_n(&ring->head, head, __ATOMIC_SEQ_CST);
+    ushm_wake(&ring->head, &ring->reader_waiting);
+  }
+  return size;
+}
+
+/*
+ * Read up to <size> bytes from the ring, blocking until there is at least 1
+ *
+ * Returns the number of bytes read, or 0 if the writer disconnected and the ring is empty
+ */
+int nhw_ushm_read(struct nhw_ushm_ring *ring, void *buf, size_t size) {
+  uint32_t tail = ring->tail;
+  uint32_t head;
+
+  while ((head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE)) == tail) {
+    if (ushm_wait(ring, &ring->head, tail, &ring->reader_waiting, ring->writer_pid) != 0) {
+      return 0;
+    }
+  }
+
+  uint32_t chunk = BS_MIN(size, head - tail);
+  uint32_t offset = tail & (ring->size - 1);
+  uint32_t first = BS_MIN(chunk, ring->size - offset);
+
+  memcpy(buf, &ring->data[offset], first);
+  memcpy((char *)buf + first, ring->data, chunk - first);
+
+  __atomic_store_n(&ring->tail, tail + chunk, __ATOMIC_SEQ_CST);
+  ushm_wake(&ring->tail, &ring->writer_waiting);
+
+  return chunk;
+}
+
+void nhw_ushm_close(struct nhw_ushm_ring *ring, const char *path) {
+  /* If we created the ring, but the reader never attached, the file is still there */
+  bool rm_file = (ring->writer_pid == getpid())
+                 && (__atomic_load_n(&ring->reader_pid, __ATOMIC_ACQUIRE) == 0);
+
+  __atomic_store_n(&ring->closed, 1, __ATOMIC_SEQ_CST);
+  (void)syscall(SYS_futex, &ring->head, FUTEX_WAKE, 1, NULL, NULL, 0);
+  (void)syscall(SYS_futex, &ring->tail, FUTEX_WAKE, 1, NULL, NULL, 0);
+  (void)munmap(ring, USHM_FILE_SIZE);
+  if (rm_file) {
+    (void)remove(path);
+  }
+}
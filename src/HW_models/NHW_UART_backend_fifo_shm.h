@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef _NRF_HW_MODEL_UART_BACKEND_FIFO_SHM_H
+#define _NRF_HW_MODEL_UART_BACKEND_FIFO_SHM_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+struct nhw_ushm_ring;
+
+struct nhw_ushm_ring *nhw_ushm_create_tx(const char *path);
+struct nhw_ushm_ring *nhw_ushm_attach_rx(const char *path);
+void nhw_ushm_wait_for_reader(struct nhw_ushm_ring *ring, const char *path);
+int nhw_ushm_write(struct nhw_ushm_ring *ring, const void *buf, size_t size);
+int nhw_ushm_read(struct nhw_ushm_ring *ring, void *buf, size_t size);
+void nhw_ushm_close(struct nhw_ushm_ring *ring, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NRF_HW_MODEL_UART_BACKEND_FIFO_SHM_H */
@@ -14,6 +14,10 @@
  * periodically
  * While receiving, it will receive at max the configured UART baudrate.
  *
+ * With uart_pty_input_thread, instead of doing a read() syscall each polling period,
+ * a helper thread monitors the PTYs and reads their input in bulk into a buffer,
+ * so that polling is just checking that buffer.
+ *
  * The other side CTS is always assumed enabled(clear to send)
  *
  * When the (own) RTS pin is raised (not ready to receive), and if the command line
@@ -34,12 +38,14 @@
 #include "nsi_hw_scheduler.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 static bs_time_t Timer_UPTY = TIME_NEVER;
 
 #define DEFAULT_CMD "xterm -e screen %s &"
 
 static bool wait_for_pty;
+static bool input_thread;
 static bs_time_t poll_period = 50000;
 
 struct upty_st_t {
@@ -50,6 +56,7 @@ struct upty_st_t {
 
   int out_fd; /* File descriptor used for output */
   int in_fd; /* File descriptor used for input */
+  struct nhw_upty_ring *in_ring; /* Input buffer (if input_thread) */
 
   bs_time_t Rx_timer;
 
@@ -93,6 +100,9 @@ static void nhw_upty_init(void) {
     int pty_fd = nhw_upty_open_ptty(uart_name, u_el->attach_cmd, u_el->auto_attach, wait_for_pty);
     u_el->in_fd = pty_fd;
     u_el->out_fd = pty_fd;
+    if (input_thread) {
+      u_el->in_ring = nhw_upty_monitor_add(pty_fd);
+    }
 
     struct backend_if st;
     st.tx_byte_f = nhw_upty_tx_byte;
@@ -105,6 +115,9 @@ static void nhw_upty_init(void) {
       u_el->Rx_timer = poll_period;
     }
   }
+  if (input_thread) {
+    nhw_upty_monitor_start();
+  }
   nhw_upty_update_timer();
 }
 
@@ -179,8 +192,12 @@ static void nhw_upty_check_for_input(uint inst, struct upty_st_t *u_el) {
     u_el->pty_connected = true;
   }
 
-  ret = read(u_el->in_fd, &byte, 1);
-  if (ret != -1) {
+  if (u_el->in_ring != NULL) {
+    ret = nhw_upty_ring_read(u_el->in_ring, &byte, 1);
+  } else {
+    ret = read(u_el->in_fd, &byte, 1);
+  }
+  if (ret == 1) {
     if (!u_el->rx_on) {
       bs_trace_info_time(3, "UART%i: Received byte (0x%02X) while Rx is off => ignored\n", inst, byte);
     } else {
@@ -204,12 +221,16 @@ static void nhw_upty_timer_triggered(void) {
   nhw_upty_update_timer();
 }
 
-NSI_HW_EVENT(Timer_UPTY, nhw_upty_timer_triggered, 900); /* Let's let as many timers as possible evaluate before this one */
+NHW_HW_EVENT(Timer_UPTY, nhw_upty_timer_triggered, 900); /* Let's let as many timers as possible evaluate before this one */
 
 static void nhw_upty_cleanup(void) {
+  nhw_upty_monitor_stop();
+
   for (int i = 0; i < NHW_UARTE_TOTAL_INST; i++) {
     struct upty_st_t *u_el = &upty_st[i];
 
+    u_el->in_ring = NULL;
+
     if (u_el->in_fd != -1) {
       close(u_el->in_fd);
       u_el->in_fd = -1;
@@ -286,6 +307,13 @@ static void nhw_upty_backend_register_cmdline(void) {
           .dest = (void *)&wait_for_pty,
           .descript = "Hold writes to the uart/pts (and therefore the simulation) until a client is connected/ready"
       },
+      { .is_switch = true,
+          .option = "uart_pty_input_thread",
+          .type = 'b',
+          .dest = (void *)&input_thread,
+          .descript = "Monitor the pseudoterminals for input from a helper thread which reads it in bulk "
+                      "into a buffer, so polling for input does not require a syscall"
+      },
       { .option = "uart_pty_pollT",
           .type = 'd',
           .name = "period",
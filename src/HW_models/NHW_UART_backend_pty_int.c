@@ -27,7 +27,11 @@
 #include <sys/select.h>
 #include <unistd.h>
 #include <poll.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <nsi_tracing.h>
+#include "NHW_UART_backend_pty_int.h"
 
 #define ERROR nsi_print_error_and_exit
 #define WARN nsi_print_warning
@@ -211,3 +215,220 @@ void nhw_upty_wait_for_pty(int fd, uint64_t microsec) {
     (void)nanosleep(&tv, NULL);
   }
 }
+
+/*
+ * Input monitor
+ *
+ * A helper thread waits (with epoll) for input in the PTYs, and reads it in bulk into a
+ * (single producer/single consumer) ring buffer per PTY, from which the simulation thread can
+ * take it without any syscall.
+ *
+ * When a ring is full, its PTY is not monitored until the simulation thread has taken
+ * some data from it.
+ * When a PTY has nothing connected to its slave side (HUP), it is monitored again only after
+ * NHW_UPTY_HUP_RETRY_MS
+ */
+
+#define NHW_UPTY_RING_SIZE 4096 /* Must be a power of 2 */
+#define NHW_UPTY_HUP_RETRY_MS 10
+#define NHW_UPTY_MAX_EVENTS 8
+
+struct nhw_upty_ring {
+  int fd;
+  uint32_t head; /* Bytes written so far (by the monitor thread) */
+  uint32_t tail; /* Bytes read so far (by the simulation thread) */
+  uint32_t stalled; /* The ring got full and the fd was not re-armed in the epoll */
+  bool hup; /* (monitor thread only) Waiting to re-arm after a HUP */
+  unsigned char data[NHW_UPTY_RING_SIZE];
+};
+
+static struct {
+  int epoll_fd;
+  int stop_fd;
+  pthread_t thread;
+  bool running;
+  int n_rings;
+  struct nhw_upty_ring **rings;
+} upty_mon = {.epoll_fd = -1, .stop_fd = -1};
+
+static void upty_mon_arm(struct nhw_upty_ring *ring, int op) {
+  struct epoll_event ev = {.events = EPOLLIN | EPOLLONESHOT, .data.ptr = ring};
+
+  if (epoll_ctl(upty_mon.epoll_fd, op, ring->fd, &ev) == -1) {
+    ERROR("%s: epoll_ctl failed (%i,%s)\n", __func__, errno, strerror(errno));
+  }
+}
+
+static uint32_t upty_ring_space(struct nhw_upty_ring *ring) {
+  return NHW_UPTY_RING_SIZE - (ring->head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE));
+}
+
+/*
+ * Read from the PTY into the ring as much as available and fits
+ * Returns true if we should keep monitoring this PTY right away
+ */
+static bool upty_ring_fill(struct nhw_upty_ring *ring) {
+  uint32_t space;
+
+  while ((space = upty_ring_space(ring)) > 0) {
+    uint32_t offset = ring->head & (NHW_UPTY_RING_SIZE - 1);
+    uint32_t size = NHW_UPTY_RING_SIZE - offset;
+
+    if (size > space) {
+      size = space;
+    }
+    int ret = read(ring->fd, &ring->data[offset], size);
+
+    if (ret > 0) {
+      __atomic_store_n(&ring->head, ring->head + ret, __ATOMIC_RELEASE);
+      continue;
+    }
+    if ((ret == -1) && ((errno == EAGAIN) || (errno == EINTR))) {
+      return true;
+    }
+    /* EIO (or EOF): Nothing connected to the slave side */
+    ring->hup = true;
+    return false;
+  }
+
+  /* The ring is full: the simulation thread will re-arm it after taking some data */
+  __atomic_store_n(&ring->stalled, 1, __ATOMIC_SEQ_CST);
+  if (upty_ring_space(ring) > 0) {
+    uint32_t expected = 1;
+    /* Unless it took it already in the meanwhile */
+    return __atomic_compare_exchange_n(&ring->stalled, &expected, 0, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  }
+  return false;
+}
+
+static void *upty_mon_thread(void *arg) {
+  (void) arg;
+  struct epoll_event events[NHW_UPTY_MAX_EVENTS];
+  bool any_hup = false;
+
+  while (true) {
+    int n = epoll_wait(upty_mon.epoll_fd, events, NHW_UPTY_MAX_EVENTS,
+                       any_hup ? NHW_UPTY_HUP_RETRY_MS : -1);
+    if (n == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      ERROR("%s: epoll_wait failed (%i,%s)\n", __func__, errno, strerror(errno));
+    }
+    if (n == 0) {
+      for (int i = 0; i < upty_mon.n_rings; i++) {
+        struct nhw_upty_ring *ring = upty_mon.rings[i];
+        if (ring->hup) {
+          ring->hup = false;
+          upty_mon_arm(ring, EPOLL_CTL_MOD);
+        }
+      }
+      any_hup = false;
+      continue;
+    }
+    for (int i = 0; i < n; i++) {
+      struct nhw_upty_ring *ring = (struct nhw_upty_ring *)events[i].data.ptr;
+
+      if (ring == NULL) { /* Stop request */
+        return NULL;
+      }
+      if (upty_ring_fill(ring)) {
+        upty_mon_arm(ring, EPOLL_CTL_MOD);
+      }
+      any_hup |= ring->hup;
+    }
+  }
+  return NULL;
+}
+
+/*
+ * Register a PTY (master side file descriptor) to be monitored for input
+ * (before nhw_upty_monitor_start())
+ * Returns the ring buffer the input will be placed in
+ */
+struct nhw_upty_ring *nhw_upty_monitor_add(int fd) {
+  struct nhw_upty_ring *ring = calloc(1, sizeof(struct nhw_upty_ring));
+
+  upty_mon.rings = realloc(upty_mon.rings, (upty_mon.n_rings + 1) * sizeof(void *));
+  if ((ring == NULL) || (upty_mon.rings == NULL)) {
+    ERROR("%s: Out of memory\n", __func__);
+  }
+  ring->fd = fd;
+  upty_mon.rings[upty_mon.n_rings++] = ring;
+  return ring;
+}
+
+void nhw_upty_monitor_start(void) {
+  struct epoll_event ev = {.events = EPOLLIN, .data.ptr = NULL};
+
+  if (upty_mon.n_rings == 0) {
+    return;
+  }
+  upty_mon.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  upty_mon.stop_fd = eventfd(0, EFD_CLOEXEC);
+  if ((upty_mon.epoll_fd == -1) || (upty_mon.stop_fd == -1)) {
+    ERROR("%s: Could not create the PTY input monitor (%i,%s)\n",
+          __func__, errno, strerror(errno));
+  }
+  if (epoll_ctl(upty_mon.epoll_fd, EPOLL_CTL_ADD, upty_mon.stop_fd, &ev) == -1) {
+    ERROR("%s: epoll_ctl failed (%i,%s)\n", __func__, errno, strerror(errno));
+  }
+  for (int i = 0; i < upty_mon.n_rings; i++) {
+    upty_mon_arm(upty_mon.rings[i], EPOLL_CTL_ADD);
+  }
+  if (pthread_create(&upty_mon.thread, NULL, upty_mon_thread, NULL) != 0) {
+    ERROR("%s: Could not create the PTY input monitor thread\n", __func__);
+  }
+  upty_mon.running = true;
+}
+
+/*
+ * Take up to <size> bytes of input from the ring (without blocking)
+ * Returns the number of bytes taken
+ */
+int nhw_upty_ring_read(struct nhw_upty_ring *ring, unsigned char *buf, size_t size) {
+  uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+  uint32_t n = head - ring->tail;
+  uint32_t expected = 1;
+
+  if (n > size) {
+    n = size;
+  } else if (n == 0) {
+    return 0;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    buf[i] = ring->data[(ring->tail + i) & (NHW_UPTY_RING_SIZE - 1)];
+  }
+  __atomic_store_n(&ring->tail, ring->tail + n, __ATOMIC_SEQ_CST);
+
+  if (__atomic_compare_exchange_n(&ring->stalled, &expected, 0, false,
+                                  __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+    upty_mon_arm(ring, EPOLL_CTL_MOD);
+  }
+  return n;
+}
+
+void nhw_upty_monitor_stop(void) {
+  if (upty_mon.running) {
+    uint64_t one = 1;
+    if (write(upty_mon.stop_fd, &one, sizeof(one)) == sizeof(one)) {
+      (void)pthread_join(upty_mon.thread, NULL);
+    }
+    upty_mon.running = false;
+  }
+  if (upty_mon.epoll_fd != -1) {
+    (void)close(upty_mon.epoll_fd);
+    upty_mon.epoll_fd = -1;
+  }
+  if (upty_mon.stop_fd != -1) {
+    (void)close(upty_mon.stop_fd);
+    upty_mon.stop_fd = -1;
+  }
+  for (int i = 0; i < upty_mon.n_rings; i++) {
+    free(upty_mon.rings[i]);
+  }
+  free(upty_mon.rings);
+  upty_mon.rings = NULL;
+  upty_mon.n_rings = 0;
+}
@@ -14,6 +14,13 @@ int nhw_upty_open_ptty(const char *uart_name, const char *auto_attach_cmd,
                        bool do_auto_attach, bool wait_pts);
 void nhw_upty_wait_for_pty(int fd, uint64_t microsec);
 
+struct nhw_upty_ring;
+
+struct nhw_upty_ring *nhw_upty_monitor_add(int fd);
+void nhw_upty_monitor_start(void);
+int nhw_upty_ring_read(struct nhw_upty_ring *ring, unsigned char *buf, size_t size);
+void nhw_upty_monitor_stop(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,10 @@ struct uarte_status {
   uint32_t TXD_MAXCNT;
   uint32_t TXD_AMOUNT;
   enum uarte_dma_status tx_dma_status;
+  /* Tx DMA fast path: nobody is observing the individual Tx bytes, so the model skips
+   * directly to the last one (see nhw_uarte_tx_fast_try()) */
+  bool tx_fast;
+  bs_time_t tx_fast_start; /* When the first byte of the fast Tx DMA started */
 
   uint32_t RXD_PTR;
   uint32_t RXD_MAXCNT;
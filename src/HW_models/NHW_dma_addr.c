@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Simulated bus addresses for 64 bit builds (see NHW_dma_addr.h)
+ *
+ * The 32 bit simulated address space is split in 256 windows of 16MiB.
+ * The windows in the upper half (addresses 0x80000000..0xFFFFFFFF) are assigned on demand
+ * to the host memory the SW hands to the DMA:
+ * The first time a pointer into a not yet mapped 16MiB aligned host area is converted,
+ * two consecutive windows are assigned to that area and the one which follows it.
+ * So any buffer starting in that area can be accessed thru one simulated address,
+ * as long as it is smaller than 16MiB.
+ *
+ * Addresses in the lower half are the real device addresses. They are translated with
+ * nhw_convert_RAM_addr() for the embedded RAM, and with the peripherals conversion table
+ * for peripheral registers.
+ *
+ * Translating an address into a pointer is just an indexed table lookup.
+ */
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include "bs_types.h"
+#include "bs_tracing.h"
+#include "NHW_config.h"
+#include "NHW_misc.h"
+#include "NHW_dma_addr.h"
+
+#if NHW_DMA_ADDR_TRANSLATION
+
+#define DMA_WIN_SIZE ((uintptr_t)1 << NHW_DMA_WIN_BITS)
+#define DMA_N_WINS (1 << (32 - NHW_DMA_WIN_BITS))
+#define DMA_FIRST_DYN_WIN (DMA_N_WINS / 2)
+
+char *nhw_dma_win_base[DMA_N_WINS];
+static bool dma_win_primary[DMA_N_WINS]; /* The window was assigned to this area (not as follower) */
+static uint dma_next_free_win = DMA_FIRST_DYN_WIN;
+static uint dma_last_win = DMA_N_WINS; /* Cache of the last window used to convert a pointer */
+
+uint32_t nhw_dma_ptr_to_addr(const void *ptr) {
+  char *base = (char *)((uintptr_t)ptr & ~(DMA_WIN_SIZE - 1));
+  uint32_t offset = (uintptr_t)ptr & (DMA_WIN_SIZE - 1);
+  uint w;
+
+  if (ptr == NULL) {
+    return 0;
+  }
+
+  if ((dma_last_win < DMA_N_WINS) && (nhw_dma_win_base[dma_last_win] == base)) {
+    return (dma_last_win << NHW_DMA_WIN_BITS) | offset;
+  }
+
+  for (w = DMA_FIRST_DYN_WIN; w < dma_next_free_win; w++) {
+    if (dma_win_primary[w] && (nhw_dma_win_base[w] == base)) {
+      break;
+    }
+  }
+  if (w == dma_next_free_win) {
+    if (dma_next_free_win + 2 > DMA_N_WINS) {
+      bs_trace_error_time_line("Run out of simulated DMA address windows while mapping %p\n", ptr);
+    }
+    dma_next_free_win += 2;
+    nhw_dma_win_base[w] = base;
+    nhw_dma_win_base[w + 1] = base + DMA_WIN_SIZE;
+    dma_win_primary[w] = true;
+  }
+  dma_last_win = w;
+
+  return (w << NHW_DMA_WIN_BITS) | offset;
+}
+
+void *nhw_dma_addr_to_ptr_slow(uint32_t addr) {
+  void *ptr = (void *)(uintptr_t)addr;
+
+  if (addr == 0) {
+    return NULL;
+  }
+#if defined(NHW_APPCORE_RAM_ADDR)
+  if ((addr >= NHW_APPCORE_RAM_ADDR) && (addr < NHW_APPCORE_RAM_ADDR + NHW_APPCORE_RAM_SIZE)) {
+    (void)nhw_convert_RAM_addr(&ptr);
+    return ptr;
+  }
+#endif
+  ptr = nhw_try_convert_per_addr_hw_to_sim((void *)(uintptr_t)addr);
+  if (ptr == NULL) {
+    bs_trace_error_time_line("DMA address 0x%08"PRIX32" is not mapped. In 64 bit builds, "
+                             "pointers must be set in the DMA registers thru the HAL "
+                             "(or converted with nhw_dma_ptr_to_addr())\n", addr);
+  }
+  return ptr;
+}
+
+#endif /* NHW_DMA_ADDR_TRANSLATION */
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Translation between host pointers and the 32 bit addresses the SW writes in the
+ * DMA pointer registers (like RADIO.PACKETPTR or UARTE.TXD.PTR)
+ *
+ * In 32 bit builds these are just casts.
+ * In 64 bit builds, host pointers do not fit in these registers, so they hold a simulated
+ * bus address instead, which the HAL sets with nhw_dma_ptr_to_addr(), and the models convert
+ * back with nhw_dma_addr_to_ptr(). Check NHW_dma_addr.c for more info.
+ */
+
+#ifndef _NRF_HW_MODEL_NHW_DMA_ADDR_H
+#define _NRF_HW_MODEL_NHW_DMA_ADDR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#if UINTPTR_MAX > UINT32_MAX
+
+#define NHW_DMA_ADDR_TRANSLATION 1
+
+#define NHW_DMA_WIN_BITS 24 /* Each window maps 16MiB of the host address space */
+
+extern char *nhw_dma_win_base[1 << (32 - NHW_DMA_WIN_BITS)];
+
+uint32_t nhw_dma_ptr_to_addr(const void *ptr);
+void *nhw_dma_addr_to_ptr_slow(uint32_t addr);
+
+static inline void *nhw_dma_addr_to_ptr(uint32_t addr) {
+  char *base = nhw_dma_win_base[addr >> NHW_DMA_WIN_BITS];
+
+  if (base) {
+    return base + (addr & ((1 << NHW_DMA_WIN_BITS) - 1));
+  }
+  return nhw_dma_addr_to_ptr_slow(addr);
+}
+
+#else /* 32 bit host */
+
+#define NHW_DMA_ADDR_TRANSLATION 0
+
+static inline uint32_t nhw_dma_ptr_to_addr(const void *ptr) {
+  return (uint32_t)(uintptr_t)ptr;
+}
+
+static inline void *nhw_dma_addr_to_ptr(uint32_t addr) {
+  return (void *)(uintptr_t)addr;
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NRF_HW_MODEL_NHW_DMA_ADDR_H */
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Profiler for the HW models event handlers (the ones registered with NHW_HW_EVENT())
+ *
+ * When enabled with the command line option -hws_profile (or -hws_profile_json=<path>),
+ * for each handler it records:
+ *   * How many times it was called
+ *   * The cumulative and maximum host time spent in it
+ *     (measured with the CPU time stamp counter when available, or otherwise CLOCK_MONOTONIC)
+ *   * How many times it recalculated the next HW event (called nsi_hws_find_next_event()),
+ *     not counting the one the HW scheduler always does after each event.
+ * Recalculations done outside of any handler (normally due to SW register writes)
+ * are accounted in a separate "<outside handlers>" entry.
+ * The embedded SW runs inside the HW event handler which awakes the CPU (normally the interrupt
+ * controller one). The time it runs when awoken thru nhw_hws_cpu_run(), and the recalculations
+ * it causes meanwhile, are accounted in a separate "<embedded SW>" entry instead of in that
+ * handler. SW which runs outside of any handler (e.g. during boot) is not accounted.
+ * Overall, it also reports how many of those recalculations were requested, and how many were
+ * actually done after coalescing them (see NHW_hws_profiler.h), per HW event.
+ * The coalescing can be disabled with -hws_no_coalesce to compare.
+ *
+ * At exit, a table sorted by cumulative time is printed, and/or a JSON file is written.
+ */
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include "bs_tracing.h"
+#include "bs_oswrap.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
+#include "nsi_tasks.h"
+#include "NHW_hws_profiler.h"
+
+bool nhw_hws_prof_enabled;
+bool nhw_hws_coalesce = true;
+bool nhw_hws_in_handler;
+bool nhw_hws_next_dirty;
+struct nhw_hws_scan_stats nhw_hws_scan_stats;
+static bool hws_no_coalesce;
+static bool hws_prof_table;
+static char *hws_prof_json_path;
+
+static struct nhw_hws_prof_entry prof_outside = {.name = "<outside handlers>"};
+static struct nhw_hws_prof_entry prof_sw = {.name = "<embedded SW>"};
+static uint64_t prof_find_next_dummy;
+uint64_t *nhw_hws_prof_find_next_cnt = &prof_find_next_dummy;
+
+static struct nhw_hws_prof_entry *prof_list; /* All handlers which have been called at least once */
+static uint prof_n_entries;
+
+static uint64_t prof_start_ticks, prof_start_ns;
+
+static inline uint64_t prof_get_ns(void) {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline uint64_t prof_get_ticks(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#else
+  return prof_get_ns();
+#endif
+}
+
+void nhw_hws_prof_call(struct nhw_hws_prof_entry *entry, void (*fn)(void)) {
+  uint64_t start, ticks, sw_ticks;
+
+  if (entry->calls++ == 0) {
+    entry->next = prof_list;
+    prof_list = entry;
+    prof_n_entries++;
+  }
+
+  nhw_hws_prof_find_next_cnt = &entry->find_next;
+  sw_ticks = prof_sw.ticks;
+  start = prof_get_ticks();
+  fn();
+  /* Without the time the embedded SW ran meanwhile */
+  ticks = prof_get_ticks() - start - (prof_sw.ticks - sw_ticks);
+  nhw_hws_prof_find_next_cnt = &prof_outside.find_next;
+
+  entry->ticks += ticks;
+  if (ticks > entry->max_ticks) {
+    entry->max_ticks = ticks;
+  }
+}
+
+void nhw_hws_prof_call_cpu(void (*fn)(int), int cpu_n) {
+  uint64_t *prev_find_next_cnt = nhw_hws_prof_find_next_cnt;
+  uint64_t start, ticks;
+
+  prof_sw.calls++;
+  nhw_hws_prof_find_next_cnt = &prof_sw.find_next;
+  start = prof_get_ticks();
+  fn(cpu_n);
+  ticks = prof_get_ticks() - start;
+  nhw_hws_prof_find_next_cnt = prev_find_next_cnt;
+
+  prof_sw.ticks += ticks;
+  if (ticks > prof_sw.max_ticks) {
+    prof_sw.max_ticks = ticks;
+  }
+}
+
+static int prof_cmp_ticks(const void *a, const void *b) {
+  const struct nhw_hws_prof_entry *ea = *(const struct nhw_hws_prof_entry **)a;
+  const struct nhw_hws_prof_entry *eb = *(const struct nhw_hws_prof_entry **)b;
+
+  if (ea->ticks != eb->ticks) {
+    return ea->ticks < eb->ticks ? 1 : -1;
+  }
+  return strcmp(ea->name, eb->name);
+}
+
+static void prof_print_table(struct nhw_hws_prof_entry **sorted, uint n, double ns_per_tick,
+                             uint64_t total_ns) {
+  uint64_t handlers_ticks = 0;
+
+  for (uint i = 0; i < n; i++) {
+    handlers_ticks += sorted[i]->ticks;
+  }
+
+  bs_trace_raw(2, "HW event handlers profile (%.3fs of host time, %.1f%% of it in handlers, "
+               "%.1f%% in the embedded SW):\n",
+               total_ns / 1e9, total_ns ? handlers_ticks * ns_per_tick * 100 / total_ns : 0,
+               total_ns ? prof_sw.ticks * ns_per_tick * 100 / total_ns : 0);
+  bs_trace_raw(2, "%-42s %12s %12s %6s %10s %10s %12s\n",
+               "handler", "calls", "total(ms)", "%", "avg(ns)", "max(ns)", "find_next");
+  for (uint i = 0; i < n; i++) {
+    struct nhw_hws_prof_entry *e = sorted[i];
+    bs_trace_raw(2, "%-42s %12"PRIu64" %12.3f %6.2f %10.0f %10.0f %12"PRIu64"\n",
+                 e->name, e->calls, e->ticks * ns_per_tick / 1e6,
+                 handlers_ticks ? (double)e->ticks * 100 / handlers_ticks : 0,
+                 e->calls ? e->ticks * ns_per_tick / e->calls : 0,
+                 e->max_ticks * ns_per_tick, e->find_next);
+  }
+  bs_trace_raw(2, "%-42s %12"PRIu64" %12.3f %6s %10.0f %10.0f %12"PRIu64"\n",
+               prof_sw.name, prof_sw.calls, prof_sw.ticks * ns_per_tick / 1e6, "",
+               prof_sw.calls ? prof_sw.ticks * ns_per_tick / prof_sw.calls : 0,
+               prof_sw.max_ticks * ns_per_tick, prof_sw.find_next);
+  bs_trace_raw(2, "%-42s %12s %12s %6s %10s %10s %12"PRIu64"\n",
+               prof_outside.name, "", "", "", "", "", prof_outside.find_next);
+
+  struct nhw_hws_scan_stats *st = &nhw_hws_scan_stats;
+  bs_trace_raw(2, "Next event recalculations (%s): %"PRIu64" requested, %"PRIu64" done, "
+               "in %"PRIu64" HW events (%.2f requested, %.2f done per event)\n",
+               nhw_hws_coalesce ? "coalesced" : "not coalesced",
+               st->requested, st->done, st->events,
+               st->events ? (double)st->requested / st->events : 0,
+               st->events ? (double)st->done / st->events : 0);
+}
+
+static void prof_write_json(struct nhw_hws_prof_entry **sorted, uint n, double ns_per_tick,
+                            uint64_t total_ns) {
+  FILE *f = fopen(hws_prof_json_path, "w");
+
+  if (f == NULL) {
+    bs_trace_warning_line("Could not open %s to write the HW event handlers profile (%i, %s)\n",
+                          hws_prof_json_path, errno, strerror(errno));
+    return;
+  }
+
+  fprintf(f, "{\n  \"host_time_ns\": %"PRIu64",\n", total_ns);
+  fprintf(f, "  \"find_next_outside_handlers\": %"PRIu64",\n", prof_outside.find_next);
+  fprintf(f, "  \"embedded_sw\": {\"calls\": %"PRIu64", \"total_ns\": %.0f, \"max_ns\": %.0f, "
+             "\"find_next\": %"PRIu64"},\n",
+          prof_sw.calls, prof_sw.ticks * ns_per_tick, prof_sw.max_ticks * ns_per_tick,
+          prof_sw.find_next);
+  fprintf(f, "  \"coalesce\": %s,\n", nhw_hws_coalesce ? "true" : "false");
+  fprintf(f, "  \"events\": %"PRIu64",\n", nhw_hws_scan_stats.events);
+  fprintf(f, "  \"find_next_requested\": %"PRIu64",\n", nhw_hws_scan_stats.requested);
+  fprintf(f, "  \"find_next_done\": %"PRIu64",\n", nhw_hws_scan_stats.done);
+  fprintf(f, "  \"handlers\": [");
+  for (uint i = 0; i < n; i++) {
+    struct nhw_hws_prof_entry *e = sorted[i];
+    fprintf(f, "%s\n    {\"name\": \"%s\", \"calls\": %"PRIu64", \"total_ns\": %.0f, "
+               "\"max_ns\": %.0f, \"find_next\": %"PRIu64"}",
+            i ? "," : "", e->name, e->calls, e->ticks * ns_per_tick,
+            e->max_ticks * ns_per_tick, e->find_next);
+  }
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+}
+
+static void nhw_hws_prof_dump(void) {
+  struct nhw_hws_prof_entry **sorted;
+  struct nhw_hws_prof_entry *e;
+  uint64_t total_ns, total_ticks;
+  double ns_per_tick;
+  uint n = 0;
+
+  if (!nhw_hws_prof_enabled) {
+    return;
+  }
+  nhw_hws_prof_enabled = false;
+
+  total_ns = prof_get_ns() - prof_start_ns;
+  total_ticks = prof_get_ticks() - prof_start_ticks;
+  ns_per_tick = total_ticks ? (double)total_ns / total_ticks : 1;
+
+  sorted = (struct nhw_hws_prof_entry **)bs_calloc(prof_n_entries + 1, sizeof(*sorted));
+  for (e = prof_list; e != NULL; e = e->next) {
+    sorted[n++] = e;
+  }
+  qsort(sorted, n, sizeof(*sorted), prof_cmp_ticks);
+
+  if (hws_prof_table) {
+    prof_print_table(sorted, n, ns_per_tick, total_ns);
+  }
+  if (hws_prof_json_path) {
+    prof_write_json(sorted, n, ns_per_tick, total_ns);
+  }
+  free(sorted);
+}
+
+NSI_TASK(nhw_hws_prof_dump, ON_EXIT_PRE, 1); /* Before the models tear down */
+
+static void nhw_hws_prof_register_cmdline(void) {
+  static bs_args_struct_t args[] = {
+    { .is_switch = true,
+      .option = "hws_profile",
+      .type = 'b',
+      .dest = (void *)&hws_prof_table,
+      .descript = "Profile the HW models event handlers (and separately the embedded SW they "
+                  "awake), and print a table with the results at exit"
+    },
+    { .option = "hws_profile_json",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&hws_prof_json_path,
+      .descript = "Profile the HW models event handlers (and separately the embedded SW they "
+                  "awake), and write the results at exit into this JSON file"
+    },
+    { .is_switch = true,
+      .option = "hws_no_coalesce",
+      .type = 'b',
+      .dest = (void *)&hws_no_coalesce,
+      .descript = "Do not coalesce the next HW event recalculations the models request while "
+                  "handling an event (for debugging or comparison)"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args);
+}
+
+NSI_TASK(nhw_hws_prof_register_cmdline, PRE_BOOT_1, 200);
+
+static void nhw_hws_prof_post_cmdline(void) {
+  nhw_hws_coalesce = !hws_no_coalesce;
+  if (!hws_prof_table && !hws_prof_json_path) {
+    return;
+  }
+  nhw_hws_prof_enabled = true;
+  nhw_hws_prof_find_next_cnt = &prof_outside.find_next;
+  prof_start_ns = prof_get_ns();
+  prof_start_ticks = prof_get_ticks();
+}
+
+NSI_TASK(nhw_hws_prof_post_cmdline, PRE_BOOT_2, 200);
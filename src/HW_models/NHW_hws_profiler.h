@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Optional profiling of the HW models event handlers.
+ * Check NHW_hws_profiler.c for more info.
+ *
+ * Models should register their timers with NHW_HW_EVENT() instead of NSI_HW_EVENT(),
+ * and include this header (after any other native simulator header) so their calls to
+ * nsi_hws_find_next_event() are accounted for.
+ *
+ * This header also coalesces the models' next event recalculations:
+ * While a HW event handler registered with NHW_HW_EVENT() runs, nsi_hws_find_next_event()
+ * only marks the next event as dirty, as the HW scheduler will anyhow look for it right after
+ * the handler returns. If a model needs the next event time before that
+ * (nsi_hws_get_next_event_time()), the pending recalculation is done then.
+ * Models which know the old and new value of their timer can use nhw_hws_timer_updated()
+ * instead, which skips the recalculation altogether when the change cannot affect the next event.
+ */
+
+#ifndef _NRF_HW_MODEL_NHW_HWS_PROFILER_H
+#define _NRF_HW_MODEL_NHW_HWS_PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nsi_hw_scheduler.h"
+#include "nsi_hws_models_if.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+struct nhw_hws_prof_entry {
+  const char *name;
+  uint64_t calls;
+  uint64_t ticks;     /* Cumulative host time spent in the handler (in profiler ticks) */
+  uint64_t max_ticks; /* Longest single call (in profiler ticks) */
+  uint64_t find_next; /* Calls to nsi_hws_find_next_event() done from within the handler */
+  struct nhw_hws_prof_entry *next;
+};
+
+/* Next event recalculation statistics */
+struct nhw_hws_scan_stats {
+  uint64_t events;    /* HW events dispatched to NHW_HW_EVENT() handlers */
+  uint64_t requested; /* Calls to nsi_hws_find_next_event() / nhw_hws_timer_updated() */
+  uint64_t done;      /* Recalculations actually done by the models */
+};
+
+extern bool nhw_hws_prof_enabled;
+extern uint64_t *nhw_hws_prof_find_next_cnt;
+extern bool nhw_hws_coalesce;
+extern bool nhw_hws_in_handler;
+extern bool nhw_hws_next_dirty;
+extern struct nhw_hws_scan_stats nhw_hws_scan_stats;
+
+void nhw_hws_prof_call(struct nhw_hws_prof_entry *entry, void (*fn)(void));
+void nhw_hws_prof_call_cpu(void (*fn)(int), int cpu_n);
+
+static inline void nhw_hws_prof_find_next_event(void) {
+  (*nhw_hws_prof_find_next_cnt)++;
+  nhw_hws_scan_stats.requested++;
+  if (nhw_hws_in_handler) {
+    nhw_hws_next_dirty = true;
+    return;
+  }
+  nhw_hws_scan_stats.done++;
+  nsi_hws_find_next_event();
+}
+
+static inline uint64_t nhw_hws_get_next_event_time(void) {
+  if (nhw_hws_next_dirty) {
+    nhw_hws_next_dirty = false;
+    nhw_hws_scan_stats.done++;
+    nsi_hws_find_next_event();
+  }
+  return nsi_hws_get_next_event_time();
+}
+
+#define nsi_hws_find_next_event() nhw_hws_prof_find_next_event()
+#define nsi_hws_get_next_event_time() nhw_hws_get_next_event_time()
+
+/*
+ * Equivalent to nsi_hws_find_next_event(), for a model which just changed one of its timers
+ * from <old_time> to <new_time>.
+ * If there is no recalculation pending, and both times are after the next event, the change
+ * cannot affect which one is next, so nothing needs to be done.
+ */
+static inline void nhw_hws_timer_updated(uint64_t old_time, uint64_t new_time) {
+  if (nhw_hws_coalesce && !nhw_hws_next_dirty) {
+    uint64_t next = nsi_hws_get_next_event_time();
+
+    if ((old_time == new_time) || ((old_time > next) && (new_time > next))) {
+      (*nhw_hws_prof_find_next_cnt)++;
+      nhw_hws_scan_stats.requested++;
+      return;
+    }
+  }
+  nsi_hws_find_next_event();
+}
+
+/*
+ * Let the CPU <cpu_n> embedded SW run thru <fn> (normally nsif_cpun_irq_raised()),
+ * accounting for the time it runs separately from the HW event handler which awoke it.
+ */
+static inline void nhw_hws_cpu_run(void (*fn)(int), int cpu_n) {
+  if (nhw_hws_prof_enabled) {
+    nhw_hws_prof_call_cpu(fn, cpu_n);
+  } else {
+    fn(cpu_n);
+  }
+}
+
+/*
+ * Equivalent to NSI_HW_EVENT(), but which lets the profiler account for the handler <fn>,
+ * and coalesces the next event recalculations done while it runs.
+ * When the profiler is disabled the only overhead is one extra function call and a check.
+ */
+#define NHW_HW_EVENT(t, fn, prio) \
+  static struct nhw_hws_prof_entry nhw_hws_prof_entry_##fn = {.name = #fn}; \
+  static void nhw_hws_prof_wrap_##fn(void) { \
+    nhw_hws_scan_stats.events++; \
+    nhw_hws_in_handler = nhw_hws_coalesce; \
+    if (nhw_hws_prof_enabled) { \
+      nhw_hws_prof_call(&nhw_hws_prof_entry_##fn, fn); \
+    } else { \
+      fn(); \
+    } \
+    nhw_hws_in_handler = false; \
+    nhw_hws_next_dirty = false; /* The HW scheduler looks for the next event right after */ \
+  } \
+  NSI_HW_EVENT(t, nhw_hws_prof_wrap_##fn, prio)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NRF_HW_MODEL_NHW_HWS_PROFILER_H */
@@ -13,8 +13,8 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //DEF_ENTRY(APPROTECT),
     DEF_ENTRY(CLOCK,),
     DEF_ENTRY(POWER,),
-    {(void *)NRF_P0_BASE , NRF_P0_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
-    {(void *)NRF_P1_BASE , NRF_P1_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
+    {(void *)NRF_P0_BASE , NRF_P0_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P0"},
+    {(void *)NRF_P1_BASE , NRF_P1_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P1"},
     DEF_ENTRY(RADIO,),
     DEF_ENTRY(UARTE, 0),
     //SPI0-1
@@ -33,8 +33,8 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     /***** Application core *****/
     //{(void *)NRF_CACHEDATA_S_BASE    ,NRF_CACHEDATA_S_APP_BASE_REAL_HW, sizeof(NRF_CACHEDATA_Type) },
     //{(void *)NRF_CACHEINFO_S_BASE    ,NRF_CACHEINFO_S_APP_BASE_REAL_HW, sizeof(NRF_CACHEINFO_Type) },
-    {(void *)(NRF_FICR_regs_p[NHW_FICR_APP])  ,0x00FF0000UL, sizeof(NRF_FICR_APP_Type)},
-    {(void *)(NRF_UICR_regs_p[NHW_UICR_APP0]) ,0x00FF8000UL, sizeof(NRF_UICR_Type)},
+    {(void *)(NRF_FICR_regs_p[NHW_FICR_APP])  ,0x00FF0000UL, sizeof(NRF_FICR_APP_Type), "FICR"},
+    {(void *)(NRF_UICR_regs_p[NHW_UICR_APP0]) ,0x00FF8000UL, sizeof(NRF_UICR_Type), "UICR"},
     //{(void *)NRF_CTI_S_BASE          ,0xE0042000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TAD_S_BASE          ,0xE0080000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_DCNF_NS_BASE        ,0x40000000UL, sizeof(NRF_*_Type)},
@@ -47,71 +47,71 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //{(void *)NRF_REGULATORS_NS_BASE  ,0x40004000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_OSCILLATORS_S_BASE  ,0x50004000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_REGULATORS_S_BASE   ,0x50004000UL, sizeof(NRF_*_Type)},
-    {(void *)(NRF_CLOCK_regs[NHW_CLKPWR_APP0]) ,0x40005000UL, sizeof(NRF_CLOCK_Type)},
-    {(void *)(NRF_POWER_regs[NHW_CLKPWR_APP0]) ,0x40005000UL, sizeof(NRF_POWER_Type)},
-    {(void *)(NRF_RESET_regs[NHW_CLKPWR_APP0]) ,0x40005000UL, sizeof(NRF_RESET_Type)},
-    {(void *)(NRF_CLOCK_regs[NHW_CLKPWR_APP0]) ,0x50005000UL, sizeof(NRF_CLOCK_Type)},
-    {(void *)(NRF_POWER_regs[NHW_CLKPWR_APP0]) ,0x50005000UL, sizeof(NRF_POWER_Type)},
-    {(void *)(NRF_RESET_regs[NHW_CLKPWR_APP0]) ,0x50005000UL, sizeof(NRF_RESET_Type)},
+    {(void *)(NRF_CLOCK_regs[NHW_CLKPWR_APP0]) ,0x40005000UL, sizeof(NRF_CLOCK_Type), "CLOCK_NS"},
+    {(void *)(NRF_POWER_regs[NHW_CLKPWR_APP0]) ,0x40005000UL, sizeof(NRF_POWER_Type), "POWER_NS"},
+    {(void *)(NRF_RESET_regs[NHW_CLKPWR_APP0]) ,0x40005000UL, sizeof(NRF_RESET_Type), "RESET_NS"},
+    {(void *)(NRF_CLOCK_regs[NHW_CLKPWR_APP0]) ,0x50005000UL, sizeof(NRF_CLOCK_Type), "CLOCK_S"},
+    {(void *)(NRF_POWER_regs[NHW_CLKPWR_APP0]) ,0x50005000UL, sizeof(NRF_POWER_Type), "POWER_S"},
+    {(void *)(NRF_RESET_regs[NHW_CLKPWR_APP0]) ,0x50005000UL, sizeof(NRF_RESET_Type), "RESET_S"},
     //{(void *)NRF_CTRLAP_NS_BASE      ,0x40006000U, sizeof(NRF_*_Type)},
     //{(void *)NRF_CTRLAP_S_BASE       ,0x50006000U, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIM0_NS_BASE       ,0x40008000U, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS0_NS_BASE       ,0x40008000U, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM0_NS_BASE       ,0x40008000U, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS0_NS_BASE       ,0x40008000U, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP0]) ,0x40008000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP0]) ,0x40008000UL, sizeof(NRF_UARTE_Type), "UARTE0_NS"},
     //{(void *)NRF_SPIM0_S_BASE        ,0x50008000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS0_S_BASE        ,0x50008000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM0_S_BASE        ,0x50008000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS0_S_BASE        ,0x50008000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP0]) ,0x50008000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP0]) ,0x50008000UL, sizeof(NRF_UARTE_Type), "UARTE0_S"},
     //{(void *)NRF_SPIM1_NS_BASE       ,0x40009000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS1_NS_BASE       ,0x40009000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM1_NS_BASE       ,0x40009000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS1_NS_BASE       ,0x40009000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP1]) ,0x40009000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP1]) ,0x40009000UL, sizeof(NRF_UARTE_Type), "UARTE1_NS"},
     //{(void *)NRF_SPIM1_S_BASE        ,0x50009000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS1_S_BASE        ,0x50009000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM1_S_BASE        ,0x50009000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS1_S_BASE        ,0x50009000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP1]) ,0x50009000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP1]) ,0x50009000UL, sizeof(NRF_UARTE_Type), "UARTE1_S"},
     //{(void *)NRF_SPIM4_NS_BASE       ,0x4000A000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIM4_S_BASE        ,0x5000A000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIM2_NS_BASE       ,0x4000B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS2_NS_BASE       ,0x4000B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM2_NS_BASE       ,0x4000B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS2_NS_BASE       ,0x4000B000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP2]) ,0x4000B000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP2]) ,0x4000B000UL, sizeof(NRF_UARTE_Type), "UARTE2_NS"},
     //{(void *)NRF_SPIM2_S_BASE        ,0x5000B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS2_S_BASE        ,0x5000B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM2_S_BASE        ,0x5000B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS2_S_BASE        ,0x5000B000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP2]) ,0x5000B000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP2]) ,0x5000B000UL, sizeof(NRF_UARTE_Type), "UARTE2_S"},
     //{(void *)NRF_SPIM3_NS_BASE       ,0x4000C000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS3_NS_BASE       ,0x4000C000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM3_NS_BASE       ,0x4000C000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS3_NS_BASE       ,0x4000C000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP3]) ,0x4000C000UL, sizeof(NRF_UARTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP3]) ,0x4000C000UL, sizeof(NRF_UARTE_Type), "UARTE3_NS"},
     //{(void *)NRF_SPIM3_S_BASE        ,0x5000C000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS3_S_BASE        ,0x5000C000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM3_S_BASE        ,0x5000C000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS3_S_BASE        ,0x5000C000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP3])   ,0x5000C000UL, sizeof(NRF_UARTE_Type)},
-    {(void *)(&NRF_GPIOTE_regs[NHW_GPIOTE_APP0]) ,0x5000D000UL, sizeof(NRF_GPIOTE_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_APP3])   ,0x5000C000UL, sizeof(NRF_UARTE_Type), "UARTE3_S"},
+    {(void *)(&NRF_GPIOTE_regs[NHW_GPIOTE_APP0]) ,0x5000D000UL, sizeof(NRF_GPIOTE_Type), "GPIOTE0_S"},
     //{(void *)NRF_SAADC_NS_BASE       ,0x4000E000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_SAADC_S_BASE        ,0x5000E000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP0]) ,0x4000F000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP0]) ,0x5000F000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP1]) ,0x40010000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP1]) ,0x50010000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP2]) ,0x40011000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP2]) ,0x50011000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_RTC_regs[NHW_RTC_APP0])     ,0x40014000UL, sizeof(NRF_RTC_Type)},
-    {(void *)(&NRF_RTC_regs[NHW_RTC_APP0])     ,0x50014000UL, sizeof(NRF_RTC_Type)},
-    {(void *)(&NRF_RTC_regs[NHW_RTC_APP1])     ,0x40015000UL, sizeof(NRF_RTC_Type)},
-    {(void *)(&NRF_RTC_regs[NHW_RTC_APP1])     ,0x50015000UL, sizeof(NRF_RTC_Type)},
-    {(void *)(&NRF_DPPIC_regs[NHW_DPPI_APP_0]) ,0x40017000UL, sizeof(NRF_DPPIC_Type)},
-    {(void *)(&NRF_DPPIC_regs[NHW_DPPI_APP_0]) ,0x50017000UL, sizeof(NRF_DPPIC_Type)},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP0]) ,0x4000F000UL, sizeof(NRF_TIMER_Type), "TIMER0_NS"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP0]) ,0x5000F000UL, sizeof(NRF_TIMER_Type), "TIMER0_S"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP1]) ,0x40010000UL, sizeof(NRF_TIMER_Type), "TIMER1_NS"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP1]) ,0x50010000UL, sizeof(NRF_TIMER_Type), "TIMER1_S"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP2]) ,0x40011000UL, sizeof(NRF_TIMER_Type), "TIMER2_NS"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_APP2]) ,0x50011000UL, sizeof(NRF_TIMER_Type), "TIMER2_S"},
+    {(void *)(&NRF_RTC_regs[NHW_RTC_APP0])     ,0x40014000UL, sizeof(NRF_RTC_Type), "RTC0_NS"},
+    {(void *)(&NRF_RTC_regs[NHW_RTC_APP0])     ,0x50014000UL, sizeof(NRF_RTC_Type), "RTC0_S"},
+    {(void *)(&NRF_RTC_regs[NHW_RTC_APP1])     ,0x40015000UL, sizeof(NRF_RTC_Type), "RTC1_NS"},
+    {(void *)(&NRF_RTC_regs[NHW_RTC_APP1])     ,0x50015000UL, sizeof(NRF_RTC_Type), "RTC1_S"},
+    {(void *)(&NRF_DPPIC_regs[NHW_DPPI_APP_0]) ,0x40017000UL, sizeof(NRF_DPPIC_Type), "DPPIC_NS"},
+    {(void *)(&NRF_DPPIC_regs[NHW_DPPI_APP_0]) ,0x50017000UL, sizeof(NRF_DPPIC_Type), "DPPIC_S"},
     //{(void *)NRF_WDT0_NS_BASE        ,0x40018000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_WDT0_S_BASE         ,0x50018000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_WDT1_NS_BASE        ,0x40019000UL, sizeof(NRF_*_Type)},
@@ -120,18 +120,18 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //{(void *)NRF_LPCOMP_NS_BASE      ,0x4001A000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_COMP_S_BASE         ,0x5001A000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_LPCOMP_S_BASE       ,0x5001A000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP0]) ,0x4001B000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP0]) ,0x5001B000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP1]) ,0x4001C000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP1]) ,0x5001C000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP2]) ,0x4001D000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP2]) ,0x5001D000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP3]) ,0x4001E000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP3]) ,0x5001E000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP4]) ,0x4001F000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP4]) ,0x5001F000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP5]) ,0x40020000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_APP5]) ,0x50020000UL, sizeof(NRF_EGU_Type)},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP0]) ,0x4001B000UL, sizeof(NRF_EGU_Type), "EGU0_NS"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP0]) ,0x5001B000UL, sizeof(NRF_EGU_Type), "EGU0_S"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP1]) ,0x4001C000UL, sizeof(NRF_EGU_Type), "EGU1_NS"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP1]) ,0x5001C000UL, sizeof(NRF_EGU_Type), "EGU1_S"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP2]) ,0x4001D000UL, sizeof(NRF_EGU_Type), "EGU2_NS"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP2]) ,0x5001D000UL, sizeof(NRF_EGU_Type), "EGU2_S"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP3]) ,0x4001E000UL, sizeof(NRF_EGU_Type), "EGU3_NS"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP3]) ,0x5001E000UL, sizeof(NRF_EGU_Type), "EGU3_S"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP4]) ,0x4001F000UL, sizeof(NRF_EGU_Type), "EGU4_NS"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP4]) ,0x5001F000UL, sizeof(NRF_EGU_Type), "EGU4_S"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP5]) ,0x40020000UL, sizeof(NRF_EGU_Type), "EGU5_NS"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_APP5]) ,0x50020000UL, sizeof(NRF_EGU_Type), "EGU5_S"},
     //{(void *)NRF_PWM0_NS_BASE        ,0x40021000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_PWM0_S_BASE         ,0x50021000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_PWM1_NS_BASE        ,0x40022000UL, sizeof(NRF_*_Type)},
@@ -144,15 +144,15 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //{(void *)NRF_PDM0_S_BASE         ,0x50026000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_I2S0_NS_BASE        ,0x40028000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_I2S0_S_BASE         ,0x50028000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_IPC_regs[NHW_IPC_APP0]) ,0x4002A000UL, sizeof(NRF_IPC_Type)},
-    {(void *)(&NRF_IPC_regs[NHW_IPC_APP0]) ,0x5002A000UL, sizeof(NRF_IPC_Type)},
+    {(void *)(&NRF_IPC_regs[NHW_IPC_APP0]) ,0x4002A000UL, sizeof(NRF_IPC_Type), "IPC_NS"},
+    {(void *)(&NRF_IPC_regs[NHW_IPC_APP0]) ,0x5002A000UL, sizeof(NRF_IPC_Type), "IPC_S"},
     //{(void *)NRF_QSPI_NS_BASE        ,0x4002B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_QSPI_S_BASE         ,0x5002B000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_NFCT_NS_BASE        ,0x4002D000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_NFCT_S_BASE         ,0x5002D000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_GPIOTE_regs[NHW_GPIOTE_APP1]) ,0x4002F000UL, sizeof(NRF_GPIOTE_Type)},
-    {(void *)(&NRF_MUTEX_regs)                   ,0x40030000UL, sizeof(NRF_MUTEX_Type)},
-    {(void *)(&NRF_MUTEX_regs)                   ,0x50030000UL, sizeof(NRF_MUTEX_Type)},
+    {(void *)(&NRF_GPIOTE_regs[NHW_GPIOTE_APP1]) ,0x4002F000UL, sizeof(NRF_GPIOTE_Type), "GPIOTE1_NS"},
+    {(void *)(&NRF_MUTEX_regs)                   ,0x40030000UL, sizeof(NRF_MUTEX_Type), "MUTEX_NS"},
+    {(void *)(&NRF_MUTEX_regs)                   ,0x50030000UL, sizeof(NRF_MUTEX_Type), "MUTEX_S"},
     //{(void *)NRF_QDEC0_NS_BASE       ,0x40033000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_QDEC0_S_BASE        ,0x50033000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_QDEC1_NS_BASE       ,0x40034000UL, sizeof(NRF_*_Type)},
@@ -162,59 +162,59 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //{(void *)NRF_USBREGULATOR_NS_BASE,0x40037000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_USBREGULATOR_S_BASE ,0x50037000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_KMU_NS_BASE         ,0x40039000UL, sizeof(NRF_*_Type)},
-    {(void *)(NRF_NVMC_regs_p[NHW_NVMC_APP0]) ,0x40039000UL, sizeof(NRF_NVMC_Type)},
+    {(void *)(NRF_NVMC_regs_p[NHW_NVMC_APP0]) ,0x40039000UL, sizeof(NRF_NVMC_Type), "NVMC_NS"},
     //{(void *)NRF_KMU_S_BASE          ,0x50039000UL, sizeof(NRF_*_Type)},
-    {(void *)(NRF_NVMC_regs_p[NHW_NVMC_APP0])  ,0x50039000UL, sizeof(NRF_NVMC_Type)},
-    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P0]) ,0x40842500UL, sizeof(NRF_GPIO_Type)},
-    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P1]) ,0x40842800UL, sizeof(NRF_GPIO_Type)},
-    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P0]) ,0x50842500UL, sizeof(NRF_GPIO_Type)},
-    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P1]) ,0x50842800UL, sizeof(NRF_GPIO_Type)},
+    {(void *)(NRF_NVMC_regs_p[NHW_NVMC_APP0])  ,0x50039000UL, sizeof(NRF_NVMC_Type), "NVMC_S"},
+    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P0]) ,0x40842500UL, sizeof(NRF_GPIO_Type), "P0_NS"},
+    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P1]) ,0x40842800UL, sizeof(NRF_GPIO_Type), "P1_NS"},
+    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P0]) ,0x50842500UL, sizeof(NRF_GPIO_Type), "P0_S"},
+    {(void *)(&NRF_GPIO_regs[NHW_GPIO_APP_P1]) ,0x50842800UL, sizeof(NRF_GPIO_Type), "P1_S"},
     //{(void *)NRF_CRYPTOCELL_S_BASE   ,0x50844000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_VMC_NS_BASE         ,0x40081000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_VMC_S_BASE          ,0x50081000UL, sizeof(NRF_*_Type)},
 
     /***** Network core: *****/
-    {(void *)(NRF_FICR_regs_p[NHW_FICR_NET])  ,0x01FF0000UL, sizeof(NRF_FICR_NET_Type)},
-    {(void *)(NRF_UICR_regs_p[NHW_UICR_NET0]) ,0x01FF8000UL, sizeof(NRF_UICR_Type)},
+    {(void *)(NRF_FICR_regs_p[NHW_FICR_NET])  ,0x01FF0000UL, sizeof(NRF_FICR_NET_Type), "NET.FICR"},
+    {(void *)(NRF_UICR_regs_p[NHW_UICR_NET0]) ,0x01FF8000UL, sizeof(NRF_UICR_Type), "NET.UICR"},
     //{(void *)NRF_CTI_NS_BASE         ,0xE0042000UL, sizeof(NRF_*_Type)},
     //{(void *)NRF_DCNF_NS_BASE        ,0x41000000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_VREQCTRL_regs)              ,0x41004000UL, sizeof(NRF_VREQCTRL_Type)},
-    {(void *)(NRF_CLOCK_regs[NHW_CLKPWR_NET0]) ,0x41005000UL, sizeof(NRF_CLOCK_Type)},
-    {(void *)(NRF_POWER_regs[NHW_CLKPWR_NET0]) ,0x41005000UL, sizeof(NRF_POWER_Type)},
-    {(void *)(NRF_RESET_regs[NHW_CLKPWR_NET0]) ,0x41005000UL, sizeof(NRF_RESET_Type)},
+    {(void *)(&NRF_VREQCTRL_regs)              ,0x41004000UL, sizeof(NRF_VREQCTRL_Type), "NET.VREQCTRL"},
+    {(void *)(NRF_CLOCK_regs[NHW_CLKPWR_NET0]) ,0x41005000UL, sizeof(NRF_CLOCK_Type), "NET.CLOCK"},
+    {(void *)(NRF_POWER_regs[NHW_CLKPWR_NET0]) ,0x41005000UL, sizeof(NRF_POWER_Type), "NET.POWER"},
+    {(void *)(NRF_RESET_regs[NHW_CLKPWR_NET0]) ,0x41005000UL, sizeof(NRF_RESET_Type), "NET.RESET"},
     //{(void *)NRF_CTRLAP_NS_BASE      ,0x41006000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_RADIO_regs)                  ,0x41008000UL, sizeof(NRF_RADIO_Type)},
-    {(void *)(&NRF_RNG_regs)                    ,0x41009000UL, sizeof(NRF_RNG_Type)},
-    {(void *)(&NRF_GPIOTE_regs[NHW_GPIOTE_NET]) ,0x4100A000UL, sizeof(NRF_GPIOTE_Type)},
+    {(void *)(&NRF_RADIO_regs)                  ,0x41008000UL, sizeof(NRF_RADIO_Type), "NET.RADIO"},
+    {(void *)(&NRF_RNG_regs)                    ,0x41009000UL, sizeof(NRF_RNG_Type), "NET.RNG"},
+    {(void *)(&NRF_GPIOTE_regs[NHW_GPIOTE_NET]) ,0x4100A000UL, sizeof(NRF_GPIOTE_Type), "NET.GPIOTE"},
     //{(void *)NRF_WDT_NS_BASE         ,0x4100B000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_NET0]) ,0x4100C000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_ECB_regs)                   ,0x4100D000UL, sizeof(NRF_ECB_Type)},
-    {(void *)(&NRF_AAR_regs)                   ,0x4100E000UL, sizeof(NRF_AAR_Type)},
-    {(void *)(&NRF_CCM_regs)                   ,0x4100E000UL, sizeof(NRF_CCM_Type)},
-    {(void *)(&NRF_DPPIC_regs[NHW_DPPI_NET_0]) ,0x4100F000UL, sizeof(NRF_DPPIC_Type)},
-    {(void *)(&NRF_TEMP_regs)                  ,0x41010000UL, sizeof(NRF_TEMP_Type)},
-    {(void *)(&NRF_RTC_regs[NHW_RTC_NET0])     ,0x41011000UL, sizeof(NRF_RTC_Type)},
-    {(void *)(&NRF_IPC_regs[NHW_IPC_NET0])     ,0x41012000UL, sizeof(NRF_IPC_Type)},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_NET0]) ,0x4100C000UL, sizeof(NRF_TIMER_Type), "NET.TIMER0"},
+    {(void *)(&NRF_ECB_regs)                   ,0x4100D000UL, sizeof(NRF_ECB_Type), "NET.ECB"},
+    {(void *)(&NRF_AAR_regs)                   ,0x4100E000UL, sizeof(NRF_AAR_Type), "NET.AAR"},
+    {(void *)(&NRF_CCM_regs)                   ,0x4100E000UL, sizeof(NRF_CCM_Type), "NET.CCM"},
+    {(void *)(&NRF_DPPIC_regs[NHW_DPPI_NET_0]) ,0x4100F000UL, sizeof(NRF_DPPIC_Type), "NET.DPPIC"},
+    {(void *)(&NRF_TEMP_regs)                  ,0x41010000UL, sizeof(NRF_TEMP_Type), "NET.TEMP"},
+    {(void *)(&NRF_RTC_regs[NHW_RTC_NET0])     ,0x41011000UL, sizeof(NRF_RTC_Type), "NET.RTC0"},
+    {(void *)(&NRF_IPC_regs[NHW_IPC_NET0])     ,0x41012000UL, sizeof(NRF_IPC_Type), "NET.IPC"},
     //{(void *)NRF_SPIM0_NS_BASE       ,0x41013000UL, sizeof(NRF_*_Type), sizeof(NRF_*_Type)},
     //{(void *)NRF_SPIS0_NS_BASE       ,0x41013000UL, sizeof(NRF_*_Type), sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIM0_NS_BASE       ,0x41013000UL, sizeof(NRF_*_Type), sizeof(NRF_*_Type)},
     //{(void *)NRF_TWIS0_NS_BASE       ,0x41013000UL, sizeof(NRF_*_Type), sizeof(NRF_*_Type)},
-    {(void *)(&NRF_UARTE_regs[NHW_UARTE_NET0]) ,0x41013000UL, sizeof(NRF_UARTE_Type)},
-    {(void *)(&NRF_EGU_regs[NHW_EGU_NET0])     ,0x41014000UL, sizeof(NRF_EGU_Type)},
-    {(void *)(&NRF_RTC_regs[NHW_RTC_NET1])     ,0x41016000UL, sizeof(NRF_RTC_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_NET1]) ,0x41018000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_TIMER_regs[NHW_TIMER_NET2]) ,0x41019000UL, sizeof(NRF_TIMER_Type)},
-    {(void *)(&NRF_SWI_regs[NHW_SWI_NET0])     ,0x4101A000UL, sizeof(int)},
-    {(void *)(&NRF_SWI_regs[NHW_SWI_NET1])     ,0x4101B000UL, sizeof(int)},
-    {(void *)(&NRF_SWI_regs[NHW_SWI_NET2])     ,0x4101C000UL, sizeof(int)},
-    {(void *)(&NRF_SWI_regs[NHW_SWI_NET3])     ,0x4101D000UL, sizeof(int)},
-    {(void *)(&NRF_MUTEX_regs)                 ,0x40030000UL, sizeof(NRF_MUTEX_Type)},
-    {(void *)(&NRF_MUTEX_regs)                 ,0x50030000UL, sizeof(NRF_MUTEX_Type)},
+    {(void *)(&NRF_UARTE_regs[NHW_UARTE_NET0]) ,0x41013000UL, sizeof(NRF_UARTE_Type), "NET.UARTE0"},
+    {(void *)(&NRF_EGU_regs[NHW_EGU_NET0])     ,0x41014000UL, sizeof(NRF_EGU_Type), "NET.EGU0"},
+    {(void *)(&NRF_RTC_regs[NHW_RTC_NET1])     ,0x41016000UL, sizeof(NRF_RTC_Type), "NET.RTC1"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_NET1]) ,0x41018000UL, sizeof(NRF_TIMER_Type), "NET.TIMER1"},
+    {(void *)(&NRF_TIMER_regs[NHW_TIMER_NET2]) ,0x41019000UL, sizeof(NRF_TIMER_Type), "NET.TIMER2"},
+    {(void *)(&NRF_SWI_regs[NHW_SWI_NET0])     ,0x4101A000UL, sizeof(int), "NET.SWI0"},
+    {(void *)(&NRF_SWI_regs[NHW_SWI_NET1])     ,0x4101B000UL, sizeof(int), "NET.SWI1"},
+    {(void *)(&NRF_SWI_regs[NHW_SWI_NET2])     ,0x4101C000UL, sizeof(int), "NET.SWI2"},
+    {(void *)(&NRF_SWI_regs[NHW_SWI_NET3])     ,0x4101D000UL, sizeof(int), "NET.SWI3"},
+    {(void *)(&NRF_MUTEX_regs)                 ,0x40030000UL, sizeof(NRF_MUTEX_Type), "MUTEX_NS"},
+    {(void *)(&NRF_MUTEX_regs)                 ,0x50030000UL, sizeof(NRF_MUTEX_Type), "MUTEX_S"},
     //{(void *)NRF_ACL_NS_BASE         ,0x41080000UL, sizeof(NRF_*_Type)},
-    {(void *)(NRF_NVMC_regs_p[NHW_NVMC_NET0])  ,0x41080000UL, sizeof(NRF_NVMC_Type)},
+    {(void *)(NRF_NVMC_regs_p[NHW_NVMC_NET0])  ,0x41080000UL, sizeof(NRF_NVMC_Type), "NET.NVMC"},
     //{(void *)NRF_VMC_NS_BASE         ,0x41081000UL, sizeof(NRF_*_Type)},
-    {(void *)(&NRF_GPIO_regs[NHW_GPIO_NET_P0]) ,0x418C0500UL, sizeof(NRF_GPIO_Type)},
-    {(void *)(&NRF_GPIO_regs[NHW_GPIO_NET_P1]) ,0x418C0800UL, sizeof(NRF_GPIO_Type)},
+    {(void *)(&NRF_GPIO_regs[NHW_GPIO_NET_P0]) ,0x418C0500UL, sizeof(NRF_GPIO_Type), "NET.P0"},
+    {(void *)(&NRF_GPIO_regs[NHW_GPIO_NET_P1]) ,0x418C0800UL, sizeof(NRF_GPIO_Type), "NET.P1"},
   };
 
   *table = bs_malloc(sizeof(simu_real_conv_init));
@@ -38,8 +38,8 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     DEF_ENTRY(RRAMC, _S),
     //DEF_ENTRY(VPR, 00_NS),
     //DEF_ENTRY(VPR, 00_S),
-    {(void *)NRF_P2_NS_BASE, NRF_P2_NS_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
-    {(void *)NRF_P2_S_BASE, NRF_P2_S_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
+    {(void *)NRF_P2_NS_BASE, NRF_P2_NS_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P2_NS"},
+    {(void *)NRF_P2_S_BASE, NRF_P2_S_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P2_S"},
     //DEF_ENTRY(CTRLA, _NS),
     //DEF_ENTRY(CTRLA, _S),
     //DEF_ENTRY(TAD, _NS),
@@ -128,8 +128,8 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     DEF_ENTRY(NFCT, _S),
     DEF_ENTRY(TEMP, _NS),
     DEF_ENTRY(TEMP, _S),
-    {(void *)NRF_P1_NS_BASE, NRF_P1_NS_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
-    {(void *)NRF_P1_S_BASE, NRF_P1_S_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
+    {(void *)NRF_P1_NS_BASE, NRF_P1_NS_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P1_NS"},
+    {(void *)NRF_P1_S_BASE, NRF_P1_S_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P1_S"},
     DEF_ENTRY(GPIOTE, 20_NS),
     DEF_ENTRY(GPIOTE, 20_S),
     //DEF_ENTRY(TAMPC, _S),
@@ -163,8 +163,8 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //DEF_ENTRY(WDT, 30_S),
     //DEF_ENTRY(WDT, 31_NS),
     //DEF_ENTRY(WDT, 31_S),
-    {(void *)NRF_P0_NS_BASE, NRF_P0_NS_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
-    {(void *)NRF_P0_S_BASE, NRF_P0_S_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
+    {(void *)NRF_P0_NS_BASE, NRF_P0_NS_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P0_NS"},
+    {(void *)NRF_P0_S_BASE, NRF_P0_S_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P0_S"},
     DEF_ENTRY(GPIOTE, 30_NS),
     DEF_ENTRY(GPIOTE, 30_S),
     DEF_ENTRY(CLOCK, _NS),
@@ -54,7 +54,7 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     //DEF_ENTRY(PWM, 20),
     //DEF_ENTRY(SAADC, ),
     DEF_ENTRY(TEMP, ),
-    {(void *)NRF_P1_BASE, NRF_P1_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
+    {(void *)NRF_P1_BASE, NRF_P1_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P1"},
     DEF_ENTRY(GPIOTE, 20),
     //DEF_ENTRY(QDEC, 20),
     DEF_ENTRY(GRTC, ),
@@ -62,7 +62,7 @@ uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table) {
     DEF_ENTRY(DPPIC, 30),
     DEF_ENTRY(PPIB, 30),
     //DEF_ENTRY(WDT, 30),
-    {(void *)NRF_P0_BASE, NRF_P0_BASE_REAL_HW, sizeof(NRF_GPIO_Type)},
+    {(void *)NRF_P0_BASE, NRF_P0_BASE_REAL_HW, sizeof(NRF_GPIO_Type), "P0"},
     DEF_ENTRY(GPIOTE, 30),
     DEF_ENTRY(CLOCK, ),
     DEF_ENTRY(POWER, ),
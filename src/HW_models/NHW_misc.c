@@ -39,7 +39,7 @@ const char *nhw_get_core_name(unsigned int core_n)
 bool nhw_convert_RAM_addr(void **addr)
 {
 #if defined(NRF5340) || defined(NRF5340_XXAA_NETWORK) || defined(NRF5340_XXAA_APPLICATION)
-  if (((intptr_t)*addr >= NHW_APPCORE_RAM_ADDR) && ((intptr_t)*addr < (intptr_t)*addr + NHW_APPCORE_RAM_SIZE)) {
+  if (((intptr_t)*addr >= NHW_APPCORE_RAM_ADDR) && ((intptr_t)*addr < NHW_APPCORE_RAM_ADDR + NHW_APPCORE_RAM_SIZE)) {
      *addr = (intptr_t)*addr - NHW_APPCORE_RAM_ADDR + NHW_appcore_RAM;
      return true;
   }
@@ -87,31 +87,61 @@ void *nhw_convert_periph_base_addr(void *hw_addr) {
 }
 
 /**
- * Convert a simulated peripheral address into the real
- * HW peripheral address (like 0x4000F000UL)
+ * Like nhw_convert_per_addr_sim_to_hw() but returning NULL instead of
+ * erroring out if the address is not inside any simulated peripheral
+ */
+void *nhw_try_convert_per_addr_sim_to_hw(const void *sim_addr) {
+  for (unsigned int i = 0; i < simu_real_conv_table_size; i++) {
+    intptr_t start = (intptr_t)simu_real_conv_table[i].simu_addr;
+    intptr_t end = start + (intptr_t)simu_real_conv_table[i].size ;
+    if (((intptr_t)sim_addr >= start) && ((intptr_t)sim_addr < end)) {
+      return (void *)((intptr_t)sim_addr - start + (intptr_t)simu_real_conv_table[i].real_add);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Get the name of the simulated peripheral <sim_addr> is in (like "TIMER00_S"),
+ * and in <offset> the offset of <sim_addr> inside that peripheral registers.
+ * Returns NULL if the address is not inside any simulated peripheral
  *
  * Note that if there is both secure and non secure it will just return whichever was
  * earlier in simu_real_conv_table[].
  */
-void *nhw_convert_per_addr_sim_to_hw(void *sim_addr) {
+const char *nhw_try_per_addr_sim_to_name(const void *sim_addr, uint32_t *offset) {
   for (unsigned int i = 0; i < simu_real_conv_table_size; i++) {
     intptr_t start = (intptr_t)simu_real_conv_table[i].simu_addr;
     intptr_t end = start + (intptr_t)simu_real_conv_table[i].size ;
     if (((intptr_t)sim_addr >= start) && ((intptr_t)sim_addr < end)) {
-      return (void *)((intptr_t)sim_addr - start + (intptr_t)simu_real_conv_table[i].real_add);
+      *offset = (uint32_t)((intptr_t)sim_addr - start);
+      return simu_real_conv_table[i].name;
     }
   }
-  bs_trace_error_time_line("%s could not find %p in between the simulated peripherals\n", __func__, sim_addr); \
-  return 0;
+  return NULL;
 }
 
 /**
- * Convert a real peripheral address (like 0x4000F000UL)
- * into the equivalent simulated HW peripheral address
+ * Convert a simulated peripheral address into the real
+ * HW peripheral address (like 0x4000F000UL)
  *
- * Note that if there is both secure and non secure it will always return the secure real HW address
+ * Note that if there is both secure and non secure it will just return whichever was
+ * earlier in simu_real_conv_table[].
  */
-void *nhw_convert_per_addr_hw_to_sim(void *real_addr) {
+void *nhw_convert_per_addr_sim_to_hw(void *sim_addr) {
+  void *real_addr = nhw_try_convert_per_addr_sim_to_hw(sim_addr);
+
+  if (real_addr == NULL) {
+    bs_trace_error_time_line("%s could not find %p in between the simulated peripherals\n", __func__, sim_addr);
+  }
+  return real_addr;
+}
+
+/**
+ * Like nhw_convert_per_addr_hw_to_sim() but returning NULL instead of
+ * erroring out if the address is not inside any simulated peripheral
+ */
+void *nhw_try_convert_per_addr_hw_to_sim(const void *real_addr) {
   for (unsigned int i = 0; i < simu_real_conv_table_size; i++) {
     intptr_t start = (intptr_t)simu_real_conv_table[i].real_add;
     intptr_t end = start + (intptr_t)simu_real_conv_table[i].size ;
@@ -119,6 +149,50 @@ void *nhw_convert_per_addr_hw_to_sim(void *real_addr) {
       return (void *)((intptr_t)real_addr - start + (intptr_t)simu_real_conv_table[i].simu_addr);
     }
   }
-  bs_trace_error_time_line("%s could not find %p in between the simulated peripherals\n", __func__, real_addr); \
-  return 0;
+  return NULL;
+}
+
+/**
+ * Convert a real peripheral address (like 0x4000F000UL)
+ * into the equivalent simulated HW peripheral address
+ *
+ * Note that if there is both secure and non secure it will always return the secure real HW address
+ */
+void *nhw_convert_per_addr_hw_to_sim(void *real_addr) {
+  void *sim_addr = nhw_try_convert_per_addr_hw_to_sim(real_addr);
+
+  if (sim_addr == NULL) {
+    bs_trace_error_time_line("%s could not find %p in between the simulated peripherals\n", __func__, real_addr);
+  }
+  return sim_addr;
 }
+
+#define NHW_MAX_PRE_BLOCK_HOOKS 8
+static void (*pre_block_hooks[NHW_MAX_PRE_BLOCK_HOOKS])(void);
+static uint n_pre_block_hooks;
+
+/*
+ * Register a function to be called before this device may block waiting for another process
+ * (the Phy, or another device thru a point to point link, like the UART FIFO backend or the
+ * GPIO bus).
+ * Backends which buffer messages towards other devices register one to send them, as the
+ * other device may be blocked waiting for those messages, which would otherwise deadlock.
+ */
+void nhw_register_pre_block_hook(void (*hook)(void))
+{
+  if (n_pre_block_hooks >= NHW_MAX_PRE_BLOCK_HOOKS) {
+    bs_trace_error_line("%s: Too many hooks registered\n", __func__);
+  }
+  pre_block_hooks[n_pre_block_hooks++] = hook;
+}
+
+/*
+ * To be called by any model before it may block waiting for another process
+ */
+void nhw_pre_block(void)
+{
+  for (uint i = 0; i < n_pre_block_hooks; i++) {
+    pre_block_hooks[i]();
+  }
+}
+
@@ -7,6 +7,7 @@
 #ifndef _NRF_HW_MODEL_NHW_MISC_H
 #define _NRF_HW_MODEL_NHW_MISC_H
 
+#include <stdint.h>
 #include <stdbool.h>
 
 #ifdef __cplusplus
@@ -14,12 +15,18 @@ extern "C" {
 #endif
 
 const char *nhw_get_core_name(unsigned int core_n);
-void *nhw_convert_RAM_addr(void *ram_addr);
+bool nhw_convert_RAM_addr(void **addr);
 
 void *nhw_convert_per_addr_sim_to_hw(void *sim_addr);
+void *nhw_try_convert_per_addr_sim_to_hw(const void *sim_addr);
+const char *nhw_try_per_addr_sim_to_name(const void *sim_addr, uint32_t *offset);
 void *nhw_convert_per_addr_hw_to_sim(void *real_addr);
+void *nhw_try_convert_per_addr_hw_to_sim(const void *real_addr);
 void *nhw_convert_periph_base_addr(void *hw_addr);
 
+void nhw_register_pre_block_hook(void (*hook)(void));
+void nhw_pre_block(void);
+
 #ifdef __cplusplus
 }
 #endif
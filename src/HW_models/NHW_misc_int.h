@@ -14,12 +14,14 @@
 #include "NHW_peri_types.h"
 
 #define DEF_ENTRY(peri, suf) \
-    {(void *)NRF_##peri##suf##_BASE,  NRF_##peri##suf##_BASE_REAL_HW, sizeof(NRF_##peri##_Type)}
+    {(void *)NRF_##peri##suf##_BASE,  NRF_##peri##suf##_BASE_REAL_HW, sizeof(NRF_##peri##_Type), \
+     #peri #suf}
 
 struct simu_real_conv_table_t {
   void* simu_addr;
   uint32_t real_add;
   uint32_t size;
+  const char *name; /* Peripheral name, like in the MDK (e.g. "TIMER00_S") */
 };
 
 uint nhw_get_simu_real_conv_table(struct simu_real_conv_table_t **table);
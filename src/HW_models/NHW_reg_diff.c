@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Register diff helper: dump the peripherals registers to a file, or compare them with
+ * a dump from a previous run
+ *
+ * A dump contains all peripherals registers (as listed in the peripherals address
+ * conversion table), one block per peripheral.
+ * Register values which are the address of a simulated peripheral register (like the PPI
+ * channels EEP and TEP) are stored as the real HW address, so they do not depend on where
+ * the registers happened to be placed in this run.
+ *
+ * With -reg_diff_save=<path> the registers are dumped to a file, and with
+ * -reg_diff_check=<path> they are compared to a dump saved in a previous run,
+ * reporting which peripherals (and at which register address) differ.
+ * By default this is done at exit, or at the simulated time given with -reg_diff_time=<us>.
+ * This is meant to check that changes to the models or their build (for ex. optimizations)
+ * do not change their behavior as seen thru the registers.
+ *
+ * The file format is:
+ *   "NHWREGD\0", version (uint32), simulated time (uint64), number of blocks (uint32),
+ *   and then for each block: name length (uint16), name, size (uint32), content.
+ * All in host byte order.
+ *
+ * Note this is not a checkpoint: the models internal state (timers, counters, state machines)
+ * is not saved, and nothing can be restored.
+ */
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "bs_types.h"
+#include "bs_tracing.h"
+#include "bs_oswrap.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
+#include "nsi_tasks.h"
+#include "nsi_hw_scheduler.h"
+#include "nsi_hws_models_if.h"
+#include "NHW_misc.h"
+#include "NHW_misc_int.h"
+#include "NHW_hws_profiler.h"
+
+#define REG_DIFF_MAGIC "NHWREGD"
+#define REG_DIFF_VERSION 1
+
+struct reg_diff_block {
+  char name[48];
+  const void *ptr;
+  uint32_t size;
+  uint32_t real_addr; /* Real HW address of the registers */
+};
+
+static char *reg_diff_save_path;
+static char *reg_diff_check_path;
+static double reg_diff_time_arg = -1;
+static bool reg_diff_done;
+
+static struct reg_diff_block *reg_diff_blocks;
+static uint reg_diff_n_blocks;
+
+static bs_time_t Timer_reg_diff = TIME_NEVER;
+
+static void reg_diff_add_block(const char *name, const void *ptr, size_t size, uint32_t real_addr) {
+  reg_diff_blocks = (struct reg_diff_block *)bs_realloc(reg_diff_blocks,
+                                  (reg_diff_n_blocks + 1) * sizeof(struct reg_diff_block));
+  snprintf(reg_diff_blocks[reg_diff_n_blocks].name, sizeof(reg_diff_blocks[0].name), "%s", name);
+  reg_diff_blocks[reg_diff_n_blocks].ptr = ptr;
+  reg_diff_blocks[reg_diff_n_blocks].size = size;
+  reg_diff_blocks[reg_diff_n_blocks].real_addr = real_addr;
+  reg_diff_n_blocks++;
+}
+
+/*
+ * Add all peripherals registers to the list of blocks
+ * (if several real addresses map to the same registers, like the secure and non secure ones,
+ * they are only added once)
+ */
+static void reg_diff_add_registers(void) {
+  struct simu_real_conv_table_t *table;
+  uint n = nhw_get_simu_real_conv_table(&table);
+
+  for (uint i = 0; i < n; i++) {
+    bool dup = false;
+    char name[32];
+
+    if (table[i].simu_addr == NULL) {
+      continue;
+    }
+    for (uint j = 0; j < i; j++) {
+      if (table[j].simu_addr == table[i].simu_addr) {
+        dup = true;
+        break;
+      }
+    }
+    if (dup) {
+      continue;
+    }
+    snprintf(name, sizeof(name), "regs@0x%08"PRIX32, table[i].real_add);
+    reg_diff_add_block(name, table[i].simu_addr, table[i].size, table[i].real_add);
+  }
+  free(table);
+}
+
+/*
+ * Copy a block content into <buf>, replacing the register values which are simulated
+ * peripheral addresses with the corresponding real HW address.
+ * (With 64 bit builds addresses do not fit in the registers, so there is nothing to replace)
+ */
+static void reg_diff_get_content(const struct reg_diff_block *block, uint8_t *buf) {
+  memcpy(buf, block->ptr, block->size);
+
+  if (sizeof(void *) != sizeof(uint32_t)) {
+    return;
+  }
+  for (uint32_t off = 0; off + sizeof(uint32_t) <= block->size; off += sizeof(uint32_t)) {
+    uint32_t value;
+    void *real_addr;
+
+    memcpy(&value, &buf[off], sizeof(uint32_t));
+    real_addr = nhw_try_convert_per_addr_sim_to_hw((void *)(uintptr_t)value);
+    if (real_addr != NULL) {
+      value = (uint32_t)(uintptr_t)real_addr;
+      memcpy(&buf[off], &value, sizeof(uint32_t));
+    }
+  }
+}
+
+static void reg_diff_write_or_fail(const void *ptr, size_t size, FILE *f) {
+  if (fwrite(ptr, size, 1, f) != 1) {
+    bs_trace_error_line("Failed to write the register dump to %s (%i, %s)\n",
+                        reg_diff_save_path, errno, strerror(errno));
+  }
+}
+
+static void reg_diff_save(bs_time_t now) {
+  FILE *f = bs_fopen(reg_diff_save_path, "wb");
+  uint32_t version = REG_DIFF_VERSION;
+
+  reg_diff_write_or_fail(REG_DIFF_MAGIC, sizeof(REG_DIFF_MAGIC), f);
+  reg_diff_write_or_fail(&version, sizeof(version), f);
+  reg_diff_write_or_fail(&now, sizeof(now), f);
+  reg_diff_write_or_fail(&reg_diff_n_blocks, sizeof(uint32_t), f);
+  for (uint i = 0; i < reg_diff_n_blocks; i++) {
+    uint16_t name_len = strlen(reg_diff_blocks[i].name);
+    uint8_t *content = (uint8_t *)bs_malloc(reg_diff_blocks[i].size ? reg_diff_blocks[i].size : 1);
+
+    reg_diff_get_content(&reg_diff_blocks[i], content);
+    reg_diff_write_or_fail(&name_len, sizeof(name_len), f);
+    reg_diff_write_or_fail(reg_diff_blocks[i].name, name_len, f);
+    reg_diff_write_or_fail(&reg_diff_blocks[i].size, sizeof(uint32_t), f);
+    reg_diff_write_or_fail(content, reg_diff_blocks[i].size, f);
+    free(content);
+  }
+  fclose(f);
+}
+
+static bool reg_diff_read(FILE *f, void *ptr, size_t size) {
+  return fread(ptr, size, 1, f) == 1;
+}
+
+static struct reg_diff_block *reg_diff_find_block(const char *name) {
+  for (uint i = 0; i < reg_diff_n_blocks; i++) {
+    if (strcmp(reg_diff_blocks[i].name, name) == 0) {
+      return &reg_diff_blocks[i];
+    }
+  }
+  return NULL;
+}
+
+static void reg_diff_check(bs_time_t now) {
+  FILE *f = bs_fopen(reg_diff_check_path, "rb");
+  char magic[sizeof(REG_DIFF_MAGIC)];
+  uint32_t version, n_blocks;
+  bs_time_t then;
+  uint n_diffs = 0;
+
+  if (!reg_diff_read(f, magic, sizeof(magic)) || memcmp(magic, REG_DIFF_MAGIC, sizeof(magic))
+      || !reg_diff_read(f, &version, sizeof(version)) || !reg_diff_read(f, &then, sizeof(then))
+      || !reg_diff_read(f, &n_blocks, sizeof(n_blocks))) {
+    bs_trace_error_line("%s is not a register dump file\n", reg_diff_check_path);
+  }
+  if (version != REG_DIFF_VERSION) {
+    bs_trace_error_line("Register dump %s has version %"PRIu32", expected %i\n",
+                        reg_diff_check_path, version, REG_DIFF_VERSION);
+  }
+  if (then != now) {
+    bs_trace_warning_line("Register dump %s was taken at %"PRItime", but this one at "
+                          "%"PRItime"\n",
+                          reg_diff_check_path, then, now);
+  }
+
+  for (uint i = 0; i < n_blocks; i++) {
+    uint16_t name_len;
+    uint32_t size;
+    char *name;
+    uint8_t *content, *current = NULL;
+    struct reg_diff_block *block;
+
+    if (!reg_diff_read(f, &name_len, sizeof(name_len))) {
+      bs_trace_error_line("Register dump %s is truncated\n", reg_diff_check_path);
+    }
+    name = (char *)bs_calloc(name_len + 1, 1);
+    if (!reg_diff_read(f, name, name_len) || !reg_diff_read(f, &size, sizeof(size))) {
+      bs_trace_error_line("Register dump %s is truncated\n", reg_diff_check_path);
+    }
+    content = (uint8_t *)bs_malloc(size ? size : 1);
+    if (!reg_diff_read(f, content, size)) {
+      bs_trace_error_line("Register dump %s is truncated\n", reg_diff_check_path);
+    }
+
+    block = reg_diff_find_block(name);
+    if (block == NULL) {
+      bs_trace_raw(2, "Register diff: %s is not present in this run\n", name);
+      n_diffs++;
+    } else if (block->size != size) {
+      bs_trace_raw(2, "Register diff: %s has a different size (%"PRIu32" != %"PRIu32")\n",
+                   name, size, block->size);
+      n_diffs++;
+    } else {
+      current = (uint8_t *)bs_malloc(size ? size : 1);
+      reg_diff_get_content(block, current);
+      if (memcmp(current, content, size) != 0) {
+        uint32_t off = 0;
+
+        while (current[off] == content[off]) {
+          off++;
+        }
+        off &= ~3; /* Report the 32bit word */
+        bs_trace_raw(2, "Register diff: %s differs, first at 0x%08"PRIX32"\n",
+                     name, block->real_addr + off);
+        n_diffs++;
+      }
+    }
+    free(name);
+    free(content);
+    free(current);
+  }
+  fclose(f);
+
+  if (n_diffs == 0) {
+    bs_trace_raw(2, "Register diff: identical to %s (%"PRIu32" blocks)\n",
+                 reg_diff_check_path, n_blocks);
+  } else {
+    bs_trace_raw(2, "Register diff: %u blocks differ from %s\n", n_diffs, reg_diff_check_path);
+  }
+}
+
+static void reg_diff_take(void) {
+  bs_time_t now = nsi_hws_get_time();
+
+  if (reg_diff_done) {
+    return;
+  }
+  reg_diff_done = true;
+
+  reg_diff_add_registers();
+  if (reg_diff_save_path) {
+    reg_diff_save(now);
+  }
+  if (reg_diff_check_path) {
+    reg_diff_check(now);
+  }
+}
+
+static void nhw_reg_diff_timer_triggered(void) {
+  Timer_reg_diff = TIME_NEVER;
+  nsi_hws_find_next_event();
+  reg_diff_take();
+}
+
+NHW_HW_EVENT(Timer_reg_diff, nhw_reg_diff_timer_triggered, 999 /* After all models */);
+
+static void nhw_reg_diff_init(void) {
+  if ((reg_diff_save_path || reg_diff_check_path) && (reg_diff_time_arg >= 0)) {
+    Timer_reg_diff = (bs_time_t)reg_diff_time_arg;
+  }
+}
+
+NSI_TASK(nhw_reg_diff_init, HW_INIT, 999);
+
+static void nhw_reg_diff_on_exit(void) {
+  if (reg_diff_save_path || reg_diff_check_path) {
+    reg_diff_take();
+  }
+}
+
+NSI_TASK(nhw_reg_diff_on_exit, ON_EXIT_PRE, 2); /* Before the models tear down */
+
+static void nhw_reg_diff_free(void) {
+  free(reg_diff_blocks);
+  reg_diff_blocks = NULL;
+  reg_diff_n_blocks = 0;
+}
+
+NSI_TASK(nhw_reg_diff_free, ON_EXIT_POST, 100);
+
+static void nhw_reg_diff_register_cmdline(void) {
+  static bs_args_struct_t args[] = {
+    { .option = "reg_diff_save",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&reg_diff_save_path,
+      .descript = "Dump all peripherals registers into this file (at exit, "
+                  "or at -reg_diff_time)"
+    },
+    { .option = "reg_diff_check",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&reg_diff_check_path,
+      .descript = "Compare the peripherals registers (at exit, or at -reg_diff_time) with the "
+                  "dump saved in this file, and report the differences"
+    },
+    { .option = "reg_diff_time",
+      .name = "time",
+      .type = 'd',
+      .dest = (void *)&reg_diff_time_arg,
+      .descript = "Simulated time (in microseconds) at which to dump/compare the registers"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args);
+}
+
+NSI_TASK(nhw_reg_diff_register_cmdline, PRE_BOOT_1, 200);
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Register accesses profiler
+ *
+ * When enabled with the command line option -reg_profile, each call to a replacement
+ * nRFx HAL function (those in src/nrfx/hal/ which cause a register side-effect,
+ * or read a register whose value the models need to compute on the fly) is counted,
+ * per function and peripheral instance/register.
+ * Event register reads thru the nRFx HAL are counted too, as they all go thru
+ * nrf_event_check() (replaced in src/nrfx/hal/nrf_common.c).
+ * At exit the most called ones are printed, with the register given by its real HW address.
+ *
+ * This is meant to find SW which polls the HW (for example reading a counter in a loop),
+ * which is very costly for the simulation.
+ */
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bs_tracing.h"
+#include "bs_oswrap.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
+#include "nsi_tasks.h"
+#include "nsi_utils.h"
+#include "NHW_misc.h"
+#include "NHW_reg_profiler.h"
+
+#define REG_PROF_INITIAL_SIZE 256 /* Must be a power of 2 */
+#define REG_PROF_DEFAULT_TOP 40
+
+struct reg_prof_entry {
+  const char *func;
+  const void *reg;
+  uint64_t count;
+};
+
+bool nhw_reg_prof_enabled;
+static uint reg_prof_top = REG_PROF_DEFAULT_TOP;
+
+/* Open addressing hash table of the function+register combinations called so far */
+static struct reg_prof_entry *reg_prof_table;
+static uint reg_prof_size;
+static uint reg_prof_used;
+static uint64_t reg_prof_total;
+
+static inline uint reg_prof_hash(const char *func, const void *reg) {
+  uint64_t h = ((uintptr_t)func * 0x9E3779B97F4A7C15ULL) ^ ((uintptr_t)reg * 0xC2B2AE3D27D4EB4FULL);
+  return (uint)(h ^ (h >> 29));
+}
+
+static struct reg_prof_entry *reg_prof_find(const char *func, const void *reg) {
+  uint i = reg_prof_hash(func, reg) & (reg_prof_size - 1);
+
+  while ((reg_prof_table[i].func != NULL)
+         && ((reg_prof_table[i].func != func) || (reg_prof_table[i].reg != reg))) {
+    i = (i + 1) & (reg_prof_size - 1);
+  }
+  return &reg_prof_table[i];
+}
+
+static void reg_prof_grow(void) {
+  struct reg_prof_entry *old_table = reg_prof_table;
+  uint old_size = reg_prof_size;
+
+  reg_prof_size *= 2;
+  reg_prof_table = (struct reg_prof_entry *)bs_calloc(reg_prof_size, sizeof(struct reg_prof_entry));
+  for (uint i = 0; i < old_size; i++) {
+    if (old_table[i].func != NULL) {
+      *reg_prof_find(old_table[i].func, old_table[i].reg) = old_table[i];
+    }
+  }
+  free(old_table);
+}
+
+void nhw_reg_prof_count(const char *func, const void *reg) {
+  struct reg_prof_entry *entry = reg_prof_find(func, reg);
+
+  if (entry->func == NULL) {
+    if ((reg_prof_used + 1) * 2 > reg_prof_size) { /* Keep the load factor under 1/2 */
+      reg_prof_grow();
+      entry = reg_prof_find(func, reg);
+    }
+    entry->func = func;
+    entry->reg = reg;
+    reg_prof_used++;
+  }
+  entry->count++;
+  reg_prof_total++;
+}
+
+static int reg_prof_cmp_count(const void *a, const void *b) {
+  const struct reg_prof_entry *ea = (const struct reg_prof_entry *)a;
+  const struct reg_prof_entry *eb = (const struct reg_prof_entry *)b;
+
+  if (ea->count != eb->count) {
+    return ea->count < eb->count ? 1 : -1;
+  }
+  return strcmp(ea->func, eb->func);
+}
+
+static void nhw_reg_prof_dump(void) {
+  uint n = 0;
+
+  if (!nhw_reg_prof_enabled) {
+    return;
+  }
+  nhw_reg_prof_enabled = false;
+
+  /* Compact the table in place and sort it */
+  for (uint i = 0; i < reg_prof_size; i++) {
+    if (reg_prof_table[i].func != NULL) {
+      reg_prof_table[n++] = reg_prof_table[i];
+    }
+  }
+  qsort(reg_prof_table, n, sizeof(struct reg_prof_entry), reg_prof_cmp_count);
+
+  bs_trace_raw(2, "Register accesses profile (%"PRIu64" HAL calls, %u function/register combinations):\n",
+               reg_prof_total, n);
+  bs_trace_raw(2, "%14s %6s  %-12s %s\n", "calls", "%", "register", "function");
+  for (uint i = 0; i < n && (reg_prof_top == 0 || i < reg_prof_top); i++) {
+    struct reg_prof_entry *e = &reg_prof_table[i];
+    void *real_addr = nhw_try_convert_per_addr_sim_to_hw(e->reg);
+    char reg_str[20];
+
+    if (real_addr) {
+      snprintf(reg_str, sizeof(reg_str), "0x%08"PRIXPTR, (uintptr_t)real_addr);
+    } else {
+      snprintf(reg_str, sizeof(reg_str), "%p", e->reg);
+    }
+    bs_trace_raw(2, "%14"PRIu64" %6.2f  %-12s %s\n", e->count,
+                 (double)e->count * 100 / reg_prof_total, reg_str, e->func);
+  }
+  if (reg_prof_top != 0 && n > reg_prof_top) {
+    bs_trace_raw(2, "(%u less called function/register combinations not shown)\n", n - reg_prof_top);
+  }
+}
+
+NSI_TASK(nhw_reg_prof_dump, ON_EXIT_PRE, 1); /* Before the models tear down */
+
+static void nhw_reg_prof_free(void) {
+  free(reg_prof_table);
+  reg_prof_table = NULL;
+}
+
+NSI_TASK(nhw_reg_prof_free, ON_EXIT_POST, 100);
+
+static void nhw_reg_prof_register_cmdline(void) {
+  static bs_args_struct_t args[] = {
+    { .is_switch = true,
+      .option = "reg_profile",
+      .type = 'b',
+      .dest = (void *)&nhw_reg_prof_enabled,
+      .descript = "Count the SW accesses to the HW models registers done thru the nRFx HAL, "
+                  "and print the most frequent ones at exit"
+    },
+    { .option = "reg_profile_top",
+      .name = "n",
+      .type = 'u',
+      .dest = (void *)&reg_prof_top,
+      .descript = "(By default " NSI_STRINGIFY(REG_PROF_DEFAULT_TOP) ") How many entries of the "
+                  "register accesses profile to print. 0 means all"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args);
+}
+
+NSI_TASK(nhw_reg_prof_register_cmdline, PRE_BOOT_1, 200);
+
+static void nhw_reg_prof_post_cmdline(void) {
+  if (nhw_reg_prof_enabled) {
+    reg_prof_size = REG_PROF_INITIAL_SIZE;
+    reg_prof_table = (struct reg_prof_entry *)bs_calloc(reg_prof_size, sizeof(struct reg_prof_entry));
+  }
+}
+
+NSI_TASK(nhw_reg_prof_post_cmdline, PRE_BOOT_2, 200);
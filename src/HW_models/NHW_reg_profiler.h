@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Optional counting of the SW accesses to the HW models registers done thru the
+ * replacement nRFx HAL functions.
+ * Check NHW_reg_profiler.c for more info.
+ */
+
+#ifndef _NRF_HW_MODEL_NHW_REG_PROFILER_H
+#define _NRF_HW_MODEL_NHW_REG_PROFILER_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+extern bool nhw_reg_prof_enabled;
+
+void nhw_reg_prof_count(const char *func, const void *reg);
+
+/*
+ * Account for one call to the current HAL function, accessing the register <reg>
+ * (or if the function accesses several, the peripheral base address)
+ */
+#define NHW_REG_PROF(reg) \
+  do { \
+    if (nhw_reg_prof_enabled) { \
+      nhw_reg_prof_count(__func__, (const void *)(reg)); \
+    } \
+  } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NRF_HW_MODEL_NHW_REG_PROFILER_H */
@@ -52,8 +52,8 @@
 #define NHW_SIDEEFFECTS_SUBSCRIBE_si(peri, task) \
   void nhw_##peri##_regw_sideeffects_SUBSCRIBE_##task(unsigned int inst) { \
     static struct nhw_subsc_mem task##_subscribed[NHW_##peri##_TOTAL_INST]; \
-    nhw_dppi_common_subscribe_sideeffect(nhw_##peri##_dppi_map[inst], \
-        NRF_##peri##_regs.SUBSCRIBE_##task, \
+    nhw_dppi_common_subscribe_sideeffect_reg(nhw_##peri##_dppi_map[inst], \
+        &NRF_##peri##_regs.SUBSCRIBE_##task, \
         &task##_subscribed[inst], \
         (dppi_callback_t)nhw_##peri##_TASK_##task, \
         DPPI_CB_NO_PARAM); \
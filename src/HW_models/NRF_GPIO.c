@@ -75,6 +75,7 @@
 #include "NHW_config.h"
 #include "NHW_peri_types.h"
 #include "NRF_GPIO.h"
+#include "NRF_GPIO_backend_bus.h"
 #include "NRF_GPIOTE.h"
 #include "bs_tracing.h"
 #include "nsi_tasks.h"
@@ -115,6 +116,7 @@ struct gpio_status {
   /* Callbacks for peripherals to be informed of input changes */
   nrf_gpio_input_callback_hw_t per_intoggle_callbacks[NHW_GPIO_MAX_PINS_PER_PORT];
   void *per_intoggle_cb_data[NHW_GPIO_MAX_PINS_PER_PORT];
+  uint32_t per_intoggle_cb_mask; /* Pins which have a callback in per_intoggle_callbacks */
 
   int nbr_pins;
   int partner_GPIOTE;
@@ -286,6 +288,8 @@ void nrf_gpio_peri_pin_control(unsigned int port, unsigned int n,
   }
   st->per_intoggle_callbacks[n] = fptr;
   st->per_intoggle_cb_data[n] = fptr_data;
+  st->per_intoggle_cb_mask &= ~mask;
+  st->per_intoggle_cb_mask |= (uint32_t)(fptr != NULL) << n;
   if (new_level >= 0) {
     st->external_OUT &= ~((uint32_t)1 << n);
     st->external_OUT |= (uint32_t)(new_level?1:0) << n;
@@ -357,7 +361,8 @@ static void nrf_gpio_update_detect_signal(unsigned int port) {
 static void nrf_gpio_eval_sense(unsigned int port){
   struct gpio_status *st = &gpio_st[port];
 
-  if (!st->has_sense) {
+  if (!st->has_sense || ((st->SENSE_mask | st->DETECT | st->LDETECT) == 0)) {
+    /* Nothing can change */
     return;
   }
 
@@ -430,6 +435,16 @@ static void nrf_gpio_eval_inputs(unsigned int port)
 
   NRF_GPIO_regs[port].IN = new_IN;
 
+  if (diff == 0) {
+    return;
+  }
+
+  /* The GPIOTE channels are resolved for all pins at once */
+  nrf_gpiote_port_inputs_change(port, diff, new_IN);
+
+  if (test_intoggle_callback == NULL) {
+    diff &= gpio_st[port].per_intoggle_cb_mask;
+  }
   for (int n = __builtin_ffs(diff) - 1; n >= 0; n = __builtin_ffs(diff) - 1) {
     nrf_gpio_input_change_sideeffects(port, n);
     diff &= ~(1 << n);
@@ -476,6 +491,43 @@ void nrf_gpio_eval_input(unsigned int port, unsigned int n, bool value)
   nrf_gpio_eval_inputs(port);
 }
 
+/*
+ * Several inputs of a port *may* be changing at the same time.
+ * This is equivalent to calling nrf_gpio_eval_input() for each pin in <mask>,
+ * but the port inputs are only evaluated once.
+ *
+ * Inputs:
+ *  * port is the GPIO port
+ *  * mask: which pins in that GPIO port are being driven
+ *  * values: new levels of those pins (bits outside of mask are ignored)
+ */
+void nrf_gpio_eval_inputs_masked(unsigned int port, uint32_t mask, uint32_t values)
+{
+  uint32_t driven = get_dir(port) & mask;
+
+  if (driven) { /* LCOV_EXCL_START */
+    mask &= ~driven;
+    for (int n = __builtin_ffs(driven) - 1; n >= 0; n = __builtin_ffs(driven) - 1) {
+      bs_trace_warning_time_line("%s: Attempted to drive externally a pin which is "
+          "currently being driven by the SOC. It will be ignored."
+          "GPIO port %i, pin %i\n",
+          __func__, port, n);
+      driven &= ~((uint32_t)1 << n);
+    }
+  } /* LCOV_EXCL_STOP */
+
+  uint32_t diff = (gpio_st[port].IO_level ^ values) & mask;
+
+  if (diff == 0) {
+    /* No toggle */
+    return;
+  }
+
+  gpio_st[port].IO_level ^= diff;
+
+  nrf_gpio_eval_inputs(port);
+}
+
 /*
  * The output is being changed, propagate it as necessary and/or record it.
  */
@@ -485,7 +537,6 @@ static void nrf_gpio_output_change_sideeffects(unsigned int port,unsigned  int n
   if (test_outtoggle_callback != NULL) {
     test_outtoggle_callback(port, n, value);
   }
-  nrf_gpio_backend_short_propagate(port, n, value);
 }
 
 /*
@@ -514,10 +565,15 @@ static void nrf_gpio_eval_outputs(unsigned int port)
   st->IO_level &= ~dir;
   st->IO_level |= st->O_level;
 
+  uint32_t changed = diff;
+
   for (int n = __builtin_ffs(diff) - 1; n >= 0; n = __builtin_ffs(diff) - 1) {
     nrf_gpio_output_change_sideeffects(port, n, (new_output >> n) & 0x1);
     diff &= ~(1 << n);
   }
+  /* All the changed pins shorted to the same port are propagated at once */
+  nrf_gpio_backend_short_propagate(port, changed, new_output);
+  nrf_gpio_bus_propagate(port, changed, new_output);
 
   /* Inputs may be connected to pins driven by outputs, let's check */
   nrf_gpio_eval_inputs(port);
@@ -52,6 +52,7 @@ void nrf_gpio_regw_sideeffects_DETECTMODE(unsigned int port);
 void nrf_gpio_regw_sideeffects_PIN_CNF(unsigned int port,unsigned  int n);
 
 void nrf_gpio_eval_input(unsigned int port, unsigned int n, bool value);
+void nrf_gpio_eval_inputs_masked(unsigned int port, uint32_t mask, uint32_t values);
 
 #ifdef __cplusplus
 }
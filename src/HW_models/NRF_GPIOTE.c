@@ -72,6 +72,14 @@ struct gpiote_ch_status_t {
 struct gpiote_status {
   struct gpiote_ch_status_t gpiote_ch_status[NHW_GPIOTE_MAX_CHANNELS];
   uint n_channels;
+  /*
+   * Channels in event mode, as masks of the pins they monitor in each GPIO port:
+   * Pins whose rising (evt_rise) or falling (evt_fall) edge generates an EVENTS_IN
+   */
+  uint32_t evt_rise[NHW_GPIO_TOTAL_INST];
+  uint32_t evt_fall[NHW_GPIO_TOTAL_INST];
+  uint8_t pin_ch[NHW_GPIO_TOTAL_INST][NHW_GPIO_MAX_PINS_PER_PORT]; /* Channel monitoring each pin */
+  uint32_t EVENTS_IN_mask; /* EVENTS_IN[] as a bitmask */
   uint32_t GPIOTE_ITEN[NHW_GPIOTE_N_INT];
   bool gpiote_int_line[NHW_GPIOTE_N_INT]; /* Is the GPIOTE currently driving its interrupt line high */
 #if (NHW_HAS_DPPI)
@@ -82,6 +90,8 @@ struct gpiote_status {
 #endif
 };
 static struct gpiote_status gpiote_st[NHW_GPIOTE_TOTAL_INST];
+/* For each GPIO port, pins monitored by any GPIOTE channel in event mode */
+static uint32_t gpiote_monitored_pins[NHW_GPIO_TOTAL_INST];
 
 /**
  * Initialize the GPIOs model
@@ -170,15 +180,8 @@ static void nrf_gpiote_eval_interrupt(unsigned int inst) {
   int mask;
 
   for (int line= 0; line < NHW_GPIOTE_N_INT; line ++) {
-    new_int_line = false;
-
-    for (uint i = 0; i < st->n_channels; i++) {
-      mask = (st->GPIOTE_ITEN[line] >> i) & 0x1;
-      if (NRF_GPIOTE_regs[inst].EVENTS_IN[i] && mask) {
-        new_int_line = true;
-        break; /* No need to check more */
-      }
-    }
+    /* Note the INTEN.IN[n] bits are the n lowest ones */
+    new_int_line = (st->EVENTS_IN_mask & st->GPIOTE_ITEN[line]) != 0;
 
 #if !NHW_GPIOTE_IS_54
     mask = (st->GPIOTE_ITEN[line] & GPIOTE_INTENCLR_PORT_Msk) >> GPIOTE_INTENCLR_PORT_Pos;
@@ -204,15 +207,31 @@ static void nrf_gpiote_eval_interrupt(unsigned int inst) {
   }
 }
 
-static void nhw_GPIOTE_signal_EVENTS_IN(unsigned int inst, unsigned int n) {
-  NRF_GPIOTE_regs[inst].EVENTS_IN[n] = 1;
+/*
+ * Signal the EVENTS_IN of several channels at the same time
+ *
+ * Inputs:
+ *  * inst: GPIOTE instance
+ *  * chs: channels, in the order their events are to be published
+ *  * n_chs: number of channels in chs
+ */
+static void nhw_GPIOTE_signal_EVENTS_IN(unsigned int inst, const uint8_t *chs, uint n_chs) {
+  struct gpiote_status *st = &gpiote_st[inst];
+
+  for (uint i = 0; i < n_chs; i++) {
+    NRF_GPIOTE_regs[inst].EVENTS_IN[chs[i]] = 1;
+    st->EVENTS_IN_mask |= (uint32_t)1 << chs[i];
+  }
   nrf_gpiote_eval_interrupt(inst);
+
+  for (uint i = 0; i < n_chs; i++) {
 #if (NHW_HAS_PPI)
-  nrf_ppi_event(GPIOTE_EVENTS_IN_0 + n);
+    nrf_ppi_event(GPIOTE_EVENTS_IN_0 + chs[i]);
 #elif (NHW_HAS_DPPI)
-  nhw_dppi_event_signal_if(gpiote_st[inst].dppi_map,
-                           NRF_GPIOTE_regs[inst].PUBLISH_IN[n]);
+    nhw_dppi_event_signal_if(st->dppi_map,
+                             NRF_GPIOTE_regs[inst].PUBLISH_IN[chs[i]]);
 #endif
+  }
 }
 
 static void nhw_GPIOTE_signal_EVENTS_PORT(unsigned int inst) {
@@ -245,47 +264,95 @@ static void nhw_GPIOTE_signal_EVENTS_PORT(unsigned int inst) {
 }
 
 /*
- * Function to be called (by the GPIO model) when a pin changes
- * for which an EVENTS_IN is registered
+ * API for the GPIO models, to be called when the inputs (IN) of a port change
+ *
+ * All GPIOTE channels monitoring pins of this port are resolved at once.
+ *
+ * Inputs:
+ *  * port: GPIO port whose inputs changed
+ *  * changed: mask of the pins which changed
+ *  * in: new IN value of the port
+ */
+void nrf_gpiote_port_inputs_change(unsigned int port, uint32_t changed, uint32_t in) {
+  changed &= gpiote_monitored_pins[port];
+  if (changed == 0) {
+    return;
+  }
+
+  for (int inst = 0; inst < NHW_GPIOTE_TOTAL_INST; inst++) {
+    struct gpiote_status *st = &gpiote_st[inst];
+    uint32_t events = (changed & in & st->evt_rise[port])
+                      | (changed & ~in & st->evt_fall[port]);
+    uint8_t chs[NHW_GPIOTE_MAX_CHANNELS];
+    uint n_chs = 0;
+
+    for (int n = __builtin_ffs(events) - 1; n >= 0; n = __builtin_ffs(events) - 1) {
+      chs[n_chs++] = st->pin_ch[port][n];
+      events &= ~((uint32_t)1 << n);
+    }
+    if (n_chs > 0) {
+      nhw_GPIOTE_signal_EVENTS_IN(inst, chs, n_chs);
+    }
+  }
+}
+
+static void nrf_gpiote_update_monitored_pins(unsigned int port) {
+  gpiote_monitored_pins[port] = 0;
+  for (int inst = 0; inst < NHW_GPIOTE_TOTAL_INST; inst++) {
+    gpiote_monitored_pins[port] |= gpiote_st[inst].evt_rise[port] | gpiote_st[inst].evt_fall[port];
+  }
+}
+
+/*
+ * Stop monitoring the channel pin, if the channel is in event mode
+ * (to be called before its configuration changes)
  */
-static void nrf_gpiote_input_change_ntf(unsigned int port, unsigned int pin_n, bool value, void *cb_data)
-{
-  (void)port;
-  (void)pin_n; /* Unused */
-  uint inst = (intptr_t)cb_data >> 8;
-  int ch_n = (intptr_t)cb_data & 0xFF;
-  struct gpiote_ch_status_t *sc;
-  bool generate_event = false;
+static void nrf_gpiote_channel_event_unmap(unsigned int inst, unsigned int ch_n) {
+  struct gpiote_status *st = &gpiote_st[inst];
+  struct gpiote_ch_status_t *sc = &st->gpiote_ch_status[ch_n];
+  uint32_t pin_mask = (uint32_t)1 << sc->pin;
+
+  if ((sc->mode != GPIOTE_CONFIG_MODE_Event) || (st->pin_ch[sc->port][sc->pin] != ch_n)) {
+    return;
+  }
+  st->evt_rise[sc->port] &= ~pin_mask;
+  st->evt_fall[sc->port] &= ~pin_mask;
+  nrf_gpiote_update_monitored_pins(sc->port);
+}
 
-  sc = &gpiote_st[inst].gpiote_ch_status[ch_n];
+/*
+ * Start monitoring the channel pin, if the channel is in event mode
+ */
+static void nrf_gpiote_channel_event_map(unsigned int inst, unsigned int ch_n) {
+  struct gpiote_status *st = &gpiote_st[inst];
+  struct gpiote_ch_status_t *sc = &st->gpiote_ch_status[ch_n];
+  uint32_t pin_mask = (uint32_t)1 << sc->pin;
+
+  if (sc->mode != GPIOTE_CONFIG_MODE_Event) {
+    return;
+  }
+  st->pin_ch[sc->port][sc->pin] = ch_n;
+  st->evt_rise[sc->port] &= ~pin_mask;
+  st->evt_fall[sc->port] &= ~pin_mask;
 
   switch (sc->polarity) {
   case GPIOTE_CONFIG_POLARITY_None:
-    return;
+    break;
   case GPIOTE_CONFIG_POLARITY_LoToHi:
-    if ((sc->level == false) && (value == true)) {
-      generate_event = true;
-    }
+    st->evt_rise[sc->port] |= pin_mask;
     break;
   case GPIOTE_CONFIG_POLARITY_HiToLo:
-    if ((sc->level == true) && (value == false)) {
-      generate_event = true;
-    }
+    st->evt_fall[sc->port] |= pin_mask;
     break;
   case GPIOTE_CONFIG_POLARITY_Toggle:
-    if (sc->level != value) {
-      generate_event = true;
-    }
+    st->evt_rise[sc->port] |= pin_mask;
+    st->evt_fall[sc->port] |= pin_mask;
     break;
   default: /* LCOV_EXCL_START */
-    bs_trace_error_time_line("%s: Missconfigured CONFIG.CONFIG[%i]\n", ch_n);
+    bs_trace_error_time_line("%s: Missconfigured CONFIG.CONFIG[%i]\n", __func__, ch_n);
     break;
   } /* LCOV_EXCL_STOP */
-  sc->level = value;
-
-  if (generate_event) {
-    nhw_GPIOTE_signal_EVENTS_IN(inst, ch_n);
-  }
+  nrf_gpiote_update_monitored_pins(sc->port);
 }
 
 /*
@@ -314,7 +381,10 @@ void nrf_gpiote_regw_sideeffects_TASKS_CLR(unsigned int inst, unsigned int n) {
 }
 
 void nrf_gpiote_regw_sideeffects_EVENTS_IN(unsigned int inst, unsigned int n) {
-  (void) n;
+  struct gpiote_status *st = &gpiote_st[inst];
+
+  st->EVENTS_IN_mask &= ~((uint32_t)1 << n);
+  st->EVENTS_IN_mask |= (uint32_t)(NRF_GPIOTE_regs[inst].EVENTS_IN[n] != 0) << n;
   nrf_gpiote_eval_interrupt(inst);
 }
 
@@ -378,6 +448,7 @@ void nrf_gpiote_regw_sideeffects_CONFIG(unsigned int inst, unsigned int ch_n) {
     /* Disconnect the old GPIO pin from the GPIOTE */
     nrf_gpio_peri_pin_control(sc->port, sc->pin, 0, 0, 0, NULL, NULL, -1);
   }
+  nrf_gpiote_channel_event_unmap(inst, ch_n);
 
   sc->mode = mode;
   sc->pin = pin;
@@ -386,8 +457,9 @@ void nrf_gpiote_regw_sideeffects_CONFIG(unsigned int inst, unsigned int ch_n) {
 
   if (mode == GPIOTE_CONFIG_MODE_Event) {
     sc->level = nrf_gpio_get_pin_level(port, pin);
-    intptr_t cb_data = (inst<<8) + ch_n;
-    nrf_gpio_peri_pin_control(port, pin, 1, 3, 2, nrf_gpiote_input_change_ntf, (void *)cb_data, -1);
+    nrf_gpio_peri_pin_control(port, pin, 1, 3, 2, NULL, NULL, -1);
+    /* Only after connecting the input, so connecting it does not generate an event */
+    nrf_gpiote_channel_event_map(inst, ch_n);
   } else if (mode == GPIOTE_CONFIG_MODE_Task) {
     sc->level = outinit;
     nrf_gpio_peri_pin_control(port, pin, 1, 2, 3, NULL, NULL, outinit);
@@ -408,11 +480,11 @@ void nrf_gpiote_regw_sideeffects_CONFIG(unsigned int inst, unsigned int ch_n) {
   void nhw_gpiote_regw_sideeffects_SUBSCRIBE_##TASK_N(uint inst, uint ch_n) {            \
     struct gpiote_status *st = &gpiote_st[inst];                                         \
                                                                                          \
-    nhw_dppi_common_subscribe_sideeffect(st->dppi_map,                                   \
-                                         NRF_GPIOTE_regs[inst].SUBSCRIBE_##TASK_N[ch_n],\
-                                         &st->subscribed_##TASK_N[ch_n],                 \
-                                         nrf_gpiote_TASKS_##TASK_N##_wrap,               \
-                                         (void*)((inst << 16) + ch_n));                  \
+    nhw_dppi_common_subscribe_sideeffect_reg(st->dppi_map,                               \
+                                             &NRF_GPIOTE_regs[inst].SUBSCRIBE_##TASK_N[ch_n],\
+                                             &st->subscribed_##TASK_N[ch_n],             \
+                                             nrf_gpiote_TASKS_##TASK_N##_wrap,           \
+                                             (void*)((inst << 16) + ch_n));              \
   }
 
 NHW_GPIOTE_REGW_SIDEFFECTS_SUBSCRIBE(OUT)
@@ -6,11 +6,14 @@
 #ifndef _NRF_HW_MODEL_GPIOTE_H
 #define _NRF_HW_MODEL_GPIOTE_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"{
 #endif
 
 void nrf_gpiote_port_detect_raise(unsigned int inst, unsigned int port);
+void nrf_gpiote_port_inputs_change(unsigned int port, uint32_t changed, uint32_t in);
 
 void nrf_gpiote_regw_sideeffects_TASKS_OUT(unsigned int inst, unsigned int n);
 void nrf_gpiote_regw_sideeffects_TASKS_SET(unsigned int inst, unsigned int n);
@@ -10,6 +10,11 @@
  *   * Outputs changes can be recorded in a file
  *   * Inputs can be driver from a file
  *   * Outputs can be short-circuited to inputs thru a configuration file
+ *   * Outputs can be wired to inputs of another device thru a GPIO bus
+ *     (set in the configuration file, see NRF_GPIO_backend_bus.c)
+ *
+ * The input and output files can be either in csv or in a compact binary format.
+ * The output can also be dumped as a VCD file.
  *
  * Check docs/GPIO.md for more info.
  */
@@ -17,9 +22,15 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "NHW_common_types.h"
 #include "NHW_config.h"
 #include "NRF_GPIO.h"
+#include "NRF_GPIO_backend_bus.h"
 #include "bs_types.h"
 #include "nsi_hw_scheduler.h"
 #include "bs_tracing.h"
@@ -28,27 +39,60 @@
 #include "bs_dynargs.h"
 #include "nsi_hws_models_if.h"
 #include "nsi_tasks.h"
+#include "NHW_hws_profiler.h"
 
 static bs_time_t Timer_GPIO_input = TIME_NEVER;
 
 static char *gpio_in_file_path = NULL; /* Possible file for input stimuli */
 static char *gpio_out_file_path = NULL; /* Possible file for dumping output toggles */
 static char *gpio_conf_file_path = NULL; /* Possible file for configuration (short-circuits) */
+static char *gpio_out_format_str = NULL; /* Format for the output file */
 
 #define MAXLINESIZE 2048
 #define MAX_SHORTS 8
 
-/* Table keeping all configured short-circuits */
-static struct {
-	uint8_t port;
-	uint8_t pin;
-} shorts[NHW_GPIO_TOTAL_INST][NHW_GPIO_MAX_PINS_PER_PORT][MAX_SHORTS];
+enum gpio_file_format {GPIO_FILE_CSV = 0, GPIO_FILE_BIN, GPIO_FILE_VCD};
+
+/*
+ * Binary format: A header (magic + version), followed by records of:
+ *   <time delta since the previous record, in us, as an unsigned LEB128 varint>
+ *   <port: 1 byte>
+ *   <pin & level: 1 byte, bit 7 = level, bits 6..0 = pin>
+ */
+#define GPIO_BIN_MAGIC "NHWGPIO"
+#define GPIO_BIN_MAGIC_SIZE 8 /* Including the null termination */
+#define GPIO_BIN_VERSION 1
+#define GPIO_BIN_HEADER_SIZE (GPIO_BIN_MAGIC_SIZE + 1)
+#define GPIO_BIN_LEVEL_BIT 0x80
 
-static FILE *output_file_ptr; /* File pointer for gpio_out_file_path */
+#define OUT_BUF_SIZE (256*1024)
+#define OUT_MAX_RECORD_SIZE 64 /* Bigger than any record in any format */
+
+/*
+ * Configured short-circuits:
+ * For each output port.pin, which input pins it is shorted to (as a mask for each input port)
+ */
+static uint32_t shorts[NHW_GPIO_TOTAL_INST][NHW_GPIO_MAX_PINS_PER_PORT][NHW_GPIO_TOTAL_INST];
+/* For each port, which of its pins are shorted to anything */
+static uint32_t shorted_pins[NHW_GPIO_TOTAL_INST];
+
+/* GPIO output file status */
+static struct {
+	FILE *file_ptr; /* File pointer for gpio_out_file_path */
+	enum gpio_file_format format;
+	bs_time_t last_time; /* Time of the last record written (binary & VCD) */
+	size_t used;         /* Bytes used in buf */
+	char buf[OUT_BUF_SIZE];
+} gpio_out_st;
 
 /* GPIO input status */
 static struct {
-	FILE *input_file_ptr; /* File pointer for gpio_out_file_path */
+	enum gpio_file_format format;
+	FILE *input_file_ptr; /* File pointer for gpio_in_file_path (csv) */
+	const uint8_t *map;   /* Mapped gpio_in_file_path (binary) */
+	size_t map_size;
+	size_t map_pos;
+	bs_time_t last_time;  /* Time of the last record read (binary) */
 	/* Next event port.pin & level: */
 	unsigned int port;
 	unsigned int pin;
@@ -58,15 +102,16 @@ static struct {
 static void nrf_gpio_load_config(void);
 static void nrf_gpio_init_output_file(void);
 static void nrf_gpio_init_input_file(void);
+static void nrf_gpio_output_flush(void);
+static void nrf_gpio_input_close(void);
 
 /*
  * Initialize the GPIO backends
  */
 void nrf_gpio_backend_init(void)
 {
-	memset(shorts, UINT8_MAX, sizeof(shorts));
-
 	nrf_gpio_load_config();
+	nrf_gpio_bus_init();
 	nrf_gpio_init_output_file();
 	nrf_gpio_init_input_file();
 }
@@ -76,15 +121,18 @@ void nrf_gpio_backend_init(void)
  */
 static void nrf_gpio_backend_cleaup(void)
 {
-	if (output_file_ptr != NULL) {
-		fclose(output_file_ptr);
-		output_file_ptr = NULL;
+	if (gpio_out_st.file_ptr != NULL) {
+		nrf_gpio_output_flush();
+		if ((gpio_out_st.format == GPIO_FILE_VCD)
+		    && (gpio_out_st.last_time != nsi_hws_get_time())) {
+			/* Mark the end of the simulation, so the last levels are visible */
+			fprintf(gpio_out_st.file_ptr, "#%"PRItime"\n", nsi_hws_get_time());
+		}
+		fclose(gpio_out_st.file_ptr);
+		gpio_out_st.file_ptr = NULL;
 	}
 
-	if (gpio_input_file_st.input_file_ptr != NULL) {
-		fclose(gpio_input_file_st.input_file_ptr);
-		gpio_input_file_st.input_file_ptr = NULL;
-	}
+	nrf_gpio_input_close();
 }
 
 NSI_TASK(nrf_gpio_backend_cleaup, ON_EXIT_PRE, 100);
@@ -107,6 +155,14 @@ static void nrf_gpio_register_cmd_args(void){
       .dest=(void *)&gpio_out_file_path,
       .descript="Optional path to a file where GPIOs output activity will be saved",
     },
+    {
+      .option="gpio_out_format",
+      .name="format",
+      .type='s',
+      .dest=(void *)&gpio_out_format_str,
+      .descript="Format of the GPIO output file: csv (default), bin (compact binary format), "
+                "or vcd (value change dump, for waveform viewers)",
+    },
     {
       .option="gpio_conf_file",
       .name="path",
@@ -123,22 +179,104 @@ static void nrf_gpio_register_cmd_args(void){
 NSI_TASK(nrf_gpio_register_cmd_args, PRE_BOOT_1, 100);
 
 /*
- * Propagate an output change thru its external short-circuits
+ * Propagate output changes thru their external short-circuits
+ *
+ * Inputs:
+ *  * port: GPIO port whose outputs changed
+ *  * changed: mask of the pins which changed
+ *  * levels: new output levels of the port
+ *
+ * All the inputs of each destination port are updated at once.
  */
-void nrf_gpio_backend_short_propagate(unsigned int port, unsigned int n, bool value)
+void nrf_gpio_backend_short_propagate(unsigned int port, uint32_t changed, uint32_t levels)
 {
-	int i;
-	for (i = 0 ; i < MAX_SHORTS; i++){
-		if (shorts[port][n][i].port == UINT8_MAX) {
-			break;
+	uint32_t dst_mask[NHW_GPIO_TOTAL_INST] = {0};
+	uint32_t dst_levels[NHW_GPIO_TOTAL_INST] = {0};
+
+	changed &= shorted_pins[port];
+	if (changed == 0) {
+		return;
+	}
+
+	for (int n = __builtin_ffs(changed) - 1; n >= 0; n = __builtin_ffs(changed) - 1) {
+		uint32_t level_mask = ((levels >> n) & 0x1) ? UINT32_MAX : 0;
+
+		for (int d = 0; d < NHW_GPIO_TOTAL_INST; d++) {
+			uint32_t m = shorts[port][n][d];
+
+			dst_mask[d] |= m;
+			dst_levels[d] = (dst_levels[d] & ~m) | (level_mask & m);
+		}
+		changed &= ~((uint32_t)1 << n);
+	}
+
+	for (int d = 0; d < NHW_GPIO_TOTAL_INST; d++) {
+		if (dst_mask[d] != 0) {
+			nrf_gpio_eval_inputs_masked(d, dst_mask[d], dst_levels[d]);
 		}
-		nrf_gpio_eval_input(shorts[port][n][i].port, shorts[port][n][i].pin, value);
 	}
 }
 
+static void nrf_gpio_output_flush(void)
+{
+	if (gpio_out_st.used == 0) {
+		return;
+	}
+	if (fwrite(gpio_out_st.buf, gpio_out_st.used, 1, gpio_out_st.file_ptr) != 1) {
+		bs_trace_error_line("%s: Failed to write to GPIO output file %s (%s)\n",
+				    __func__, gpio_out_file_path, strerror(errno));
+	}
+	gpio_out_st.used = 0;
+}
+
+/*
+ * VCD identifier for a given port.pin
+ * (we use the printable characters as base 94 digits)
+ */
+static void nrf_gpio_vcd_id(unsigned int port, unsigned int pin, char *id)
+{
+	unsigned int index = port * NHW_GPIO_MAX_PINS_PER_PORT + pin;
+
+	do {
+		*id++ = '!' + index % 94;
+		index /= 94;
+	} while (index > 0);
+	*id = 0;
+}
+
+static void nrf_gpio_write_vcd_header(void)
+{
+	FILE *fp = gpio_out_st.file_ptr;
+	char id[8];
+
+	fprintf(fp, "$version nRF HW models GPIO output $end\n");
+	fprintf(fp, "$timescale 1us $end\n");
+	fprintf(fp, "$scope module gpio $end\n");
+	for (unsigned int port = 0; port < NHW_GPIO_TOTAL_INST; port++) {
+		unsigned int max_pins = nrf_gpio_get_number_pins_in_port(port);
+
+		for (unsigned int pin = 0; pin < max_pins; pin++) {
+			nrf_gpio_vcd_id(port, pin, id);
+			fprintf(fp, "$var wire 1 %s P%u_%u $end\n", id, port, pin);
+		}
+	}
+	fprintf(fp, "$upscope $end\n");
+	fprintf(fp, "$enddefinitions $end\n");
+	fprintf(fp, "$dumpvars\n");
+	for (unsigned int port = 0; port < NHW_GPIO_TOTAL_INST; port++) {
+		unsigned int max_pins = nrf_gpio_get_number_pins_in_port(port);
+
+		for (unsigned int pin = 0; pin < max_pins; pin++) {
+			nrf_gpio_vcd_id(port, pin, id);
+			fprintf(fp, "x%s\n", id);
+		}
+	}
+	fprintf(fp, "$end\n");
+}
+
 /*
  * Initialize the GPIO output activity file
- * (open and write csv header)
+ * (open and write its header)
  */
 static void nrf_gpio_init_output_file(void)
 {
@@ -146,9 +284,36 @@ static void nrf_gpio_init_output_file(void)
 		return;
 	}
 
+	if ((gpio_out_format_str == NULL) || (strcmp(gpio_out_format_str, "csv") == 0)) {
+		gpio_out_st.format = GPIO_FILE_CSV;
+	} else if (strcmp(gpio_out_format_str, "bin") == 0) {
+		gpio_out_st.format = GPIO_FILE_BIN;
+	} else if (strcmp(gpio_out_format_str, "vcd") == 0) {
+		gpio_out_st.format = GPIO_FILE_VCD;
+	} else {
+		bs_trace_error_line("%s: Unknown GPIO output file format \"%s\" "
+				    "(valid formats are csv, bin and vcd)\n",
+				    __func__, gpio_out_format_str);
+	}
+
 	bs_create_folders_in_path(gpio_out_file_path);
-	output_file_ptr = bs_fopen(gpio_out_file_path, "w");
-	fprintf(output_file_ptr, "time(microsecond),port,pin,level\n");
+	gpio_out_st.file_ptr = bs_fopen(gpio_out_file_path, "w");
+	gpio_out_st.used = 0;
+	gpio_out_st.last_time = TIME_NEVER;
+
+	switch (gpio_out_st.format) {
+	case GPIO_FILE_CSV:
+		fprintf(gpio_out_st.file_ptr, "time(microsecond),port,pin,level\n");
+		break;
+	case GPIO_FILE_BIN:
+		fwrite(GPIO_BIN_MAGIC, GPIO_BIN_MAGIC_SIZE, 1, gpio_out_st.file_ptr);
+		fputc(GPIO_BIN_VERSION, gpio_out_st.file_ptr);
+		gpio_out_st.last_time = 0;
+		break;
+	case GPIO_FILE_VCD:
+		nrf_gpio_write_vcd_header();
+		break;
+	}
 }
 
 /*
@@ -156,9 +321,51 @@ static void nrf_gpio_init_output_file(void)
  */
 void nrf_gpio_backend_write_output_change(unsigned int port, unsigned int n, bool value)
 {
-	if (output_file_ptr != NULL){
-		fprintf(output_file_ptr, "%"PRItime",%u,%u,%u\n",
-			nsi_hws_get_time(), port, n, value);
+	if (gpio_out_st.file_ptr == NULL) {
+		return;
+	}
+
+	bs_time_t now = nsi_hws_get_time();
+	char *buf;
+
+	if (gpio_out_st.used > OUT_BUF_SIZE - OUT_MAX_RECORD_SIZE) {
+		nrf_gpio_output_flush();
+	}
+	buf = &gpio_out_st.buf[gpio_out_st.used];
+
+	switch (gpio_out_st.format) {
+	case GPIO_FILE_CSV:
+		gpio_out_st.used += sprintf(buf, "%"PRItime",%u,%u,%u\n", now, port, n, value);
+		break;
+	case GPIO_FILE_BIN:
+	{
+		uint64_t delta = now - gpio_out_st.last_time;
+		size_t i = 0;
+
+		while (delta >= 0x80) {
+			buf[i++] = (delta & 0x7F) | 0x80;
+			delta >>= 7;
+		}
+		buf[i++] = delta;
+		buf[i++] = port;
+		buf[i++] = n | (value ? GPIO_BIN_LEVEL_BIT : 0);
+		gpio_out_st.used += i;
+		gpio_out_st.last_time = now;
+		break;
+	}
+	case GPIO_FILE_VCD:
+	{
+		char id[8];
+
+		if (now != gpio_out_st.last_time) {
+			buf += sprintf(buf, "#%"PRItime"\n", now);
+			gpio_out_st.last_time = now;
+		}
+		nrf_gpio_vcd_id(port, n, id);
+		buf += sprintf(buf, "%u%s\n", value, id);
+		gpio_out_st.used = buf - gpio_out_st.buf;
+		break;
+	}
 	}
 }
 
@@ -213,17 +420,9 @@ static int readline(char *s, int size, FILE *stream)
 void nrf_gpio_backend_register_short(uint8_t Port_out, uint8_t Pin_out,
 				     uint8_t Port_in, uint8_t Pin_in)
 {
-	int i;
+	int i = 0;
 	unsigned int max_pins;
 
-	for (i = 0 ; i < MAX_SHORTS; i++) {
-		if (shorts[Port_out][Pin_out][i].port == UINT8_MAX)
-			break;
-	}
-	if (i == MAX_SHORTS) {
-		bs_trace_error_line("%s: Number of supported shorts per output (%i) exceeded\n",
-				__func__, MAX_SHORTS);
-	}
 	if (Port_out >= NHW_GPIO_TOTAL_INST) {
 		bs_trace_error_time_line("%s: GPIO configuration file attempted to set short from "
 				"non existing GPIO port (%u>=%u)\n",
@@ -246,8 +445,17 @@ void nrf_gpio_backend_register_short(uint8_t Port_out, uint8_t Pin_out,
 				"non existing GPIO pin in port %i (%u>=%u)\n",
 				__func__, Port_in, Pin_in, max_pins);
 	}
-	shorts[Port_out][Pin_out][i].port = Port_in;
-	shorts[Port_out][Pin_out][i].pin  = Pin_in;
+
+	for (int d = 0; d < NHW_GPIO_TOTAL_INST; d++) {
+		i += __builtin_popcount(shorts[Port_out][Pin_out][d]);
+	}
+	if (i >= MAX_SHORTS) {
+		bs_trace_error_line("%s: Number of supported shorts per output (%i) exceeded\n",
+				__func__, MAX_SHORTS);
+	}
+
+	shorts[Port_out][Pin_out][Port_in] |= (uint32_t)1 << Pin_in;
+	shorted_pins[Port_out] |= (uint32_t)1 << Pin_out;
 }
 
 static int process_config_line(char *s)
@@ -258,13 +466,17 @@ static int process_config_line(char *s)
 	const char error_msg[] = "%s: Corrupted GPIO configuration file, the valid format is "
 			"\"shortcut X.x Y.y\"\nLine was:%s\n";
 
+	if (nrf_gpio_bus_process_config_line(s)) {
+		return 0;
+	}
 	if (strncmp(s, "short", 5) == 0){
 		buf += 5;
 	} else if (strncmp(s, "s", 1) == 0){
 		buf += 1;
 	} else {
-		bs_trace_error_line("%s: Only the command short (or \"s\") is understood at this "
-				    "point, Line read \"%s\" instead\n", __func__, s);
+		bs_trace_error_line("%s: Only the commands short (or \"s\"), bus, bus_out and bus_in "
+				    "are understood at this point, Line read \"%s\" instead\n",
+				    __func__, s);
 	}
 	X = strtoul(buf, &endp, 0);
 	if ((endp == buf) || (*endp!='.')) {
@@ -292,7 +504,7 @@ static int process_config_line(char *s)
 }
 
 /*
- * Load GPIO configuration file (short-circuits)
+ * Load GPIO configuration file (short-circuits and buses)
  */
 static void nrf_gpio_load_config(void)
 {
@@ -317,20 +529,32 @@ static void nrf_gpio_load_config(void)
 	fclose(fileptr);
 }
 
+static void nrf_gpio_input_close(void)
+{
+	if (gpio_input_file_st.input_file_ptr != NULL) {
+		fclose(gpio_input_file_st.input_file_ptr);
+		gpio_input_file_st.input_file_ptr = NULL;
+	}
+	if (gpio_input_file_st.map != NULL) {
+		munmap((void *)gpio_input_file_st.map, gpio_input_file_st.map_size);
+		gpio_input_file_st.map = NULL;
+	}
+}
+
 /*
- * Process next (valid) line in the input stimuly file, and program
- * the next input update event
- * (or close down the file if it ended or is corrupted)
+ * Read the next (valid) line from a csv input stimuli file
+ *
+ * Returns true if a record was read, false if the file ended or is corrupted
  */
-static void nrf_gpio_input_process_next_time(char *buf)
+static bool nrf_gpio_input_read_csv(bs_time_t *time, unsigned int *port,
+				    unsigned int *pin, unsigned int *level)
 {
-	bs_time_t time;
-	unsigned int port;
-	unsigned int pin;
-	unsigned int level;
+	char buf[MAXLINESIZE];
 	int n;
 
-	n = sscanf(buf, "%"SCNtime",%u,%u,%u", &time, &port, &pin, &level);
+	(void)readline(buf, MAXLINESIZE, gpio_input_file_st.input_file_ptr);
+
+	n = sscanf(buf, "%"SCNtime",%u,%u,%u", time, port, pin, level);
 	if (n > 0 && n < 4) {
 		bs_trace_warning_time_line("File %s seems corrupted. Ignoring rest of file. "
 					   "Expected \""
@@ -338,30 +562,103 @@ static void nrf_gpio_input_process_next_time(char *buf)
 					   "Line was:%s\n",
 					   gpio_in_file_path, buf);
 	}
-	if (n < 4) { /* End of file, or corrupted => we are done */
-		fclose(gpio_input_file_st.input_file_ptr);
-		gpio_input_file_st.input_file_ptr = NULL;
+	return n == 4;
+}
+
+/*
+ * Read the next record from a binary input stimuli file
+ *
+ * Returns true if a record was read, false if the file ended or is corrupted
+ */
+static bool nrf_gpio_input_read_bin(bs_time_t *time, unsigned int *port,
+				    unsigned int *pin, unsigned int *level)
+{
+	const uint8_t *map = gpio_input_file_st.map;
+	size_t size = gpio_input_file_st.map_size;
+	size_t pos = gpio_input_file_st.map_pos;
+	uint64_t delta = 0;
+	int shift = 0;
+
+	if (pos >= size) {
+		return false;
+	}
+
+	while (true) {
+		if ((pos >= size) || (shift > 63)) {
+			bs_trace_warning_time_line("File %s seems corrupted (truncated record at "
+						   "offset %zu). Ignoring rest of file\n",
+						   gpio_in_file_path, gpio_input_file_st.map_pos);
+			return false;
+		}
+		delta |= (uint64_t)(map[pos] & 0x7F) << shift;
+		shift += 7;
+		if ((map[pos++] & 0x80) == 0) {
+			break;
+		}
+	}
+	if (pos + 2 > size) {
+		bs_trace_warning_time_line("File %s seems corrupted (truncated record at "
+					   "offset %zu). Ignoring rest of file\n",
+					   gpio_in_file_path, gpio_input_file_st.map_pos);
+		return false;
+	}
+
+	gpio_input_file_st.last_time += delta;
+	*time = gpio_input_file_st.last_time;
+	*port = map[pos];
+	*pin = map[pos + 1] & ~GPIO_BIN_LEVEL_BIT;
+	*level = (map[pos + 1] & GPIO_BIN_LEVEL_BIT) ? 1 : 0;
+	gpio_input_file_st.map_pos = pos + 2;
+
+	return true;
+}
+
+/*
+ * Process next (valid) record in the input stimuly file, and program
+ * the next input update event
+ * (or close down the file if it ended or is corrupted)
+ */
+static void nrf_gpio_input_process_next_time(void)
+{
+	bs_time_t time;
+	unsigned int port;
+	unsigned int pin;
+	unsigned int level;
+	bool valid;
+
+	if (gpio_input_file_st.format == GPIO_FILE_BIN) {
+		valid = nrf_gpio_input_read_bin(&time, &port, &pin, &level);
+	} else {
+		valid = nrf_gpio_input_read_csv(&time, &port, &pin, &level);
+	}
+
+	if (!valid) { /* End of file, or corrupted => we are done */
+		nrf_gpio_input_close();
 		Timer_GPIO_input = TIME_NEVER;
 	} else {
 		if (time < nsi_hws_get_time()) {
-			bs_trace_error_time_line("%s: GPIO input file went back in time(%s)\n",
-						__func__, buf);
+			bs_trace_error_time_line("%s: GPIO input file went back in time"
+						"(%"PRItime",%u,%u,%u)\n",
+						__func__, time, port, pin, level);
 		}
 		if (port >= NHW_GPIO_TOTAL_INST) {
 			bs_trace_error_time_line("%s: GPIO input file attempted to access not "
-						"existing GPIO port (%u>=%u) (%s)\n",
-						__func__, port, NHW_GPIO_TOTAL_INST, buf);
+						"existing GPIO port (%u>=%u) (%"PRItime",%u,%u,%u)\n",
+						__func__, port, NHW_GPIO_TOTAL_INST,
+						time, port, pin, level);
 		}
 		unsigned int max_pins = nrf_gpio_get_number_pins_in_port(port);
 		if (pin >= max_pins) {
 			bs_trace_error_time_line("%s: GPIO input file attempted to access not "
-						"existing GPIO pin in port %i (%u>=%u) (%s)\n",
-						__func__, port, pin, max_pins, buf);
+						"existing GPIO pin in port %i (%u>=%u) "
+						"(%"PRItime",%u,%u,%u)\n",
+						__func__, port, pin, max_pins,
+						time, port, pin, level);
 		}
 		if (level != 0 && level != 1) {
 			bs_trace_error_time_line("%s: level can only be 0 (for low) or 1 (for high)"
-						"(%u) (%s)\n",
-						__func__, level, buf);
+						"(%"PRItime",%u,%u,%u)\n",
+						__func__, time, port, pin, level);
 		}
 		gpio_input_file_st.level = level;
 		gpio_input_file_st.pin = pin;
@@ -372,32 +669,86 @@ static void nrf_gpio_input_process_next_time(char *buf)
 	nsi_hws_find_next_event();
 }
 
+/*
+ * Map a binary input stimuli file in memory
+ */
+static void nrf_gpio_init_input_file_bin(void)
+{
+	struct stat st;
+	int fd;
+
+	fd = open(gpio_in_file_path, O_RDONLY);
+	if ((fd == -1) || (fstat(fd, &st) != 0)) {
+		bs_trace_error_line("%s: Could not open %s (%s)\n",
+				    __func__, gpio_in_file_path, strerror(errno));
+	}
+	gpio_input_file_st.map_size = st.st_size;
+	gpio_input_file_st.map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (gpio_input_file_st.map == MAP_FAILED) {
+		bs_trace_error_line("%s: Could not map %s (%s)\n",
+				    __func__, gpio_in_file_path, strerror(errno));
+	}
+	close(fd);
+
+	if (gpio_input_file_st.map[GPIO_BIN_MAGIC_SIZE] != GPIO_BIN_VERSION) {
+		bs_trace_error_line("%s: %s is in an unsupported binary format version (%i)\n",
+				    __func__, gpio_in_file_path,
+				    gpio_input_file_st.map[GPIO_BIN_MAGIC_SIZE]);
+	}
+	gpio_input_file_st.map_pos = GPIO_BIN_HEADER_SIZE;
+	gpio_input_file_st.last_time = 0;
+
+	if (gpio_input_file_st.map_size == GPIO_BIN_HEADER_SIZE) {
+		bs_trace_warning_line("%s: Input file %s seems empty\n",
+				      __func__, gpio_in_file_path);
+	}
+}
+
 /*
  * Initialize GPIO input from file, and queue next input event change
  */
 static void nrf_gpio_init_input_file(void)
 {
 	gpio_input_file_st.input_file_ptr = NULL;
+	gpio_input_file_st.map = NULL;
 
 	if (gpio_in_file_path == NULL) {
 		return;
 	}
 
-	char line_buf[MAXLINESIZE];
-	int read;
+	char header[GPIO_BIN_HEADER_SIZE];
+	size_t read;
 
 	gpio_input_file_st.input_file_ptr = bs_fopen(gpio_in_file_path, "r");
 
-	read = readline(line_buf, MAXLINESIZE, gpio_input_file_st.input_file_ptr);
-	if (strncmp(line_buf,"time",4) == 0) { /* Let's skip a possible csv header line */
-		read = readline(line_buf, MAXLINESIZE, gpio_input_file_st.input_file_ptr);
-	}
-	if (read == 0) {
-		bs_trace_warning_line("%s: Input file %s seems empty\n",
-				      __func__, gpio_in_file_path);
+	/* Let's check if this is a binary file */
+	read = fread(header, 1, GPIO_BIN_HEADER_SIZE, gpio_input_file_st.input_file_ptr);
+	if ((read == GPIO_BIN_HEADER_SIZE)
+	    && (memcmp(header, GPIO_BIN_MAGIC, GPIO_BIN_MAGIC_SIZE) == 0)) {
+		fclose(gpio_input_file_st.input_file_ptr);
+		gpio_input_file_st.input_file_ptr = NULL;
+		gpio_input_file_st.format = GPIO_FILE_BIN;
+		nrf_gpio_init_input_file_bin();
+	} else {
+		char line_buf[MAXLINESIZE];
+		long start;
+
+		gpio_input_file_st.format = GPIO_FILE_CSV;
+		rewind(gpio_input_file_st.input_file_ptr);
+
+		/* Let's skip a possible csv header line */
+		start = ftell(gpio_input_file_st.input_file_ptr);
+		(void)readline(line_buf, MAXLINESIZE, gpio_input_file_st.input_file_ptr);
+		if (strncmp(line_buf, "time", 4) != 0) {
+			fseek(gpio_input_file_st.input_file_ptr, start, SEEK_SET);
+		}
+		if (read == 0) {
+			bs_trace_warning_line("%s: Input file %s seems empty\n",
+					      __func__, gpio_in_file_path);
+		}
 	}
 
-	nrf_gpio_input_process_next_time(line_buf);
+	nrf_gpio_input_process_next_time();
 }
 
 /*
@@ -405,14 +756,10 @@ static void nrf_gpio_init_input_file(void)
  */
 static void nrf_gpio_input_event_triggered(void)
 {
-	char line_buf[MAXLINESIZE];
-
 	nrf_gpio_eval_input(gpio_input_file_st.port, gpio_input_file_st.pin,
 			    gpio_input_file_st.level);
 
-	(void)readline(line_buf, MAXLINESIZE, gpio_input_file_st.input_file_ptr);
-
-	nrf_gpio_input_process_next_time(line_buf);
+	nrf_gpio_input_process_next_time();
 }
 
-NSI_HW_EVENT(Timer_GPIO_input, nrf_gpio_input_event_triggered, 50);
+NHW_HW_EVENT(Timer_GPIO_input, nrf_gpio_input_event_triggered, 50);
@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * GPIO "bus" backend: Connects GPIO pins of this device to GPIO pins of another device
+ * (which may be another instance of these models, or any other model which follows the
+ * protocol described in NRF_GPIO_backend_bus.h)
+ *
+ * Each bus is a point to point link between 2 devices, over a pair of shared memory rings
+ * (one per direction).
+ * Output changes of the pins exported on the bus are sent as timestamped messages, with one
+ * mask/levels pair for all the pins of a port which changed at the same time.
+ * The other side applies them to the inputs they are wired to at that time.
+ *
+ * Like the UART FIFO backend, both devices are kept in conservative lock-step:
+ * Each side periodically tells the other how far in time it is guaranteed it will not send
+ * anything, and a device will not advance past the time of the next message it has received.
+ * For this to advance, a change in a pin is seen by the other device <latency> (by default 1)
+ * microseconds later. The bigger the latency, the less often both devices need to synchronize.
+ *
+ * The buses and their pins are set in the GPIO configuration file (check docs/GPIO.md)
+ *
+ * Notes:
+ *   * A bus *requires* the other side to be connected at boot.
+ *   * When the other side disconnects the bus is just disabled, the inputs it drove keep their
+ *     last level.
+ *   * Just like with short-circuits, a pin can only be driven by an output. So the 2 sides
+ *     cannot drive the same wire.
+ *   * If an output changes in the same microsecond it was already promised to the other side
+ *     that nothing would change until later, the change will be seen by the other side
+ *     at that later time.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "bs_types.h"
+#include "bs_tracing.h"
+#include "bs_oswrap.h"
+#include "NHW_config.h"
+#include "NRF_GPIO.h"
+#include "NRF_GPIO_backend_bus.h"
+#include "NHW_UART_backend_fifo_shm.h"
+#include "nsi_hw_scheduler.h"
+#include "nsi_tasks.h"
+#include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
+#include "NHW_misc.h"
+
+#define GBUS_MAX_BUSES 4
+#define GBUS_MAX_PORTS 8 /* Maximum number of ports in the other device */
+#define GBUS_MAX_PINS 32
+#define GBUS_TX_BUF_SIZE (170*sizeof(struct gbus_msg))
+#define GBUS_RX_BUF_SIZE (680*sizeof(struct gbus_msg))
+
+static bs_time_t Timer_GPIO_bus = TIME_NEVER;
+
+struct gbus_st_t {
+	bool enabled; /* Set in the configuration file (and not yet disconnected) */
+	bool disconnected;
+	unsigned int side;
+	bs_time_t latency;
+
+	char *tx_path;
+	char *rx_path;
+	struct nhw_ushm_ring *tx_ring;
+	struct nhw_ushm_ring *rx_ring;
+
+	bs_time_t Tx_timer;
+	bs_time_t Rx_timer;
+	bs_time_t tx_horizon; /* Time of the last message sent (the other side may be waiting for) */
+
+	/* Pins of each of our ports exported on the bus */
+	uint32_t out_pins[NHW_GPIO_TOTAL_INST];
+	/* For each of the other side pins, which of our inputs it drives (as a mask for each port) */
+	uint32_t in_map[GBUS_MAX_PORTS][GBUS_MAX_PINS][NHW_GPIO_TOTAL_INST];
+	/* For each of the other side ports, which of its pins drive any of our inputs */
+	uint32_t in_pins[GBUS_MAX_PORTS];
+
+	char tx_buf[GBUS_TX_BUF_SIZE];
+	size_t tx_buf_len;
+	ssize_t tx_nop_off; /* Offset in tx_buf of a NOP which is the last buffered message, or -1 */
+
+	char rx_buf[GBUS_RX_BUF_SIZE];
+	size_t rx_buf_pos;
+	size_t rx_buf_len;
+	struct gbus_msg rx_msg; /* Last received message */
+	bool rx_msg_pending; /* rx_msg is still to be applied (at Rx_timer) */
+};
+
+static struct gbus_st_t gbus_st[GBUS_MAX_BUSES];
+
+static void nrf_gpio_bus_update_timer(void)
+{
+	Timer_GPIO_bus = TIME_NEVER;
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (!bus->enabled) {
+			continue;
+		}
+		Timer_GPIO_bus = BS_MIN(Timer_GPIO_bus, BS_MIN(bus->Tx_timer, bus->Rx_timer));
+	}
+	nsi_hws_find_next_event();
+}
+
+static void gbus_tx_flush(struct gbus_st_t *bus)
+{
+	if (bus->tx_buf_len > 0) {
+		int res = nhw_ushm_write(bus->tx_ring, bus->tx_buf, bus->tx_buf_len);
+
+		if (res != (int)bus->tx_buf_len) {
+			bus->disconnected = true;
+			bs_trace_error_time_line("GPIO bus: Other end disconnected unexpectedly "
+						 "(%i, %i). Terminating\n", res, errno);
+		}
+		bus->tx_buf_len = 0;
+	}
+	bus->tx_nop_off = -1;
+}
+
+/*
+ * Send everything all buses have pending
+ * (registered as a pre-block hook, so it is called before this device may block waiting
+ *  for another device, thru this or any other backend, or for the Phy)
+ */
+static void gbus_tx_flush_all(void)
+{
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (bus->enabled && !bus->disconnected) {
+			gbus_tx_flush(bus);
+		}
+	}
+}
+
+/*
+ * Append a message to the Tx buffer
+ *
+ * If the last buffered message is a NOP, it is dropped,
+ * as this message will move the other side horizon at least as far.
+ */
+static void gbus_tx_msg(struct gbus_st_t *bus, uint32_t msg_type, bs_time_t time,
+			uint32_t port, uint32_t mask, uint32_t levels)
+{
+	struct gbus_msg msg;
+
+	msg.time = time;
+	msg.msg_type = msg_type;
+	msg.port = port;
+	msg.mask = mask;
+	msg.levels = levels;
+
+	if (bus->tx_nop_off >= 0) {
+		bus->tx_buf_len = bus->tx_nop_off;
+		bus->tx_nop_off = -1;
+	}
+	if (bus->tx_buf_len + sizeof(msg) > GBUS_TX_BUF_SIZE) {
+		gbus_tx_flush(bus);
+	}
+	memcpy(&bus->tx_buf[bus->tx_buf_len], &msg, sizeof(msg));
+	bus->tx_buf_len += sizeof(msg);
+
+	bus->tx_horizon = BS_MAX(bus->tx_horizon, time);
+}
+
+static void gbus_tx_nop(struct gbus_st_t *bus, bs_time_t t)
+{
+	if (bus->tx_nop_off >= 0) {
+		/* The previous NOP was not sent yet, we just move it forward */
+		((struct gbus_msg *)&bus->tx_buf[bus->tx_nop_off])->time = t;
+		bus->tx_horizon = t;
+	} else {
+		gbus_tx_msg(bus, GBUS_NOP, t, 0, 0, 0);
+		bus->tx_nop_off = bus->tx_buf_len - sizeof(struct gbus_msg);
+	}
+}
+
+/*
+ * Propagate output changes to the buses they are exported in
+ *
+ * Inputs:
+ *  * port: GPIO port whose outputs changed
+ *  * changed: mask of the pins which changed
+ *  * levels: new output levels of the port
+ */
+void nrf_gpio_bus_propagate(unsigned int port, uint32_t changed, uint32_t levels)
+{
+	bool sent = false;
+
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+		uint32_t mask = changed & bus->out_pins[port];
+
+		if (!bus->enabled || (mask == 0)) {
+			continue;
+		}
+		/* We cannot send anything earlier than what we already promised */
+		bs_time_t t = BS_MAX(nsi_hws_get_time() + bus->latency, bus->tx_horizon);
+
+		gbus_tx_msg(bus, GBUS_CHANGE, t, port, mask, levels & mask);
+		bus->Tx_timer = BS_MAX(bus->Tx_timer, t);
+		sent = true;
+	}
+	if (sent) {
+		nrf_gpio_bus_update_timer();
+	}
+}
+
+/*
+ * Apply a change from the other side to the inputs it is wired to
+ */
+static void gbus_rx_apply_change(struct gbus_st_t *bus, struct gbus_msg *msg)
+{
+	uint32_t dst_mask[NHW_GPIO_TOTAL_INST] = {0};
+	uint32_t dst_levels[NHW_GPIO_TOTAL_INST] = {0};
+	uint32_t changed;
+
+	if (msg->port >= GBUS_MAX_PORTS) {
+		return;
+	}
+	changed = msg->mask & bus->in_pins[msg->port];
+
+	for (int n = __builtin_ffs(changed) - 1; n >= 0; n = __builtin_ffs(changed) - 1) {
+		uint32_t level_mask = ((msg->levels >> n) & 0x1) ? UINT32_MAX : 0;
+
+		for (int d = 0; d < NHW_GPIO_TOTAL_INST; d++) {
+			uint32_t m = bus->in_map[msg->port][n][d];
+
+			dst_mask[d] |= m;
+			dst_levels[d] = (dst_levels[d] & ~m) | (level_mask & m);
+		}
+		changed &= ~((uint32_t)1 << n);
+	}
+
+	for (int d = 0; d < NHW_GPIO_TOTAL_INST; d++) {
+		if (dst_mask[d] != 0) {
+			nrf_gpio_eval_inputs_masked(d, dst_mask[d], dst_levels[d]);
+		}
+	}
+}
+
+/*
+ * Read one message from the Rx ring, blocking until there is one
+ */
+static void gbus_rx_read(struct gbus_st_t *bus, struct gbus_msg *msg)
+{
+	if (bus->rx_buf_len - bus->rx_buf_pos < sizeof(*msg)) {
+		size_t avail = bus->rx_buf_len - bus->rx_buf_pos;
+
+		memmove(bus->rx_buf, &bus->rx_buf[bus->rx_buf_pos], avail);
+		bus->rx_buf_pos = 0;
+		bus->rx_buf_len = avail;
+
+		nhw_pre_block(); /* The other side may be waiting for us */
+
+		while (bus->rx_buf_len < sizeof(*msg)) {
+			int ret = nhw_ushm_read(bus->rx_ring, &bus->rx_buf[bus->rx_buf_len],
+					       GBUS_RX_BUF_SIZE - bus->rx_buf_len);
+			if (ret <= 0) {
+				bus->disconnected = true;
+				bs_trace_error_time_line("GPIO bus: Other end disconnected "
+							 "unexpectedly\n");
+			}
+			bus->rx_buf_len += ret;
+		}
+	}
+	memcpy(msg, &bus->rx_buf[bus->rx_buf_pos], sizeof(*msg));
+	bus->rx_buf_pos += sizeof(*msg);
+}
+
+static void gbus_disconnect(unsigned int i, struct gbus_st_t *bus)
+{
+	bs_trace_raw_time(3, "GPIO bus %u: Other end disconnected, bus disabled\n", i);
+	bus->disconnected = true;
+	bus->enabled = false;
+	bus->Tx_timer = TIME_NEVER;
+	bus->Rx_timer = TIME_NEVER;
+}
+
+/*
+ * Get the next message which is to be applied at a given time,
+ * and schedule its processing
+ */
+static void gbus_rx_get_next(unsigned int i, struct gbus_st_t *bus)
+{
+	struct gbus_msg *msg = &bus->rx_msg;
+
+	while (true) {
+		gbus_rx_read(bus, msg);
+
+		switch (msg->msg_type) {
+		case GBUS_HELLO:
+			if (msg->port != GBUS_PROTOCOL_VERSION) {
+				bs_trace_error_line("GPIO bus %u: Other end uses protocol version "
+						    "%u, but this device only supports %u\n",
+						    i, msg->port, GBUS_PROTOCOL_VERSION);
+			}
+			continue;
+		case GBUS_NOP:
+		case GBUS_CHANGE:
+			bus->rx_msg_pending = true;
+			bus->Rx_timer = BS_MAX(msg->time, nsi_hws_get_time());
+			return;
+		case GBUS_DISCONNECT:
+			gbus_disconnect(i, bus);
+			return;
+		default:
+			bs_trace_error_time_line("GPIO bus %u: Corrupted stream\n", i);
+			return;
+		}
+	}
+}
+
+static void gbus_handle_RxTimer(unsigned int i, struct gbus_st_t *bus)
+{
+	if (bus->rx_msg_pending) {
+		bus->rx_msg_pending = false;
+		if (bus->rx_msg.msg_type == GBUS_CHANGE) {
+			gbus_rx_apply_change(bus, &bus->rx_msg);
+		}
+	}
+	gbus_rx_get_next(i, bus);
+}
+
+static void gbus_handle_TxTimer(struct gbus_st_t *bus)
+{
+	bs_time_t t;
+
+	bus->Tx_timer = TIME_NEVER;
+	nrf_gpio_bus_update_timer();
+	t = BS_MAX(nsi_hws_get_next_event_time() + bus->latency, bus->tx_horizon);
+	bus->Tx_timer = t;
+
+	gbus_tx_nop(bus, t);
+	if (bus->Rx_timer > t) {
+		/* We won't be reading (and therefore flushing) for a while,
+		 * so let's not hold the other side */
+		gbus_tx_flush(bus);
+	}
+}
+
+static void nrf_gpio_bus_timer_triggered(void)
+{
+	bs_time_t current_time = Timer_GPIO_bus;
+
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (!bus->enabled) {
+			continue;
+		}
+		if (bus->Tx_timer == current_time) {
+			gbus_handle_TxTimer(bus);
+		}
+		if (bus->Rx_timer == current_time) {
+			gbus_handle_RxTimer(i, bus);
+		}
+	}
+	nrf_gpio_bus_update_timer();
+}
+
+NHW_HW_EVENT(Timer_GPIO_bus, nrf_gpio_bus_timer_triggered, 900); /* Let's let as many timers as possible evaluate before this one */
+
+/*
+ * Connect all buses set in the configuration file
+ * (blocking until the other side of each has connected)
+ *
+ * All our Tx rings are created before attaching to any Rx one, and we only wait for the readers
+ * after that, so that devices connected in a ring (or any other topology) do not deadlock
+ * waiting for each other.
+ */
+void nrf_gpio_bus_init(void)
+{
+	bool any_enabled = false;
+
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (!bus->enabled) {
+			continue;
+		}
+		bs_trace_raw_time(9, "Connecting GPIO bus %i\n", i);
+		bs_create_folders_in_path(bus->tx_path);
+		bus->tx_ring = nhw_ushm_create_tx(bus->tx_path);
+		any_enabled = true;
+	}
+
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (bus->enabled) {
+			bus->rx_ring = nhw_ushm_attach_rx(bus->rx_path);
+		}
+	}
+
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (!bus->enabled) {
+			continue;
+		}
+		nhw_ushm_wait_for_reader(bus->tx_ring, bus->tx_path);
+
+		bus->tx_nop_off = -1;
+		gbus_tx_msg(bus, GBUS_HELLO, 0, GBUS_PROTOCOL_VERSION, 0, 0);
+
+		bus->Tx_timer = 0;
+		bus->Rx_timer = 0;
+	}
+
+	if (any_enabled) {
+		nhw_register_pre_block_hook(gbus_tx_flush_all);
+	}
+	nrf_gpio_bus_update_timer();
+}
+
+static void nrf_gpio_bus_cleanup(void)
+{
+	for (int i = 0; i < GBUS_MAX_BUSES; i++) {
+		struct gbus_st_t *bus = &gbus_st[i];
+
+		if (bus->tx_ring != NULL) {
+			if (!bus->disconnected) {
+				gbus_tx_msg(bus, GBUS_DISCONNECT, 0, 0, 0, 0);
+				gbus_tx_flush(bus);
+			}
+			nhw_ushm_close(bus->tx_ring, bus->tx_path);
+			bus->tx_ring = NULL;
+		}
+		if (bus->rx_ring != NULL) {
+			nhw_ushm_close(bus->rx_ring, bus->rx_path);
+			bus->rx_ring = NULL;
+		}
+		free(bus->tx_path);
+		free(bus->rx_path);
+		bus->tx_path = NULL;
+		bus->rx_path = NULL;
+		bus->enabled = false;
+	}
+}
+
+NSI_TASK(nrf_gpio_bus_cleanup, ON_EXIT_PRE, 100);
+
+/*
+ * Parse a "<port>.<pin>" pair from <buf>, checking the port and pin are below the maximums.
+ * Returns a pointer to the character after the pair, or NULL on error
+ */
+static char *gbus_parse_pin(char *buf, unsigned long *port, unsigned long *pin)
+{
+	char *endp;
+
+	*port = strtoul(buf, &endp, 0);
+	if ((endp == buf) || (*endp != '.')) {
+		return NULL;
+	}
+	buf = endp + 1;
+	*pin = strtoul(buf, &endp, 0);
+	if ((endp == buf) || ((*endp != ' ') && (*endp != 0))) {
+		return NULL;
+	}
+	return endp;
+}
+
+static void gbus_check_local_pin(const char *s, unsigned long port, unsigned long pin)
+{
+	if ((port >= NHW_GPIO_TOTAL_INST) || (pin >= nrf_gpio_get_number_pins_in_port(port))) {
+		bs_trace_error_line("GPIO configuration file refers to non existing GPIO pin %lu.%lu "
+				    "(Line was: %s)\n", port, pin, s);
+	}
+}
+
+static struct gbus_st_t *gbus_parse_bus_nbr(char *buf, char **endp, const char *s)
+{
+	unsigned long nbr = strtoul(buf, endp, 0);
+
+	if ((*endp == buf) || (**endp != ' ') || (nbr >= GBUS_MAX_BUSES)) {
+		bs_trace_error_line("GPIO configuration file: Expected a bus number (0..%i) "
+				    "(Line was: %s)\n", GBUS_MAX_BUSES - 1, s);
+	}
+	*endp += 1;
+	return &gbus_st[nbr];
+}
+
+/*
+ * bus <bus_nbr> <path> <side> [<latency>]
+ */
+static void gbus_config_bus(char *buf, const char *s)
+{
+	const char error_msg[] = "Corrupted GPIO configuration file, the valid format is "
+			"\"bus <bus_nbr> <path> <side:0|1> [<latency>]\"\nLine was:%s\n";
+	char *endp, *path;
+	size_t path_len;
+	unsigned long side, latency = 1;
+	struct gbus_st_t *bus = gbus_parse_bus_nbr(buf, &endp, s);
+
+	if (bus->enabled) {
+		bs_trace_error_line("GPIO configuration file: Bus defined twice (Line was: %s)\n", s);
+	}
+	buf = endp;
+	if (*buf == '"') {
+		path = ++buf;
+		endp = strchr(buf, '"');
+		if (endp == NULL) {
+			bs_trace_error_line(error_msg, s);
+		}
+		path_len = endp - path;
+		buf = endp + 1;
+	} else {
+		path = buf;
+		path_len = strcspn(buf, " ");
+		buf += path_len;
+	}
+	if ((path_len == 0) || (*buf != ' ')) {
+		bs_trace_error_line(error_msg, s);
+	}
+	buf++;
+	side = strtoul(buf, &endp, 0);
+	if ((endp == buf) || (side > 1)) {
+		bs_trace_error_line(error_msg, s);
+	}
+	if (*endp == ' ') {
+		buf = endp + 1;
+		latency = strtoul(buf, &endp, 0);
+		if ((endp == buf) || (latency == 0)) {
+			bs_trace_error_line("GPIO configuration file: The bus latency must be at least 1"
+					    " (Line was: %s)\n", s);
+		}
+	}
+
+	bus->tx_path = (char *)bs_calloc(path_len + 6, 1);
+	bus->rx_path = (char *)bs_calloc(path_len + 6, 1);
+	sprintf(bus->tx_path, "%.*s.%luto%lu", (int)path_len, path, side, 1 - side);
+	sprintf(bus->rx_path, "%.*s.%luto%lu", (int)path_len, path, 1 - side, side);
+	bus->side = side;
+	bus->latency = latency;
+	bus->enabled = true;
+
+	bs_trace_info_time(4, "GPIO bus %i in %s (side %lu, latency %lu)\n",
+			   (int)(bus - gbus_st), bus->tx_path, side, latency);
+}
+
+/*
+ * bus_out <bus_nbr> <out_port>.<out_pin>
+ */
+static void gbus_config_out(char *buf, const char *s)
+{
+	unsigned long port, pin;
+	char *endp;
+	struct gbus_st_t *bus = gbus_parse_bus_nbr(buf, &endp, s);
+
+	if (!bus->enabled) {
+		bs_trace_error_line("GPIO configuration file: A bus must be defined before its pins"
+				    " (Line was: %s)\n", s);
+	}
+	if (gbus_parse_pin(endp, &port, &pin) == NULL) {
+		bs_trace_error_line("Corrupted GPIO configuration file, the valid format is "
+				    "\"bus_out <bus_nbr> X.x\"\nLine was:%s\n", s);
+	}
+	gbus_check_local_pin(s, port, pin);
+
+	bus->out_pins[port] |= (uint32_t)1 << pin;
+}
+
+/*
+ * bus_in <bus_nbr> <other_side_port>.<other_side_pin> <in_port>.<in_pin>
+ */
+static void gbus_config_in(char *buf, const char *s)
+{
+	const char error_msg[] = "Corrupted GPIO configuration file, the valid format is "
+			"\"bus_in <bus_nbr> X.x Y.y\"\nLine was:%s\n";
+	unsigned long r_port, r_pin, port, pin;
+	char *endp;
+	struct gbus_st_t *bus = gbus_parse_bus_nbr(buf, &endp, s);
+
+	if (!bus->enabled) {
+		bs_trace_error_line("GPIO configuration file: A bus must be defined before its pins"
+				    " (Line was: %s)\n", s);
+	}
+	endp = gbus_parse_pin(endp, &r_port, &r_pin);
+	if ((endp == NULL) || (*endp != ' ')
+	    || (gbus_parse_pin(endp + 1, &port, &pin) == NULL)) {
+		bs_trace_error_line(error_msg, s);
+	}
+	if ((r_port >= GBUS_MAX_PORTS) || (r_pin >= GBUS_MAX_PINS)) {
+		bs_trace_error_line("GPIO configuration file: Other side pin %lu.%lu out of range "
+				    "(Line was: %s)\n", r_port, r_pin, s);
+	}
+	gbus_check_local_pin(s, port, pin);
+
+	bus->in_map[r_port][r_pin][port] |= (uint32_t)1 << pin;
+	bus->in_pins[r_port] |= (uint32_t)1 << r_pin;
+}
+
+/*
+ * Process a line of the GPIO configuration file if it is a bus command
+ *
+ * Returns true if it was, false otherwise
+ */
+bool nrf_gpio_bus_process_config_line(char *s)
+{
+	if (strncmp(s, "bus_out ", 8) == 0) {
+		gbus_config_out(s + 8, s);
+	} else if (strncmp(s, "bus_in ", 7) == 0) {
+		gbus_config_in(s + 7, s);
+	} else if (strncmp(s, "bus ", 4) == 0) {
+		gbus_config_bus(s + 4, s);
+	} else {
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _NRF_HW_MODEL_GPIO_BACKEND_BUS_H
+#define _NRF_HW_MODEL_GPIO_BACKEND_BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bs_types.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Protocol
+ *
+ *   Each bus connects 2 devices ("side" 0 and 1). For each direction there is one shared memory
+ *   ring (see NHW_UART_backend_fifo_shm.c) in <path>.0to1 and <path>.1to0, which the sending
+ *   side creates.
+ *
+ *   All messages have the same size and format:
+ *    <uint64_t time> <uint32_t msg_type> <uint32_t port> <uint32_t mask> <uint32_t levels>
+ *
+ *    <time> HELLO <version>
+ *          Sent first by each side, with time 0. Both sides must use the same version.
+ *
+ *    <time> CHANGE <port> <mask> <levels>
+ *          The pins in <mask> of the sender <port> changed at <time> (when they are to be
+ *          seen by the receiver) to the values in <levels>
+ *
+ *    <time> NOP
+ *          The sender will not send any other message with a time earlier than <time>
+ *
+ *    <time> DISCONNECT
+ *          The other side is disconnecting gracefully
+ *
+ *   Message times are never decreasing.
+ *   Messages are buffered, and only sent before the device blocks waiting for input,
+ *   and consecutive NOPs may be coalesced, so only the last one is sent.
+ */
+
+#define GBUS_PROTOCOL_VERSION 1
+
+enum gbus_msg_types {GBUS_NOP = 0, GBUS_HELLO, GBUS_CHANGE, GBUS_DISCONNECT};
+
+struct gbus_msg {
+	bs_time_t time;
+	uint32_t msg_type;
+	uint32_t port;
+	uint32_t mask;
+	uint32_t levels;
+} __attribute__ ((packed));
+
+bool nrf_gpio_bus_process_config_line(char *s);
+void nrf_gpio_bus_init(void);
+void nrf_gpio_bus_propagate(unsigned int port, uint32_t changed, uint32_t levels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NRF_HW_MODEL_GPIO_BACKEND_BUS_H */
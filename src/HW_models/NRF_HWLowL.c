@@ -7,7 +7,9 @@
 #include "bs_tracing.h"
 #include "bs_pc_2G4.h"
 #include "NRF_HWLowL.h"
+#include "NHW_misc.h"
 #include "xo_if.h"
+#include "trivial_xo.h"
 
 /*
  * Do not actually connect to the phy.
@@ -23,12 +25,124 @@ void hwll_set_nosim(bool new_nosim){
   nosim = new_nosim;
 }
 
+/*
+ * Time conversion between the device and the phy:
+ *
+ * With the trivial (linear) XO model, the conversions are
+ *   phy_t = (dev_t + off)/(1 + drift)  and  dev_t = phy_t*(1 + drift) - off
+ * which are computed in 64.64 fixed point:
+ *   phy_t = dev_t * mul + add  (rounded to the closest microsecond)
+ * With mul and add cached, and recalculated only when the XO drift or offset change.
+ * The result is the exact one (rounded half up), but for the rounding error of mul and add
+ * (below 2^-64 relative), so it is as precise as with the 80bit long double XO model functions,
+ * but much cheaper (specially in 32bit x87 builds).
+ *
+ * If the XO model was replaced by another one, its conversion functions are called instead.
+ */
+struct hwll_time_conv {
+  uint64_t mul_int; /* Unsigned 64.64: mul_int + mul_frac * 2^-64 */
+  uint64_t mul_frac;
+  int64_t add_int;   /* Signed 64.64: add_int + add_frac * 2^-64 */
+  uint64_t add_frac;
+};
+
+static uint hwll_conv_gen; /* trivial_xo_params_gen the conversions were calculated for */
+static bool hwll_conv_fixed; /* Use the fixed point conversion */
+static struct hwll_time_conv hwll_phy_from_dev_conv;
+static struct hwll_time_conv hwll_dev_from_phy_conv;
+
+/* Split a non negative number in its integer part and its fractional part in 2^-64 units */
+static void hwll_to_fixed(long double v, uint64_t *v_int, uint64_t *v_frac) {
+  uint64_t ip = (uint64_t)v;
+  long double frac = (v - ip) * 0x1p64L + 0.5L;
+
+  *v_int = ip;
+  if (frac >= 0x1p64L) {
+    *v_frac = 0;
+    *v_int += 1;
+  } else {
+    *v_frac = (uint64_t)frac;
+  }
+}
+
+static void hwll_to_signed_fixed(long double v, int64_t *v_int, uint64_t *v_frac) {
+  uint64_t u_int;
+
+  if (v >= 0) {
+    hwll_to_fixed(v, &u_int, v_frac);
+    *v_int = (int64_t)u_int;
+  } else { /* -v = i + f => v = -(i+1) + (1-f) */
+    hwll_to_fixed(-v, &u_int, v_frac);
+    *v_int = -(int64_t)u_int;
+    if (*v_frac != 0) {
+      *v_int -= 1;
+      *v_frac = -*v_frac;
+    }
+  }
+}
+
+static void hwll_update_time_conv(void) {
+  double drift, t_off;
+
+  hwll_conv_gen = trivial_xo_params_gen;
+  hwll_conv_fixed = trivial_xo_get_params(&drift, &t_off);
+  if (!hwll_conv_fixed) {
+    return;
+  }
+
+  long double d = 1.0 + drift; /* Computed in double, like the XO model does */
+  long double off_us = (long double)t_off * 1e6L;
+
+  hwll_to_fixed(d, &hwll_dev_from_phy_conv.mul_int, &hwll_dev_from_phy_conv.mul_frac);
+  hwll_to_signed_fixed(-off_us, &hwll_dev_from_phy_conv.add_int, &hwll_dev_from_phy_conv.add_frac);
+  hwll_to_fixed(1.0L / d, &hwll_phy_from_dev_conv.mul_int, &hwll_phy_from_dev_conv.mul_frac);
+  hwll_to_signed_fixed(off_us / d, &hwll_phy_from_dev_conv.add_int, &hwll_phy_from_dev_conv.add_frac);
+}
+
+static inline void hwll_mul_64_64(uint64_t a, uint64_t b, uint64_t *hi, uint64_t *lo) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 p = (unsigned __int128)a * b;
+
+  *hi = (uint64_t)(p >> 64);
+  *lo = (uint64_t)p;
+#else
+  uint64_t a_l = (uint32_t)a, a_h = a >> 32;
+  uint64_t b_l = (uint32_t)b, b_h = b >> 32;
+  uint64_t ll = a_l * b_l, lh = a_l * b_h, hl = a_h * b_l, hh = a_h * b_h;
+  uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+
+  *lo = (mid << 32) | (uint32_t)ll;
+  *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/* Return round(t * c->mul + c->add) */
+static inline bs_time_t hwll_conv_time(bs_time_t t, const struct hwll_time_conv *c) {
+  uint64_t hi, lo, prev;
+
+  hwll_mul_64_64(t, c->mul_frac, &hi, &lo);
+  hi += t * c->mul_int + (uint64_t)c->add_int;
+  prev = lo;
+  lo += c->add_frac;
+  hi += (lo < prev);
+  prev = lo;
+  lo += (uint64_t)1 << 63; /* + 0.5 to round */
+  hi += (lo < prev);
+  return hi;
+}
+
 /**
  * Return the equivalent phy time from a device time
  */
 bs_time_t hwll_phy_time_from_dev(bs_time_t d_t){
   bs_time_t phy_t;
   if ( d_t != TIME_NEVER ) {
+    if (hwll_conv_gen != trivial_xo_params_gen) {
+      hwll_update_time_conv();
+    }
+    if (hwll_conv_fixed) {
+      return hwll_conv_time(d_t, &hwll_phy_from_dev_conv);
+    }
     phy_t = (bs_time_t)(1e6*phy_time_from_dev(((long double)d_t)*1e-6 ) + 0.5);
     //Note: in x86 compiling with GCC for linux long double is 80bit (64bits
     // mantissa), and therefore precission should be kept
@@ -44,6 +158,12 @@ bs_time_t hwll_phy_time_from_dev(bs_time_t d_t){
 uint64_t hwll_dev_time_from_phy(bs_time_t p_t){
   bs_time_t dev_t;
   if ( p_t != TIME_NEVER ) {
+    if (hwll_conv_gen != trivial_xo_params_gen) {
+      hwll_update_time_conv();
+    }
+    if (hwll_conv_fixed) {
+      return hwll_conv_time(p_t, &hwll_dev_from_phy_conv);
+    }
     dev_t = (bs_time_t)(1e6*dev_time_from_phy(((long double)p_t)*1e-6 ) + 0.5);
     //Note: in x86 compiling with GCC for linux long double is 80bit (64bits
     // mantissa), and therefore precission should be kept
@@ -73,6 +193,7 @@ void hwll_sync_time_with_phy(bs_time_t d_time) {
     wait.end = TIME_NEVER;
   }
 
+  nhw_pre_block();
   if ( p2G4_dev_req_wait_nc_b(&wait) != 0){
     bs_trace_raw_manual_time(3, d_time, "The phy disconnected us\n");
     hwll_disconnect_phy_and_exit();
@@ -94,6 +215,7 @@ void hwll_wait_for_phy_simu_time(bs_time_t phy_time){
 
   wait.end = phy_time;
 
+  nhw_pre_block();
   if ( p2G4_dev_req_wait_nc_b(&wait) != 0 ){
     bs_trace_raw_manual_time(3, phy_time, "The phy disconnected us\n");
     hwll_disconnect_phy_and_exit();
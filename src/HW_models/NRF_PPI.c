@@ -15,11 +15,20 @@
  *   * In the real PPI, if two separate events which trigger the same task come close enough to each other
  *     (they are registered by the same 16MHz clock edge), that common task will only be triggered once.
  *     In this model, such events would cause such a tasks to trigger twice.
+ *
+ *   * With the -ppi_stats_csv=<path> and/or -ppi_stats_json=<path> command line options,
+ *     the events which reach an enabled channel are counted (per event and per channel),
+ *     as well as the calls to each task. These are written at exit into those files,
+ *     with the events and tasks given by their register name and real HW address.
+ *     This is meant to find event storms which slow the simulation down.
  */
 
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <inttypes.h>
 #include "NHW_peri_types.h"
 #include "NHW_AAR.h"
 #include "NHW_AES_CCM.h"
@@ -32,8 +41,12 @@
 #include "NHW_RADIO.h"
 #include "NHW_EGU.h"
 #include "NHW_UART.h"
+#include "NHW_misc.h"
+#include "NHW_dma_addr.h"
 #include "bs_tracing.h"
 #include "bs_oswrap.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
 #include "nsi_tasks.h"
 
 NRF_PPI_Type NRF_PPI_regs; ///< The PPI registers
@@ -83,51 +96,54 @@ static ppi_channel_tasks_t ppi_ch_tasks[NUMBER_PPI_CHANNELS];
 typedef struct {
   void *task_addr;
   dest_f_t dest; //function to be called when task is triggered
+  const char *reg_name; //Task register name inside its peripheral (for the activity statistics)
 } ppi_tasks_table_t;
 
+#define PPI_TASK(peri_regs, reg, f) { (void*)&(peri_regs).reg, f, #reg }
+
 /**
  * Table of TASKs addresses (as provided by the SW) vs the model function
  * pointer (which handles the task trigger)
  */
 static const ppi_tasks_table_t ppi_tasks_table[]={ //just the ones we may use
     //POWER CLOCK:
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_LFCLKSTART , nhw_clock0_TASKS_LFCLKSTART},
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_LFCLKSTOP  , nhw_clock0_TASKS_LFCLKSTOP},
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_HFCLKSTART , nhw_clock0_TASKS_HFCLKSTART},
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_HFCLKSTOP  , nhw_clock0_TASKS_HFCLKSTOP},
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_CAL        , nhw_clock0_TASKS_CAL},
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_CTSTART    , nhw_clock0_TASKS_CTSTART},
-    { (void*)&NRF_CLKPWR_regs[0].CLK.TASKS_CTSTOP     , nhw_clock0_TASKS_CTSTOP},
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_LFCLKSTART,  nhw_clock0_TASKS_LFCLKSTART),
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_LFCLKSTOP,   nhw_clock0_TASKS_LFCLKSTOP),
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_HFCLKSTART,  nhw_clock0_TASKS_HFCLKSTART),
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_HFCLKSTOP,   nhw_clock0_TASKS_HFCLKSTOP),
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_CAL,         nhw_clock0_TASKS_CAL),
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_CTSTART,     nhw_clock0_TASKS_CTSTART),
+    PPI_TASK(NRF_CLKPWR_regs[0].CLK, TASKS_CTSTOP,      nhw_clock0_TASKS_CTSTOP),
 
     //RADIO:
-    { (void*)&NRF_RADIO_regs.TASKS_TXEN,         nhw_RADIO_TASK_TXEN},
-    { (void*)&NRF_RADIO_regs.TASKS_RXEN,         nhw_RADIO_TASK_RXEN},
-    { (void*)&NRF_RADIO_regs.TASKS_START,        nhw_RADIO_TASK_START},
-    { (void*)&NRF_RADIO_regs.TASKS_STOP,         nhw_RADIO_TASK_STOP},
-    { (void*)&NRF_RADIO_regs.TASKS_DISABLE,      nhw_RADIO_TASK_DISABLE},
-    { (void*)&NRF_RADIO_regs.TASKS_RSSISTART,    nhw_RADIO_TASK_RSSISTART},
-    { (void*)&NRF_RADIO_regs.TASKS_RSSISTOP,     nhw_RADIO_TASK_RSSISTOP},
-    { (void*)&NRF_RADIO_regs.TASKS_BCSTART,      nhw_RADIO_TASK_BCSTART},
-    { (void*)&NRF_RADIO_regs.TASKS_BCSTOP,       nhw_RADIO_TASK_BCSTOP},
-    { (void*)&NRF_RADIO_regs.TASKS_EDSTART,      nhw_RADIO_TASK_EDSTART},
-    { (void*)&NRF_RADIO_regs.TASKS_EDSTOP,       nhw_RADIO_TASK_EDSTOP},
-    { (void*)&NRF_RADIO_regs.TASKS_CCASTART,     nhw_RADIO_TASK_CCASTART},
-    { (void*)&NRF_RADIO_regs.TASKS_CCASTOP,      nhw_RADIO_TASK_CCASTOP},
+    PPI_TASK(NRF_RADIO_regs, TASKS_TXEN,         nhw_RADIO_TASK_TXEN),
+    PPI_TASK(NRF_RADIO_regs, TASKS_RXEN,         nhw_RADIO_TASK_RXEN),
+    PPI_TASK(NRF_RADIO_regs, TASKS_START,        nhw_RADIO_TASK_START),
+    PPI_TASK(NRF_RADIO_regs, TASKS_STOP,         nhw_RADIO_TASK_STOP),
+    PPI_TASK(NRF_RADIO_regs, TASKS_DISABLE,      nhw_RADIO_TASK_DISABLE),
+    PPI_TASK(NRF_RADIO_regs, TASKS_RSSISTART,    nhw_RADIO_TASK_RSSISTART),
+    PPI_TASK(NRF_RADIO_regs, TASKS_RSSISTOP,     nhw_RADIO_TASK_RSSISTOP),
+    PPI_TASK(NRF_RADIO_regs, TASKS_BCSTART,      nhw_RADIO_TASK_BCSTART),
+    PPI_TASK(NRF_RADIO_regs, TASKS_BCSTOP,       nhw_RADIO_TASK_BCSTOP),
+    PPI_TASK(NRF_RADIO_regs, TASKS_EDSTART,      nhw_RADIO_TASK_EDSTART),
+    PPI_TASK(NRF_RADIO_regs, TASKS_EDSTOP,       nhw_RADIO_TASK_EDSTOP),
+    PPI_TASK(NRF_RADIO_regs, TASKS_CCASTART,     nhw_RADIO_TASK_CCASTART),
+    PPI_TASK(NRF_RADIO_regs, TASKS_CCASTOP,      nhw_RADIO_TASK_CCASTOP),
 
     //UART
-    { (void*)&NRF_UARTE_regs[0].TASKS_STARTRX,  nhw_uarte0_TASKS_STARTRX},
-    { (void*)&NRF_UARTE_regs[0].TASKS_STOPRX,   nhw_uarte0_TASKS_STOPRX},
-    { (void*)&NRF_UARTE_regs[0].TASKS_STARTTX,  nhw_uarte0_TASKS_STARTTX},
-    { (void*)&NRF_UARTE_regs[0].TASKS_STOPTX,   nhw_uarte0_TASKS_STOPTX},
-    { (void*)&((NRF_UART_Type *)&NRF_UARTE_regs[0])->TASKS_SUSPEND,   nhw_uarte0_TASKS_SUSPEND},
-    { (void*)&NRF_UARTE_regs[0].TASKS_FLUSHRX,  nhw_uarte0_TASKS_FLUSHRX},
-
-    { (void*)&NRF_UARTE_regs[1].TASKS_STARTRX,  nhw_uarte1_TASKS_STARTRX},
-    { (void*)&NRF_UARTE_regs[1].TASKS_STOPRX,   nhw_uarte1_TASKS_STOPRX},
-    { (void*)&NRF_UARTE_regs[1].TASKS_STARTTX,  nhw_uarte1_TASKS_STARTTX},
-    { (void*)&NRF_UARTE_regs[1].TASKS_STOPTX,   nhw_uarte1_TASKS_STOPTX},
-    { (void*)&((NRF_UART_Type *)&NRF_UARTE_regs[1])->TASKS_SUSPEND,   nhw_uarte1_TASKS_SUSPEND},
-    { (void*)&NRF_UARTE_regs[1].TASKS_FLUSHRX,  nhw_uarte1_TASKS_FLUSHRX},
+    PPI_TASK(NRF_UARTE_regs[0], TASKS_STARTRX,  nhw_uarte0_TASKS_STARTRX),
+    PPI_TASK(NRF_UARTE_regs[0], TASKS_STOPRX,   nhw_uarte0_TASKS_STOPRX),
+    PPI_TASK(NRF_UARTE_regs[0], TASKS_STARTTX,  nhw_uarte0_TASKS_STARTTX),
+    PPI_TASK(NRF_UARTE_regs[0], TASKS_STOPTX,   nhw_uarte0_TASKS_STOPTX),
+    PPI_TASK(*(NRF_UART_Type *)&NRF_UARTE_regs[0], TASKS_SUSPEND, nhw_uarte0_TASKS_SUSPEND),
+    PPI_TASK(NRF_UARTE_regs[0], TASKS_FLUSHRX,  nhw_uarte0_TASKS_FLUSHRX),
+
+    PPI_TASK(NRF_UARTE_regs[1], TASKS_STARTRX,  nhw_uarte1_TASKS_STARTRX),
+    PPI_TASK(NRF_UARTE_regs[1], TASKS_STOPRX,   nhw_uarte1_TASKS_STOPRX),
+    PPI_TASK(NRF_UARTE_regs[1], TASKS_STARTTX,  nhw_uarte1_TASKS_STARTTX),
+    PPI_TASK(NRF_UARTE_regs[1], TASKS_STOPTX,   nhw_uarte1_TASKS_STOPTX),
+    PPI_TASK(*(NRF_UART_Type *)&NRF_UARTE_regs[1], TASKS_SUSPEND, nhw_uarte1_TASKS_SUSPEND),
+    PPI_TASK(NRF_UARTE_regs[1], TASKS_FLUSHRX,  nhw_uarte1_TASKS_FLUSHRX),
 
     //SPI0
     //TWI0
@@ -136,230 +152,230 @@ static const ppi_tasks_table_t ppi_tasks_table[]={ //just the ones we may use
     //NFCT
 
     //GPIOTE
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[0],  nrf_gpiote_TASKS_OUT_0},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[1],  nrf_gpiote_TASKS_OUT_1},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[2],  nrf_gpiote_TASKS_OUT_2},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[3],  nrf_gpiote_TASKS_OUT_3},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[4],  nrf_gpiote_TASKS_OUT_4},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[5],  nrf_gpiote_TASKS_OUT_5},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[6],  nrf_gpiote_TASKS_OUT_6},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_OUT[7],  nrf_gpiote_TASKS_OUT_7},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[0],  nrf_gpiote_TASKS_SET_0},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[1],  nrf_gpiote_TASKS_SET_1},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[2],  nrf_gpiote_TASKS_SET_2},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[3],  nrf_gpiote_TASKS_SET_3},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[4],  nrf_gpiote_TASKS_SET_4},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[5],  nrf_gpiote_TASKS_SET_5},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[6],  nrf_gpiote_TASKS_SET_6},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_SET[7],  nrf_gpiote_TASKS_SET_7},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[0],  nrf_gpiote_TASKS_CLR_0},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[1],  nrf_gpiote_TASKS_CLR_1},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[2],  nrf_gpiote_TASKS_CLR_2},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[3],  nrf_gpiote_TASKS_CLR_3},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[4],  nrf_gpiote_TASKS_CLR_4},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[5],  nrf_gpiote_TASKS_CLR_5},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[6],  nrf_gpiote_TASKS_CLR_6},
-    { (void*)&NRF_GPIOTE_regs[0].TASKS_CLR[7],  nrf_gpiote_TASKS_CLR_7},
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[0],  nrf_gpiote_TASKS_OUT_0),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[1],  nrf_gpiote_TASKS_OUT_1),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[2],  nrf_gpiote_TASKS_OUT_2),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[3],  nrf_gpiote_TASKS_OUT_3),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[4],  nrf_gpiote_TASKS_OUT_4),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[5],  nrf_gpiote_TASKS_OUT_5),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[6],  nrf_gpiote_TASKS_OUT_6),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_OUT[7],  nrf_gpiote_TASKS_OUT_7),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[0],  nrf_gpiote_TASKS_SET_0),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[1],  nrf_gpiote_TASKS_SET_1),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[2],  nrf_gpiote_TASKS_SET_2),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[3],  nrf_gpiote_TASKS_SET_3),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[4],  nrf_gpiote_TASKS_SET_4),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[5],  nrf_gpiote_TASKS_SET_5),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[6],  nrf_gpiote_TASKS_SET_6),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_SET[7],  nrf_gpiote_TASKS_SET_7),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[0],  nrf_gpiote_TASKS_CLR_0),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[1],  nrf_gpiote_TASKS_CLR_1),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[2],  nrf_gpiote_TASKS_CLR_2),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[3],  nrf_gpiote_TASKS_CLR_3),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[4],  nrf_gpiote_TASKS_CLR_4),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[5],  nrf_gpiote_TASKS_CLR_5),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[6],  nrf_gpiote_TASKS_CLR_6),
+    PPI_TASK(NRF_GPIOTE_regs[0], TASKS_CLR[7],  nrf_gpiote_TASKS_CLR_7),
 
     //SAADC
 
     //TIMER0:
-    { (void*)&NRF_TIMER_regs[0].TASKS_CAPTURE[0],  nhw_timer0_TASK_CAPTURE_0},
-    { (void*)&NRF_TIMER_regs[0].TASKS_CAPTURE[1],  nhw_timer0_TASK_CAPTURE_1},
-    { (void*)&NRF_TIMER_regs[0].TASKS_CAPTURE[2],  nhw_timer0_TASK_CAPTURE_2},
-    { (void*)&NRF_TIMER_regs[0].TASKS_CAPTURE[3],  nhw_timer0_TASK_CAPTURE_3},
-//    { (void*)&NRF_TIMER_regs[0].TASKS_CAPTURE[4],  nhw_timer0_TASK_CAPTURE_4},
-//    { (void*)&NRF_TIMER_regs[0].TASKS_CAPTURE[5],  nhw_timer0_TASK_CAPTURE_5},
-    { (void*)&NRF_TIMER_regs[0].TASKS_CLEAR,       nhw_timer0_TASK_CLEAR},
-    { (void*)&NRF_TIMER_regs[0].TASKS_COUNT,       nhw_timer0_TASK_COUNT},
-    { (void*)&NRF_TIMER_regs[0].TASKS_START,       nhw_timer0_TASK_START},
-    { (void*)&NRF_TIMER_regs[0].TASKS_STOP,        nhw_timer0_TASK_STOP},
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_CAPTURE[0],  nhw_timer0_TASK_CAPTURE_0),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_CAPTURE[1],  nhw_timer0_TASK_CAPTURE_1),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_CAPTURE[2],  nhw_timer0_TASK_CAPTURE_2),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_CAPTURE[3],  nhw_timer0_TASK_CAPTURE_3),
+//    PPI_TASK(NRF_TIMER_regs[0], TASKS_CAPTURE[4], nhw_timer0_TASK_CAPTURE_4),
+//    PPI_TASK(NRF_TIMER_regs[0], TASKS_CAPTURE[5], nhw_timer0_TASK_CAPTURE_5),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_CLEAR,       nhw_timer0_TASK_CLEAR),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_COUNT,       nhw_timer0_TASK_COUNT),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_START,       nhw_timer0_TASK_START),
+    PPI_TASK(NRF_TIMER_regs[0], TASKS_STOP,        nhw_timer0_TASK_STOP),
     //TIMER1:
-    { (void*)&NRF_TIMER_regs[1].TASKS_CAPTURE[0],  nhw_timer1_TASK_CAPTURE_0},
-    { (void*)&NRF_TIMER_regs[1].TASKS_CAPTURE[1],  nhw_timer1_TASK_CAPTURE_1},
-    { (void*)&NRF_TIMER_regs[1].TASKS_CAPTURE[2],  nhw_timer1_TASK_CAPTURE_2},
-    { (void*)&NRF_TIMER_regs[1].TASKS_CAPTURE[3],  nhw_timer1_TASK_CAPTURE_3},
-//    { (void*)&NRF_TIMER_regs[1].TASKS_CAPTURE[4],  nhw_timer1_TASK_CAPTURE_4},
-//    { (void*)&NRF_TIMER_regs[1].TASKS_CAPTURE[5],  nhw_timer1_TASK_CAPTURE_5},
-    { (void*)&NRF_TIMER_regs[1].TASKS_CLEAR,       nhw_timer1_TASK_CLEAR},
-    { (void*)&NRF_TIMER_regs[1].TASKS_COUNT,       nhw_timer1_TASK_COUNT},
-    { (void*)&NRF_TIMER_regs[1].TASKS_START,       nhw_timer1_TASK_START},
-    { (void*)&NRF_TIMER_regs[1].TASKS_STOP,        nhw_timer1_TASK_STOP},
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_CAPTURE[0],  nhw_timer1_TASK_CAPTURE_0),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_CAPTURE[1],  nhw_timer1_TASK_CAPTURE_1),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_CAPTURE[2],  nhw_timer1_TASK_CAPTURE_2),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_CAPTURE[3],  nhw_timer1_TASK_CAPTURE_3),
+//    PPI_TASK(NRF_TIMER_regs[1], TASKS_CAPTURE[4], nhw_timer1_TASK_CAPTURE_4),
+//    PPI_TASK(NRF_TIMER_regs[1], TASKS_CAPTURE[5], nhw_timer1_TASK_CAPTURE_5),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_CLEAR,       nhw_timer1_TASK_CLEAR),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_COUNT,       nhw_timer1_TASK_COUNT),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_START,       nhw_timer1_TASK_START),
+    PPI_TASK(NRF_TIMER_regs[1], TASKS_STOP,        nhw_timer1_TASK_STOP),
     //TIMER2:
-    { (void*)&NRF_TIMER_regs[2].TASKS_CAPTURE[0],  nhw_timer2_TASK_CAPTURE_0},
-    { (void*)&NRF_TIMER_regs[2].TASKS_CAPTURE[1],  nhw_timer2_TASK_CAPTURE_1},
-    { (void*)&NRF_TIMER_regs[2].TASKS_CAPTURE[2],  nhw_timer2_TASK_CAPTURE_2},
-    { (void*)&NRF_TIMER_regs[2].TASKS_CAPTURE[3],  nhw_timer2_TASK_CAPTURE_3},
-//    { (void*)&NRF_TIMER_regs[2].TASKS_CAPTURE[4],  nhw_timer2_TASK_CAPTURE_4},
-//    { (void*)&NRF_TIMER_regs[2].TASKS_CAPTURE[5],  nhw_timer2_TASK_CAPTURE_5},
-    { (void*)&NRF_TIMER_regs[2].TASKS_CLEAR,       nhw_timer2_TASK_CLEAR},
-    { (void*)&NRF_TIMER_regs[2].TASKS_COUNT,       nhw_timer2_TASK_COUNT},
-    { (void*)&NRF_TIMER_regs[2].TASKS_START,       nhw_timer2_TASK_START},
-    { (void*)&NRF_TIMER_regs[2].TASKS_STOP,        nhw_timer2_TASK_STOP},
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_CAPTURE[0],  nhw_timer2_TASK_CAPTURE_0),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_CAPTURE[1],  nhw_timer2_TASK_CAPTURE_1),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_CAPTURE[2],  nhw_timer2_TASK_CAPTURE_2),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_CAPTURE[3],  nhw_timer2_TASK_CAPTURE_3),
+//    PPI_TASK(NRF_TIMER_regs[2], TASKS_CAPTURE[4], nhw_timer2_TASK_CAPTURE_4),
+//    PPI_TASK(NRF_TIMER_regs[2], TASKS_CAPTURE[5], nhw_timer2_TASK_CAPTURE_5),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_CLEAR,       nhw_timer2_TASK_CLEAR),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_COUNT,       nhw_timer2_TASK_COUNT),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_START,       nhw_timer2_TASK_START),
+    PPI_TASK(NRF_TIMER_regs[2], TASKS_STOP,        nhw_timer2_TASK_STOP),
     //TIMER3:
-    { (void*)&NRF_TIMER_regs[3].TASKS_CAPTURE[0],  nhw_timer3_TASK_CAPTURE_0},
-    { (void*)&NRF_TIMER_regs[3].TASKS_CAPTURE[1],  nhw_timer3_TASK_CAPTURE_1},
-    { (void*)&NRF_TIMER_regs[3].TASKS_CAPTURE[2],  nhw_timer3_TASK_CAPTURE_2},
-    { (void*)&NRF_TIMER_regs[3].TASKS_CAPTURE[3],  nhw_timer3_TASK_CAPTURE_3},
-    { (void*)&NRF_TIMER_regs[3].TASKS_CAPTURE[4],  nhw_timer3_TASK_CAPTURE_4},
-    { (void*)&NRF_TIMER_regs[3].TASKS_CAPTURE[5],  nhw_timer3_TASK_CAPTURE_5},
-    { (void*)&NRF_TIMER_regs[3].TASKS_CLEAR,       nhw_timer3_TASK_CLEAR},
-    { (void*)&NRF_TIMER_regs[3].TASKS_COUNT,       nhw_timer3_TASK_COUNT},
-    { (void*)&NRF_TIMER_regs[3].TASKS_START,       nhw_timer3_TASK_START},
-    { (void*)&NRF_TIMER_regs[3].TASKS_STOP,        nhw_timer3_TASK_STOP},
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CAPTURE[0],  nhw_timer3_TASK_CAPTURE_0),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CAPTURE[1],  nhw_timer3_TASK_CAPTURE_1),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CAPTURE[2],  nhw_timer3_TASK_CAPTURE_2),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CAPTURE[3],  nhw_timer3_TASK_CAPTURE_3),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CAPTURE[4],  nhw_timer3_TASK_CAPTURE_4),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CAPTURE[5],  nhw_timer3_TASK_CAPTURE_5),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_CLEAR,       nhw_timer3_TASK_CLEAR),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_COUNT,       nhw_timer3_TASK_COUNT),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_START,       nhw_timer3_TASK_START),
+    PPI_TASK(NRF_TIMER_regs[3], TASKS_STOP,        nhw_timer3_TASK_STOP),
     //TIMER4:
-    { (void*)&NRF_TIMER_regs[4].TASKS_CAPTURE[0],  nhw_timer4_TASK_CAPTURE_0},
-    { (void*)&NRF_TIMER_regs[4].TASKS_CAPTURE[1],  nhw_timer4_TASK_CAPTURE_1},
-    { (void*)&NRF_TIMER_regs[4].TASKS_CAPTURE[2],  nhw_timer4_TASK_CAPTURE_2},
-    { (void*)&NRF_TIMER_regs[4].TASKS_CAPTURE[3],  nhw_timer4_TASK_CAPTURE_3},
-    { (void*)&NRF_TIMER_regs[4].TASKS_CAPTURE[4],  nhw_timer4_TASK_CAPTURE_4},
-    { (void*)&NRF_TIMER_regs[4].TASKS_CAPTURE[5],  nhw_timer4_TASK_CAPTURE_5},
-    { (void*)&NRF_TIMER_regs[4].TASKS_CLEAR,       nhw_timer4_TASK_CLEAR},
-    { (void*)&NRF_TIMER_regs[4].TASKS_COUNT,       nhw_timer4_TASK_COUNT},
-    { (void*)&NRF_TIMER_regs[4].TASKS_START,       nhw_timer4_TASK_START},
-    { (void*)&NRF_TIMER_regs[4].TASKS_STOP,        nhw_timer4_TASK_STOP},
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CAPTURE[0],  nhw_timer4_TASK_CAPTURE_0),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CAPTURE[1],  nhw_timer4_TASK_CAPTURE_1),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CAPTURE[2],  nhw_timer4_TASK_CAPTURE_2),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CAPTURE[3],  nhw_timer4_TASK_CAPTURE_3),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CAPTURE[4],  nhw_timer4_TASK_CAPTURE_4),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CAPTURE[5],  nhw_timer4_TASK_CAPTURE_5),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_CLEAR,       nhw_timer4_TASK_CLEAR),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_COUNT,       nhw_timer4_TASK_COUNT),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_START,       nhw_timer4_TASK_START),
+    PPI_TASK(NRF_TIMER_regs[4], TASKS_STOP,        nhw_timer4_TASK_STOP),
 
     //RTC:
-    { (void*)&(NRF_RTC_regs[0]).TASKS_CLEAR, nhw_rtc0_TASKS_CLEAR},
-    { (void*)&(NRF_RTC_regs[0]).TASKS_START, nhw_rtc0_TASKS_START},
-    { (void*)&(NRF_RTC_regs[0]).TASKS_STOP , nhw_rtc0_TASKS_STOP},
-    { (void*)&(NRF_RTC_regs[0]).TASKS_TRIGOVRFLW , nhw_rtc0_TASKS_TRIGOVRFLW},
-    { (void*)&(NRF_RTC_regs[1]).TASKS_CLEAR, nhw_rtc1_TASKS_CLEAR},
-    { (void*)&(NRF_RTC_regs[1]).TASKS_START, nhw_rtc1_TASKS_START},
-    { (void*)&(NRF_RTC_regs[1]).TASKS_STOP , nhw_rtc1_TASKS_STOP},
-    { (void*)&(NRF_RTC_regs[1]).TASKS_TRIGOVRFLW , nhw_rtc1_TASKS_TRIGOVRFLW},
-    { (void*)&(NRF_RTC_regs[2]).TASKS_CLEAR, nhw_rtc2_TASKS_CLEAR},
-    { (void*)&(NRF_RTC_regs[2]).TASKS_START, nhw_rtc2_TASKS_START},
-    { (void*)&(NRF_RTC_regs[2]).TASKS_STOP , nhw_rtc2_TASKS_STOP},
-    { (void*)&(NRF_RTC_regs[2]).TASKS_TRIGOVRFLW , nhw_rtc2_TASKS_TRIGOVRFLW},
+    PPI_TASK(NRF_RTC_regs[0], TASKS_CLEAR, nhw_rtc0_TASKS_CLEAR),
+    PPI_TASK(NRF_RTC_regs[0], TASKS_START, nhw_rtc0_TASKS_START),
+    PPI_TASK(NRF_RTC_regs[0], TASKS_STOP,  nhw_rtc0_TASKS_STOP),
+    PPI_TASK(NRF_RTC_regs[0], TASKS_TRIGOVRFLW,  nhw_rtc0_TASKS_TRIGOVRFLW),
+    PPI_TASK(NRF_RTC_regs[1], TASKS_CLEAR, nhw_rtc1_TASKS_CLEAR),
+    PPI_TASK(NRF_RTC_regs[1], TASKS_START, nhw_rtc1_TASKS_START),
+    PPI_TASK(NRF_RTC_regs[1], TASKS_STOP,  nhw_rtc1_TASKS_STOP),
+    PPI_TASK(NRF_RTC_regs[1], TASKS_TRIGOVRFLW,  nhw_rtc1_TASKS_TRIGOVRFLW),
+    PPI_TASK(NRF_RTC_regs[2], TASKS_CLEAR, nhw_rtc2_TASKS_CLEAR),
+    PPI_TASK(NRF_RTC_regs[2], TASKS_START, nhw_rtc2_TASKS_START),
+    PPI_TASK(NRF_RTC_regs[2], TASKS_STOP,  nhw_rtc2_TASKS_STOP),
+    PPI_TASK(NRF_RTC_regs[2], TASKS_TRIGOVRFLW,  nhw_rtc2_TASKS_TRIGOVRFLW),
 
     //RNG:
-    { (void*)&NRF_RNG_regs.TASKS_START, nhw_RNG_TASK_START},
-    { (void*)&NRF_RNG_regs.TASKS_STOP , nhw_RNG_TASK_STOP},
+    PPI_TASK(NRF_RNG_regs, TASKS_START, nhw_RNG_TASK_START),
+    PPI_TASK(NRF_RNG_regs, TASKS_STOP,  nhw_RNG_TASK_STOP),
 
     //ECB
 
     //AAR
-    { (void*)&NRF_AAR_regs.TASKS_START , nhw_AAR_TASK_START},
+    PPI_TASK(NRF_AAR_regs, TASKS_START,  nhw_AAR_TASK_START),
 
     //CCM
-    { (void*)&NRF_CCM_regs.TASKS_CRYPT , nhw_CCM_TASK_CRYPT},
-    { (void*)&NRF_CCM_regs.TASKS_RATEOVERRIDE , nhw_CCM_TASK_RATEOVERRIDE},
+    PPI_TASK(NRF_CCM_regs, TASKS_CRYPT,  nhw_CCM_TASK_CRYPT),
+    PPI_TASK(NRF_CCM_regs, TASKS_RATEOVERRIDE,  nhw_CCM_TASK_RATEOVERRIDE),
 
     //PPI:
-    { (void*)&NRF_PPI_regs.TASKS_CHG[0].EN,  nrf_ppi_TASK_CHG0_EN},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[1].EN,  nrf_ppi_TASK_CHG1_EN},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[2].EN,  nrf_ppi_TASK_CHG2_EN},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[3].EN,  nrf_ppi_TASK_CHG3_EN},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[4].EN,  nrf_ppi_TASK_CHG4_EN},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[5].EN,  nrf_ppi_TASK_CHG5_EN},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[0].DIS, nrf_ppi_TASK_CHG0_DIS},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[1].DIS, nrf_ppi_TASK_CHG1_DIS},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[2].DIS, nrf_ppi_TASK_CHG2_DIS},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[3].DIS, nrf_ppi_TASK_CHG3_DIS},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[4].DIS, nrf_ppi_TASK_CHG4_DIS},
-    { (void*)&NRF_PPI_regs.TASKS_CHG[5].DIS, nrf_ppi_TASK_CHG5_DIS},
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[0].EN,  nrf_ppi_TASK_CHG0_EN),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[1].EN,  nrf_ppi_TASK_CHG1_EN),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[2].EN,  nrf_ppi_TASK_CHG2_EN),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[3].EN,  nrf_ppi_TASK_CHG3_EN),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[4].EN,  nrf_ppi_TASK_CHG4_EN),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[5].EN,  nrf_ppi_TASK_CHG5_EN),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[0].DIS, nrf_ppi_TASK_CHG0_DIS),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[1].DIS, nrf_ppi_TASK_CHG1_DIS),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[2].DIS, nrf_ppi_TASK_CHG2_DIS),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[3].DIS, nrf_ppi_TASK_CHG3_DIS),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[4].DIS, nrf_ppi_TASK_CHG4_DIS),
+    PPI_TASK(NRF_PPI_regs, TASKS_CHG[5].DIS, nrf_ppi_TASK_CHG5_DIS),
 
     //EGU:
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[0] , nhw_egu_0_TASK_TRIGGER_0},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[1] , nhw_egu_0_TASK_TRIGGER_1},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[2] , nhw_egu_0_TASK_TRIGGER_2},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[3] , nhw_egu_0_TASK_TRIGGER_3},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[4] , nhw_egu_0_TASK_TRIGGER_4},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[5] , nhw_egu_0_TASK_TRIGGER_5},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[6] , nhw_egu_0_TASK_TRIGGER_6},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[7] , nhw_egu_0_TASK_TRIGGER_7},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[8] , nhw_egu_0_TASK_TRIGGER_8},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[9] , nhw_egu_0_TASK_TRIGGER_9},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[10] , nhw_egu_0_TASK_TRIGGER_10},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[11] , nhw_egu_0_TASK_TRIGGER_11},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[12] , nhw_egu_0_TASK_TRIGGER_12},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[13] , nhw_egu_0_TASK_TRIGGER_13},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[14] , nhw_egu_0_TASK_TRIGGER_14},
-    {(void*)&NRF_EGU_regs[0].TASKS_TRIGGER[15] , nhw_egu_0_TASK_TRIGGER_15},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[0] , nhw_egu_1_TASK_TRIGGER_0},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[1] , nhw_egu_1_TASK_TRIGGER_1},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[2] , nhw_egu_1_TASK_TRIGGER_2},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[3] , nhw_egu_1_TASK_TRIGGER_3},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[4] , nhw_egu_1_TASK_TRIGGER_4},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[5] , nhw_egu_1_TASK_TRIGGER_5},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[6] , nhw_egu_1_TASK_TRIGGER_6},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[7] , nhw_egu_1_TASK_TRIGGER_7},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[8] , nhw_egu_1_TASK_TRIGGER_8},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[9] , nhw_egu_1_TASK_TRIGGER_9},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[10] , nhw_egu_1_TASK_TRIGGER_10},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[11] , nhw_egu_1_TASK_TRIGGER_11},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[12] , nhw_egu_1_TASK_TRIGGER_12},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[13] , nhw_egu_1_TASK_TRIGGER_13},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[14] , nhw_egu_1_TASK_TRIGGER_14},
-    {(void*)&NRF_EGU_regs[1].TASKS_TRIGGER[15] , nhw_egu_1_TASK_TRIGGER_15},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[0] , nhw_egu_2_TASK_TRIGGER_0},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[1] , nhw_egu_2_TASK_TRIGGER_1},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[2] , nhw_egu_2_TASK_TRIGGER_2},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[3] , nhw_egu_2_TASK_TRIGGER_3},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[4] , nhw_egu_2_TASK_TRIGGER_4},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[5] , nhw_egu_2_TASK_TRIGGER_5},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[6] , nhw_egu_2_TASK_TRIGGER_6},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[7] , nhw_egu_2_TASK_TRIGGER_7},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[8] , nhw_egu_2_TASK_TRIGGER_8},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[9] , nhw_egu_2_TASK_TRIGGER_9},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[10] , nhw_egu_2_TASK_TRIGGER_10},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[11] , nhw_egu_2_TASK_TRIGGER_11},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[12] , nhw_egu_2_TASK_TRIGGER_12},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[13] , nhw_egu_2_TASK_TRIGGER_13},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[14] , nhw_egu_2_TASK_TRIGGER_14},
-    {(void*)&NRF_EGU_regs[2].TASKS_TRIGGER[15] , nhw_egu_2_TASK_TRIGGER_15},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[0] , nhw_egu_3_TASK_TRIGGER_0},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[1] , nhw_egu_3_TASK_TRIGGER_1},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[2] , nhw_egu_3_TASK_TRIGGER_2},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[3] , nhw_egu_3_TASK_TRIGGER_3},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[4] , nhw_egu_3_TASK_TRIGGER_4},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[5] , nhw_egu_3_TASK_TRIGGER_5},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[6] , nhw_egu_3_TASK_TRIGGER_6},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[7] , nhw_egu_3_TASK_TRIGGER_7},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[8] , nhw_egu_3_TASK_TRIGGER_8},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[9] , nhw_egu_3_TASK_TRIGGER_9},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[10] , nhw_egu_3_TASK_TRIGGER_10},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[11] , nhw_egu_3_TASK_TRIGGER_11},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[12] , nhw_egu_3_TASK_TRIGGER_12},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[13] , nhw_egu_3_TASK_TRIGGER_13},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[14] , nhw_egu_3_TASK_TRIGGER_14},
-    {(void*)&NRF_EGU_regs[3].TASKS_TRIGGER[15] , nhw_egu_3_TASK_TRIGGER_15},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[0] , nhw_egu_4_TASK_TRIGGER_0},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[1] , nhw_egu_4_TASK_TRIGGER_1},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[2] , nhw_egu_4_TASK_TRIGGER_2},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[3] , nhw_egu_4_TASK_TRIGGER_3},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[4] , nhw_egu_4_TASK_TRIGGER_4},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[5] , nhw_egu_4_TASK_TRIGGER_5},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[6] , nhw_egu_4_TASK_TRIGGER_6},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[7] , nhw_egu_4_TASK_TRIGGER_7},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[8] , nhw_egu_4_TASK_TRIGGER_8},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[9] , nhw_egu_4_TASK_TRIGGER_9},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[10] , nhw_egu_4_TASK_TRIGGER_10},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[11] , nhw_egu_4_TASK_TRIGGER_11},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[12] , nhw_egu_4_TASK_TRIGGER_12},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[13] , nhw_egu_4_TASK_TRIGGER_13},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[14] , nhw_egu_4_TASK_TRIGGER_14},
-    {(void*)&NRF_EGU_regs[4].TASKS_TRIGGER[15] , nhw_egu_4_TASK_TRIGGER_15},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[0] , nhw_egu_5_TASK_TRIGGER_0},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[1] , nhw_egu_5_TASK_TRIGGER_1},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[2] , nhw_egu_5_TASK_TRIGGER_2},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[3] , nhw_egu_5_TASK_TRIGGER_3},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[4] , nhw_egu_5_TASK_TRIGGER_4},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[5] , nhw_egu_5_TASK_TRIGGER_5},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[6] , nhw_egu_5_TASK_TRIGGER_6},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[7] , nhw_egu_5_TASK_TRIGGER_7},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[8] , nhw_egu_5_TASK_TRIGGER_8},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[9] , nhw_egu_5_TASK_TRIGGER_9},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[10] , nhw_egu_5_TASK_TRIGGER_10},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[11] , nhw_egu_5_TASK_TRIGGER_11},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[12] , nhw_egu_5_TASK_TRIGGER_12},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[13] , nhw_egu_5_TASK_TRIGGER_13},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[14] , nhw_egu_5_TASK_TRIGGER_14},
-    {(void*)&NRF_EGU_regs[5].TASKS_TRIGGER[15] , nhw_egu_5_TASK_TRIGGER_15},
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[0],  nhw_egu_0_TASK_TRIGGER_0),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[1],  nhw_egu_0_TASK_TRIGGER_1),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[2],  nhw_egu_0_TASK_TRIGGER_2),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[3],  nhw_egu_0_TASK_TRIGGER_3),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[4],  nhw_egu_0_TASK_TRIGGER_4),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[5],  nhw_egu_0_TASK_TRIGGER_5),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[6],  nhw_egu_0_TASK_TRIGGER_6),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[7],  nhw_egu_0_TASK_TRIGGER_7),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[8],  nhw_egu_0_TASK_TRIGGER_8),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[9],  nhw_egu_0_TASK_TRIGGER_9),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[10],  nhw_egu_0_TASK_TRIGGER_10),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[11],  nhw_egu_0_TASK_TRIGGER_11),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[12],  nhw_egu_0_TASK_TRIGGER_12),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[13],  nhw_egu_0_TASK_TRIGGER_13),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[14],  nhw_egu_0_TASK_TRIGGER_14),
+    PPI_TASK(NRF_EGU_regs[0], TASKS_TRIGGER[15],  nhw_egu_0_TASK_TRIGGER_15),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[0],  nhw_egu_1_TASK_TRIGGER_0),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[1],  nhw_egu_1_TASK_TRIGGER_1),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[2],  nhw_egu_1_TASK_TRIGGER_2),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[3],  nhw_egu_1_TASK_TRIGGER_3),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[4],  nhw_egu_1_TASK_TRIGGER_4),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[5],  nhw_egu_1_TASK_TRIGGER_5),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[6],  nhw_egu_1_TASK_TRIGGER_6),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[7],  nhw_egu_1_TASK_TRIGGER_7),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[8],  nhw_egu_1_TASK_TRIGGER_8),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[9],  nhw_egu_1_TASK_TRIGGER_9),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[10],  nhw_egu_1_TASK_TRIGGER_10),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[11],  nhw_egu_1_TASK_TRIGGER_11),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[12],  nhw_egu_1_TASK_TRIGGER_12),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[13],  nhw_egu_1_TASK_TRIGGER_13),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[14],  nhw_egu_1_TASK_TRIGGER_14),
+    PPI_TASK(NRF_EGU_regs[1], TASKS_TRIGGER[15],  nhw_egu_1_TASK_TRIGGER_15),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[0],  nhw_egu_2_TASK_TRIGGER_0),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[1],  nhw_egu_2_TASK_TRIGGER_1),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[2],  nhw_egu_2_TASK_TRIGGER_2),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[3],  nhw_egu_2_TASK_TRIGGER_3),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[4],  nhw_egu_2_TASK_TRIGGER_4),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[5],  nhw_egu_2_TASK_TRIGGER_5),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[6],  nhw_egu_2_TASK_TRIGGER_6),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[7],  nhw_egu_2_TASK_TRIGGER_7),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[8],  nhw_egu_2_TASK_TRIGGER_8),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[9],  nhw_egu_2_TASK_TRIGGER_9),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[10],  nhw_egu_2_TASK_TRIGGER_10),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[11],  nhw_egu_2_TASK_TRIGGER_11),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[12],  nhw_egu_2_TASK_TRIGGER_12),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[13],  nhw_egu_2_TASK_TRIGGER_13),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[14],  nhw_egu_2_TASK_TRIGGER_14),
+    PPI_TASK(NRF_EGU_regs[2], TASKS_TRIGGER[15],  nhw_egu_2_TASK_TRIGGER_15),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[0],  nhw_egu_3_TASK_TRIGGER_0),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[1],  nhw_egu_3_TASK_TRIGGER_1),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[2],  nhw_egu_3_TASK_TRIGGER_2),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[3],  nhw_egu_3_TASK_TRIGGER_3),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[4],  nhw_egu_3_TASK_TRIGGER_4),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[5],  nhw_egu_3_TASK_TRIGGER_5),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[6],  nhw_egu_3_TASK_TRIGGER_6),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[7],  nhw_egu_3_TASK_TRIGGER_7),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[8],  nhw_egu_3_TASK_TRIGGER_8),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[9],  nhw_egu_3_TASK_TRIGGER_9),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[10],  nhw_egu_3_TASK_TRIGGER_10),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[11],  nhw_egu_3_TASK_TRIGGER_11),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[12],  nhw_egu_3_TASK_TRIGGER_12),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[13],  nhw_egu_3_TASK_TRIGGER_13),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[14],  nhw_egu_3_TASK_TRIGGER_14),
+    PPI_TASK(NRF_EGU_regs[3], TASKS_TRIGGER[15],  nhw_egu_3_TASK_TRIGGER_15),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[0],  nhw_egu_4_TASK_TRIGGER_0),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[1],  nhw_egu_4_TASK_TRIGGER_1),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[2],  nhw_egu_4_TASK_TRIGGER_2),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[3],  nhw_egu_4_TASK_TRIGGER_3),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[4],  nhw_egu_4_TASK_TRIGGER_4),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[5],  nhw_egu_4_TASK_TRIGGER_5),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[6],  nhw_egu_4_TASK_TRIGGER_6),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[7],  nhw_egu_4_TASK_TRIGGER_7),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[8],  nhw_egu_4_TASK_TRIGGER_8),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[9],  nhw_egu_4_TASK_TRIGGER_9),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[10],  nhw_egu_4_TASK_TRIGGER_10),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[11],  nhw_egu_4_TASK_TRIGGER_11),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[12],  nhw_egu_4_TASK_TRIGGER_12),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[13],  nhw_egu_4_TASK_TRIGGER_13),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[14],  nhw_egu_4_TASK_TRIGGER_14),
+    PPI_TASK(NRF_EGU_regs[4], TASKS_TRIGGER[15],  nhw_egu_4_TASK_TRIGGER_15),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[0],  nhw_egu_5_TASK_TRIGGER_0),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[1],  nhw_egu_5_TASK_TRIGGER_1),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[2],  nhw_egu_5_TASK_TRIGGER_2),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[3],  nhw_egu_5_TASK_TRIGGER_3),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[4],  nhw_egu_5_TASK_TRIGGER_4),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[5],  nhw_egu_5_TASK_TRIGGER_5),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[6],  nhw_egu_5_TASK_TRIGGER_6),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[7],  nhw_egu_5_TASK_TRIGGER_7),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[8],  nhw_egu_5_TASK_TRIGGER_8),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[9],  nhw_egu_5_TASK_TRIGGER_9),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[10],  nhw_egu_5_TASK_TRIGGER_10),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[11],  nhw_egu_5_TASK_TRIGGER_11),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[12],  nhw_egu_5_TASK_TRIGGER_12),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[13],  nhw_egu_5_TASK_TRIGGER_13),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[14],  nhw_egu_5_TASK_TRIGGER_14),
+    PPI_TASK(NRF_EGU_regs[5], TASKS_TRIGGER[15],  nhw_egu_5_TASK_TRIGGER_15),
 
     //End marker
-    { NULL, NULL }
+    { NULL, NULL, NULL }
 };
 
 /**
@@ -369,234 +385,237 @@ static const ppi_tasks_table_t ppi_tasks_table[]={ //just the ones we may use
 typedef struct {
   ppi_event_types_t event_type;
   void *event_addr;
+  const char *name; //Event name (for the activity statistics)
 } ppi_event_table_t;
 
+#define PPI_EVENT(type, reg) {type, &reg, #type}
+
 static const ppi_event_table_t ppi_events_table[] = { //better keep same order as in ppi_event_types_t
-    {CLOCK_EVENTS_HFCLKSTARTED, &NRF_CLKPWR_regs[0].CLK.EVENTS_HFCLKSTARTED},
-    {CLOCK_EVENTS_LFCLKSTARTED, &NRF_CLKPWR_regs[0].CLK.EVENTS_LFCLKSTARTED},
-    {CLOCK_EVENTS_DONE        , &NRF_CLKPWR_regs[0].CLK.EVENTS_DONE        },
-    {CLOCK_EVENTS_CTTO        , &NRF_CLKPWR_regs[0].CLK.EVENTS_CTTO        },
-    {CLOCK_EVENTS_CTSTARTED   , &NRF_CLKPWR_regs[0].CLK.EVENTS_CTSTARTED   },
-    {CLOCK_EVENTS_CTSTOPPED   , &NRF_CLKPWR_regs[0].CLK.EVENTS_CTSTOPPED   },
-
-    {RADIO_EVENTS_READY,   &NRF_RADIO_regs.EVENTS_READY},
-    {RADIO_EVENTS_ADDRESS, &NRF_RADIO_regs.EVENTS_ADDRESS},
-    {RADIO_EVENTS_PAYLOAD, &NRF_RADIO_regs.EVENTS_PAYLOAD},
-    {RADIO_EVENTS_END,     &NRF_RADIO_regs.EVENTS_END},
-    {RADIO_EVENTS_DISABLED,&NRF_RADIO_regs.EVENTS_DISABLED},
-    {RADIO_EVENTS_DEVMATCH,&NRF_RADIO_regs.EVENTS_DEVMATCH},
-    {RADIO_EVENTS_DEVMISS ,&NRF_RADIO_regs.EVENTS_DEVMISS},
-    {RADIO_EVENTS_RSSIEND, &NRF_RADIO_regs.EVENTS_RSSIEND},
-    {RADIO_EVENTS_BCMATCH, &NRF_RADIO_regs.EVENTS_BCMATCH},
-    {RADIO_EVENTS_CRCOK,   &NRF_RADIO_regs.EVENTS_CRCOK},
-    {RADIO_EVENTS_CRCERROR,&NRF_RADIO_regs.EVENTS_CRCERROR},
-    {RADIO_EVENTS_FRAMESTART,&NRF_RADIO_regs.EVENTS_FRAMESTART},
-    {RADIO_EVENTS_EDEND,   &NRF_RADIO_regs.EVENTS_EDEND},
-    {RADIO_EVENTS_EDSTOPPED, &NRF_RADIO_regs.EVENTS_EDSTOPPED},
-    {RADIO_EVENTS_CCAIDLE, &NRF_RADIO_regs.EVENTS_CCAIDLE},
-    {RADIO_EVENTS_CCABUSY, &NRF_RADIO_regs.EVENTS_CCABUSY},
-    {RADIO_EVENTS_CCASTOPPED, &NRF_RADIO_regs.EVENTS_CCASTOPPED},
-    {RADIO_EVENTS_RATEBOOST, &NRF_RADIO_regs.EVENTS_RATEBOOST},
-    {RADIO_EVENTS_TXREADY, &NRF_RADIO_regs.EVENTS_TXREADY},
-    {RADIO_EVENTS_RXREADY, &NRF_RADIO_regs.EVENTS_RXREADY},
-    {RADIO_EVENTS_MHRMATCH,&NRF_RADIO_regs.EVENTS_MHRMATCH},
-    {RADIO_EVENTS_SYNC,    &NRF_RADIO_regs.EVENTS_SYNC},
-    {RADIO_EVENTS_PHYEND,  &NRF_RADIO_regs.EVENTS_PHYEND},
-    {RADIO_EVENTS_CTEPRESENT,&NRF_RADIO_regs.EVENTS_CTEPRESENT},
-
-    {UARTE0_EVENTS_CTS      , &NRF_UARTE_regs[0].EVENTS_CTS      },
-    {UARTE0_EVENTS_NCTS     , &NRF_UARTE_regs[0].EVENTS_NCTS     },
-    {UARTE0_EVENTS_RXDRDY   , &NRF_UARTE_regs[0].EVENTS_RXDRDY   },
-    {UARTE0_EVENTS_ENDRX    , &NRF_UARTE_regs[0].EVENTS_ENDRX    },
-    {UARTE0_EVENTS_TXDRDY   , &NRF_UARTE_regs[0].EVENTS_TXDRDY   },
-    {UARTE0_EVENTS_ENDTX    , &NRF_UARTE_regs[0].EVENTS_ENDTX    },
-    {UARTE0_EVENTS_ERROR    , &NRF_UARTE_regs[0].EVENTS_ERROR    },
-    {UARTE0_EVENTS_RXTO     , &NRF_UARTE_regs[0].EVENTS_RXTO     },
-    {UARTE0_EVENTS_RXSTARTED, &NRF_UARTE_regs[0].EVENTS_RXSTARTED},
-    {UARTE0_EVENTS_TXSTARTED, &NRF_UARTE_regs[0].EVENTS_TXSTARTED},
-    {UARTE0_EVENTS_TXSTOPPED, &NRF_UARTE_regs[0].EVENTS_TXSTOPPED},
-
-    {GPIOTE_EVENTS_IN_0, &NRF_GPIOTE_regs[0].EVENTS_IN[0]},
-    {GPIOTE_EVENTS_IN_1, &NRF_GPIOTE_regs[0].EVENTS_IN[1]},
-    {GPIOTE_EVENTS_IN_2, &NRF_GPIOTE_regs[0].EVENTS_IN[2]},
-    {GPIOTE_EVENTS_IN_3, &NRF_GPIOTE_regs[0].EVENTS_IN[3]},
-    {GPIOTE_EVENTS_IN_4, &NRF_GPIOTE_regs[0].EVENTS_IN[4]},
-    {GPIOTE_EVENTS_IN_5, &NRF_GPIOTE_regs[0].EVENTS_IN[5]},
-    {GPIOTE_EVENTS_IN_6, &NRF_GPIOTE_regs[0].EVENTS_IN[6]},
-    {GPIOTE_EVENTS_IN_7, &NRF_GPIOTE_regs[0].EVENTS_IN[7]},
-    {GPIOTE_EVENTS_PORT, &NRF_GPIOTE_regs[0].EVENTS_PORT},
-
-    {TIMER0_EVENTS_COMPARE_0, &NRF_TIMER_regs[0].EVENTS_COMPARE[0]},
-    {TIMER0_EVENTS_COMPARE_1, &NRF_TIMER_regs[0].EVENTS_COMPARE[1]},
-    {TIMER0_EVENTS_COMPARE_2, &NRF_TIMER_regs[0].EVENTS_COMPARE[2]},
-    {TIMER0_EVENTS_COMPARE_3, &NRF_TIMER_regs[0].EVENTS_COMPARE[3]},
-//    {TIMER0_EVENTS_COMPARE_4, &NRF_TIMER_regs[0].EVENTS_COMPARE[4]},
-//    {TIMER0_EVENTS_COMPARE_5, &NRF_TIMER_regs[0].EVENTS_COMPARE[5]},
-
-    {TIMER1_EVENTS_COMPARE_0, &NRF_TIMER_regs[1].EVENTS_COMPARE[0]},
-    {TIMER1_EVENTS_COMPARE_1, &NRF_TIMER_regs[1].EVENTS_COMPARE[1]},
-    {TIMER1_EVENTS_COMPARE_2, &NRF_TIMER_regs[1].EVENTS_COMPARE[2]},
-    {TIMER1_EVENTS_COMPARE_3, &NRF_TIMER_regs[1].EVENTS_COMPARE[3]},
-    //    {TIMER1_EVENTS_COMPARE_4, &NRF_TIMER_regs[1].EVENTS_COMPARE[4]},
-    //    {TIMER1_EVENTS_COMPARE_5, &NRF_TIMER_regs[1].EVENTS_COMPARE[5]},
-
-    {TIMER2_EVENTS_COMPARE_0, &NRF_TIMER_regs[2].EVENTS_COMPARE[0]},
-    {TIMER2_EVENTS_COMPARE_1, &NRF_TIMER_regs[2].EVENTS_COMPARE[1]},
-    {TIMER2_EVENTS_COMPARE_2, &NRF_TIMER_regs[2].EVENTS_COMPARE[2]},
-    {TIMER2_EVENTS_COMPARE_3, &NRF_TIMER_regs[2].EVENTS_COMPARE[3]},
-    //    {TIMER2_EVENTS_COMPARE_4, &NRF_TIMER_regs[2].EVENTS_COMPARE[4]},
-    //    {TIMER2_EVENTS_COMPARE_5, &NRF_TIMER_regs[2].EVENTS_COMPARE[5]},
-
-    {RTC0_EVENTS_OVRFLW, &NRF_RTC_regs[0].EVENTS_OVRFLW},
-    {RTC0_EVENTS_COMPARE_0, &NRF_RTC_regs[0].EVENTS_COMPARE[0]},
-    {RTC0_EVENTS_COMPARE_1, &NRF_RTC_regs[0].EVENTS_COMPARE[1]},
-    {RTC0_EVENTS_COMPARE_2, &NRF_RTC_regs[0].EVENTS_COMPARE[2]},
-    {RTC0_EVENTS_COMPARE_3, &NRF_RTC_regs[0].EVENTS_COMPARE[3]},
-
-    {TEMP_EVENTS_DATARDY, &NRF_TEMP_regs.EVENTS_DATARDY},
-
-    //{RNG_EVENTS_VALRDY, &NRF_RNG_regs.EVENTS_VALRDY},
-
-    {CCM_EVENTS_ENDKSGEN, &NRF_CCM_regs.EVENTS_ENDKSGEN},
-    {CCM_EVENTS_ENDCRYPT, &NRF_CCM_regs.EVENTS_ENDCRYPT},
-    {CCM_EVENTS_ERROR,    &NRF_CCM_regs.EVENTS_ERROR},
-
-    {RTC1_EVENTS_OVRFLW, &NRF_RTC_regs[1].EVENTS_OVRFLW},
-    {RTC1_EVENTS_COMPARE_0, &NRF_RTC_regs[1].EVENTS_COMPARE[0]},
-    {RTC1_EVENTS_COMPARE_1, &NRF_RTC_regs[1].EVENTS_COMPARE[1]},
-    {RTC1_EVENTS_COMPARE_2, &NRF_RTC_regs[1].EVENTS_COMPARE[2]},
-    {RTC1_EVENTS_COMPARE_3, &NRF_RTC_regs[1].EVENTS_COMPARE[3]},
-
-    {EGU0_EVENTS_TRIGGERED_0, &NRF_EGU_regs[0].EVENTS_TRIGGERED[0]}, /*These are autogenerated (See NRF_EGU.c)*/
-    {EGU0_EVENTS_TRIGGERED_1, &NRF_EGU_regs[0].EVENTS_TRIGGERED[1]},
-    {EGU0_EVENTS_TRIGGERED_2, &NRF_EGU_regs[0].EVENTS_TRIGGERED[2]},
-    {EGU0_EVENTS_TRIGGERED_3, &NRF_EGU_regs[0].EVENTS_TRIGGERED[3]},
-    {EGU0_EVENTS_TRIGGERED_4, &NRF_EGU_regs[0].EVENTS_TRIGGERED[4]},
-    {EGU0_EVENTS_TRIGGERED_5, &NRF_EGU_regs[0].EVENTS_TRIGGERED[5]},
-    {EGU0_EVENTS_TRIGGERED_6, &NRF_EGU_regs[0].EVENTS_TRIGGERED[6]},
-    {EGU0_EVENTS_TRIGGERED_7, &NRF_EGU_regs[0].EVENTS_TRIGGERED[7]},
-    {EGU0_EVENTS_TRIGGERED_8, &NRF_EGU_regs[0].EVENTS_TRIGGERED[8]},
-    {EGU0_EVENTS_TRIGGERED_9, &NRF_EGU_regs[0].EVENTS_TRIGGERED[9]},
-    {EGU0_EVENTS_TRIGGERED_10, &NRF_EGU_regs[0].EVENTS_TRIGGERED[10]},
-    {EGU0_EVENTS_TRIGGERED_11, &NRF_EGU_regs[0].EVENTS_TRIGGERED[11]},
-    {EGU0_EVENTS_TRIGGERED_12, &NRF_EGU_regs[0].EVENTS_TRIGGERED[12]},
-    {EGU0_EVENTS_TRIGGERED_13, &NRF_EGU_regs[0].EVENTS_TRIGGERED[13]},
-    {EGU0_EVENTS_TRIGGERED_14, &NRF_EGU_regs[0].EVENTS_TRIGGERED[14]},
-    {EGU0_EVENTS_TRIGGERED_15, &NRF_EGU_regs[0].EVENTS_TRIGGERED[15]},
-    {EGU1_EVENTS_TRIGGERED_0, &NRF_EGU_regs[1].EVENTS_TRIGGERED[0]},
-    {EGU1_EVENTS_TRIGGERED_1, &NRF_EGU_regs[1].EVENTS_TRIGGERED[1]},
-    {EGU1_EVENTS_TRIGGERED_2, &NRF_EGU_regs[1].EVENTS_TRIGGERED[2]},
-    {EGU1_EVENTS_TRIGGERED_3, &NRF_EGU_regs[1].EVENTS_TRIGGERED[3]},
-    {EGU1_EVENTS_TRIGGERED_4, &NRF_EGU_regs[1].EVENTS_TRIGGERED[4]},
-    {EGU1_EVENTS_TRIGGERED_5, &NRF_EGU_regs[1].EVENTS_TRIGGERED[5]},
-    {EGU1_EVENTS_TRIGGERED_6, &NRF_EGU_regs[1].EVENTS_TRIGGERED[6]},
-    {EGU1_EVENTS_TRIGGERED_7, &NRF_EGU_regs[1].EVENTS_TRIGGERED[7]},
-    {EGU1_EVENTS_TRIGGERED_8, &NRF_EGU_regs[1].EVENTS_TRIGGERED[8]},
-    {EGU1_EVENTS_TRIGGERED_9, &NRF_EGU_regs[1].EVENTS_TRIGGERED[9]},
-    {EGU1_EVENTS_TRIGGERED_10, &NRF_EGU_regs[1].EVENTS_TRIGGERED[10]},
-    {EGU1_EVENTS_TRIGGERED_11, &NRF_EGU_regs[1].EVENTS_TRIGGERED[11]},
-    {EGU1_EVENTS_TRIGGERED_12, &NRF_EGU_regs[1].EVENTS_TRIGGERED[12]},
-    {EGU1_EVENTS_TRIGGERED_13, &NRF_EGU_regs[1].EVENTS_TRIGGERED[13]},
-    {EGU1_EVENTS_TRIGGERED_14, &NRF_EGU_regs[1].EVENTS_TRIGGERED[14]},
-    {EGU1_EVENTS_TRIGGERED_15, &NRF_EGU_regs[1].EVENTS_TRIGGERED[15]},
-    {EGU2_EVENTS_TRIGGERED_0, &NRF_EGU_regs[2].EVENTS_TRIGGERED[0]},
-    {EGU2_EVENTS_TRIGGERED_1, &NRF_EGU_regs[2].EVENTS_TRIGGERED[1]},
-    {EGU2_EVENTS_TRIGGERED_2, &NRF_EGU_regs[2].EVENTS_TRIGGERED[2]},
-    {EGU2_EVENTS_TRIGGERED_3, &NRF_EGU_regs[2].EVENTS_TRIGGERED[3]},
-    {EGU2_EVENTS_TRIGGERED_4, &NRF_EGU_regs[2].EVENTS_TRIGGERED[4]},
-    {EGU2_EVENTS_TRIGGERED_5, &NRF_EGU_regs[2].EVENTS_TRIGGERED[5]},
-    {EGU2_EVENTS_TRIGGERED_6, &NRF_EGU_regs[2].EVENTS_TRIGGERED[6]},
-    {EGU2_EVENTS_TRIGGERED_7, &NRF_EGU_regs[2].EVENTS_TRIGGERED[7]},
-    {EGU2_EVENTS_TRIGGERED_8, &NRF_EGU_regs[2].EVENTS_TRIGGERED[8]},
-    {EGU2_EVENTS_TRIGGERED_9, &NRF_EGU_regs[2].EVENTS_TRIGGERED[9]},
-    {EGU2_EVENTS_TRIGGERED_10, &NRF_EGU_regs[2].EVENTS_TRIGGERED[10]},
-    {EGU2_EVENTS_TRIGGERED_11, &NRF_EGU_regs[2].EVENTS_TRIGGERED[11]},
-    {EGU2_EVENTS_TRIGGERED_12, &NRF_EGU_regs[2].EVENTS_TRIGGERED[12]},
-    {EGU2_EVENTS_TRIGGERED_13, &NRF_EGU_regs[2].EVENTS_TRIGGERED[13]},
-    {EGU2_EVENTS_TRIGGERED_14, &NRF_EGU_regs[2].EVENTS_TRIGGERED[14]},
-    {EGU2_EVENTS_TRIGGERED_15, &NRF_EGU_regs[2].EVENTS_TRIGGERED[15]},
-    {EGU3_EVENTS_TRIGGERED_0, &NRF_EGU_regs[3].EVENTS_TRIGGERED[0]},
-    {EGU3_EVENTS_TRIGGERED_1, &NRF_EGU_regs[3].EVENTS_TRIGGERED[1]},
-    {EGU3_EVENTS_TRIGGERED_2, &NRF_EGU_regs[3].EVENTS_TRIGGERED[2]},
-    {EGU3_EVENTS_TRIGGERED_3, &NRF_EGU_regs[3].EVENTS_TRIGGERED[3]},
-    {EGU3_EVENTS_TRIGGERED_4, &NRF_EGU_regs[3].EVENTS_TRIGGERED[4]},
-    {EGU3_EVENTS_TRIGGERED_5, &NRF_EGU_regs[3].EVENTS_TRIGGERED[5]},
-    {EGU3_EVENTS_TRIGGERED_6, &NRF_EGU_regs[3].EVENTS_TRIGGERED[6]},
-    {EGU3_EVENTS_TRIGGERED_7, &NRF_EGU_regs[3].EVENTS_TRIGGERED[7]},
-    {EGU3_EVENTS_TRIGGERED_8, &NRF_EGU_regs[3].EVENTS_TRIGGERED[8]},
-    {EGU3_EVENTS_TRIGGERED_9, &NRF_EGU_regs[3].EVENTS_TRIGGERED[9]},
-    {EGU3_EVENTS_TRIGGERED_10, &NRF_EGU_regs[3].EVENTS_TRIGGERED[10]},
-    {EGU3_EVENTS_TRIGGERED_11, &NRF_EGU_regs[3].EVENTS_TRIGGERED[11]},
-    {EGU3_EVENTS_TRIGGERED_12, &NRF_EGU_regs[3].EVENTS_TRIGGERED[12]},
-    {EGU3_EVENTS_TRIGGERED_13, &NRF_EGU_regs[3].EVENTS_TRIGGERED[13]},
-    {EGU3_EVENTS_TRIGGERED_14, &NRF_EGU_regs[3].EVENTS_TRIGGERED[14]},
-    {EGU3_EVENTS_TRIGGERED_15, &NRF_EGU_regs[3].EVENTS_TRIGGERED[15]},
-    {EGU4_EVENTS_TRIGGERED_0, &NRF_EGU_regs[4].EVENTS_TRIGGERED[0]},
-    {EGU4_EVENTS_TRIGGERED_1, &NRF_EGU_regs[4].EVENTS_TRIGGERED[1]},
-    {EGU4_EVENTS_TRIGGERED_2, &NRF_EGU_regs[4].EVENTS_TRIGGERED[2]},
-    {EGU4_EVENTS_TRIGGERED_3, &NRF_EGU_regs[4].EVENTS_TRIGGERED[3]},
-    {EGU4_EVENTS_TRIGGERED_4, &NRF_EGU_regs[4].EVENTS_TRIGGERED[4]},
-    {EGU4_EVENTS_TRIGGERED_5, &NRF_EGU_regs[4].EVENTS_TRIGGERED[5]},
-    {EGU4_EVENTS_TRIGGERED_6, &NRF_EGU_regs[4].EVENTS_TRIGGERED[6]},
-    {EGU4_EVENTS_TRIGGERED_7, &NRF_EGU_regs[4].EVENTS_TRIGGERED[7]},
-    {EGU4_EVENTS_TRIGGERED_8, &NRF_EGU_regs[4].EVENTS_TRIGGERED[8]},
-    {EGU4_EVENTS_TRIGGERED_9, &NRF_EGU_regs[4].EVENTS_TRIGGERED[9]},
-    {EGU4_EVENTS_TRIGGERED_10, &NRF_EGU_regs[4].EVENTS_TRIGGERED[10]},
-    {EGU4_EVENTS_TRIGGERED_11, &NRF_EGU_regs[4].EVENTS_TRIGGERED[11]},
-    {EGU4_EVENTS_TRIGGERED_12, &NRF_EGU_regs[4].EVENTS_TRIGGERED[12]},
-    {EGU4_EVENTS_TRIGGERED_13, &NRF_EGU_regs[4].EVENTS_TRIGGERED[13]},
-    {EGU4_EVENTS_TRIGGERED_14, &NRF_EGU_regs[4].EVENTS_TRIGGERED[14]},
-    {EGU4_EVENTS_TRIGGERED_15, &NRF_EGU_regs[4].EVENTS_TRIGGERED[15]},
-    {EGU5_EVENTS_TRIGGERED_0, &NRF_EGU_regs[5].EVENTS_TRIGGERED[0]},
-    {EGU5_EVENTS_TRIGGERED_1, &NRF_EGU_regs[5].EVENTS_TRIGGERED[1]},
-    {EGU5_EVENTS_TRIGGERED_2, &NRF_EGU_regs[5].EVENTS_TRIGGERED[2]},
-    {EGU5_EVENTS_TRIGGERED_3, &NRF_EGU_regs[5].EVENTS_TRIGGERED[3]},
-    {EGU5_EVENTS_TRIGGERED_4, &NRF_EGU_regs[5].EVENTS_TRIGGERED[4]},
-    {EGU5_EVENTS_TRIGGERED_5, &NRF_EGU_regs[5].EVENTS_TRIGGERED[5]},
-    {EGU5_EVENTS_TRIGGERED_6, &NRF_EGU_regs[5].EVENTS_TRIGGERED[6]},
-    {EGU5_EVENTS_TRIGGERED_7, &NRF_EGU_regs[5].EVENTS_TRIGGERED[7]},
-    {EGU5_EVENTS_TRIGGERED_8, &NRF_EGU_regs[5].EVENTS_TRIGGERED[8]},
-    {EGU5_EVENTS_TRIGGERED_9, &NRF_EGU_regs[5].EVENTS_TRIGGERED[9]},
-    {EGU5_EVENTS_TRIGGERED_10, &NRF_EGU_regs[5].EVENTS_TRIGGERED[10]},
-    {EGU5_EVENTS_TRIGGERED_11, &NRF_EGU_regs[5].EVENTS_TRIGGERED[11]},
-    {EGU5_EVENTS_TRIGGERED_12, &NRF_EGU_regs[5].EVENTS_TRIGGERED[12]},
-    {EGU5_EVENTS_TRIGGERED_13, &NRF_EGU_regs[5].EVENTS_TRIGGERED[13]},
-    {EGU5_EVENTS_TRIGGERED_14, &NRF_EGU_regs[5].EVENTS_TRIGGERED[14]},
-    {EGU5_EVENTS_TRIGGERED_15, &NRF_EGU_regs[5].EVENTS_TRIGGERED[15]},
-
-    {TIMER3_EVENTS_COMPARE_0, &NRF_TIMER_regs[3].EVENTS_COMPARE[0]},
-    {TIMER3_EVENTS_COMPARE_1, &NRF_TIMER_regs[3].EVENTS_COMPARE[1]},
-    {TIMER3_EVENTS_COMPARE_2, &NRF_TIMER_regs[3].EVENTS_COMPARE[2]},
-    {TIMER3_EVENTS_COMPARE_3, &NRF_TIMER_regs[3].EVENTS_COMPARE[3]},
-    {TIMER3_EVENTS_COMPARE_4, &NRF_TIMER_regs[3].EVENTS_COMPARE[4]},
-    {TIMER3_EVENTS_COMPARE_5, &NRF_TIMER_regs[3].EVENTS_COMPARE[5]},
-
-    {TIMER4_EVENTS_COMPARE_0, &NRF_TIMER_regs[4].EVENTS_COMPARE[0]},
-    {TIMER4_EVENTS_COMPARE_1, &NRF_TIMER_regs[4].EVENTS_COMPARE[1]},
-    {TIMER4_EVENTS_COMPARE_2, &NRF_TIMER_regs[4].EVENTS_COMPARE[2]},
-    {TIMER4_EVENTS_COMPARE_3, &NRF_TIMER_regs[4].EVENTS_COMPARE[3]},
-    {TIMER4_EVENTS_COMPARE_4, &NRF_TIMER_regs[4].EVENTS_COMPARE[4]},
-    {TIMER4_EVENTS_COMPARE_5, &NRF_TIMER_regs[4].EVENTS_COMPARE[5]},
-
-    {RTC2_EVENTS_OVRFLW, &NRF_RTC_regs[2].EVENTS_OVRFLW},
-    {RTC2_EVENTS_COMPARE_0, &NRF_RTC_regs[2].EVENTS_COMPARE[0]},
-    {RTC2_EVENTS_COMPARE_1, &NRF_RTC_regs[2].EVENTS_COMPARE[1]},
-    {RTC2_EVENTS_COMPARE_2, &NRF_RTC_regs[2].EVENTS_COMPARE[2]},
-    {RTC2_EVENTS_COMPARE_3, &NRF_RTC_regs[2].EVENTS_COMPARE[3]},
-
-    {UARTE1_EVENTS_CTS      , &NRF_UARTE_regs[1].EVENTS_CTS      },
-    {UARTE1_EVENTS_NCTS     , &NRF_UARTE_regs[1].EVENTS_NCTS     },
-    {UARTE1_EVENTS_RXDRDY   , &NRF_UARTE_regs[1].EVENTS_RXDRDY   },
-    {UARTE1_EVENTS_ENDRX    , &NRF_UARTE_regs[1].EVENTS_ENDRX    },
-    {UARTE1_EVENTS_TXDRDY   , &NRF_UARTE_regs[1].EVENTS_TXDRDY   },
-    {UARTE1_EVENTS_ENDTX    , &NRF_UARTE_regs[1].EVENTS_ENDTX    },
-    {UARTE1_EVENTS_ERROR    , &NRF_UARTE_regs[1].EVENTS_ERROR    },
-    {UARTE1_EVENTS_RXTO     , &NRF_UARTE_regs[1].EVENTS_RXTO     },
-    {UARTE1_EVENTS_RXSTARTED, &NRF_UARTE_regs[1].EVENTS_RXSTARTED},
-    {UARTE1_EVENTS_TXSTARTED, &NRF_UARTE_regs[1].EVENTS_TXSTARTED},
-    {UARTE1_EVENTS_TXSTOPPED, &NRF_UARTE_regs[1].EVENTS_TXSTOPPED},
-
-    {NUMBER_PPI_EVENTS, NULL} //End marker
+    PPI_EVENT(CLOCK_EVENTS_HFCLKSTARTED, NRF_CLKPWR_regs[0].CLK.EVENTS_HFCLKSTARTED),
+    PPI_EVENT(CLOCK_EVENTS_LFCLKSTARTED, NRF_CLKPWR_regs[0].CLK.EVENTS_LFCLKSTARTED),
+    PPI_EVENT(CLOCK_EVENTS_DONE,         NRF_CLKPWR_regs[0].CLK.EVENTS_DONE),
+    PPI_EVENT(CLOCK_EVENTS_CTTO,         NRF_CLKPWR_regs[0].CLK.EVENTS_CTTO),
+    PPI_EVENT(CLOCK_EVENTS_CTSTARTED,    NRF_CLKPWR_regs[0].CLK.EVENTS_CTSTARTED),
+    PPI_EVENT(CLOCK_EVENTS_CTSTOPPED,    NRF_CLKPWR_regs[0].CLK.EVENTS_CTSTOPPED),
+
+    PPI_EVENT(RADIO_EVENTS_READY,   NRF_RADIO_regs.EVENTS_READY),
+    PPI_EVENT(RADIO_EVENTS_ADDRESS, NRF_RADIO_regs.EVENTS_ADDRESS),
+    PPI_EVENT(RADIO_EVENTS_PAYLOAD, NRF_RADIO_regs.EVENTS_PAYLOAD),
+    PPI_EVENT(RADIO_EVENTS_END,     NRF_RADIO_regs.EVENTS_END),
+    PPI_EVENT(RADIO_EVENTS_DISABLED, NRF_RADIO_regs.EVENTS_DISABLED),
+    PPI_EVENT(RADIO_EVENTS_DEVMATCH, NRF_RADIO_regs.EVENTS_DEVMATCH),
+    PPI_EVENT(RADIO_EVENTS_DEVMISS,  NRF_RADIO_regs.EVENTS_DEVMISS),
+    PPI_EVENT(RADIO_EVENTS_RSSIEND, NRF_RADIO_regs.EVENTS_RSSIEND),
+    PPI_EVENT(RADIO_EVENTS_BCMATCH, NRF_RADIO_regs.EVENTS_BCMATCH),
+    PPI_EVENT(RADIO_EVENTS_CRCOK,   NRF_RADIO_regs.EVENTS_CRCOK),
+    PPI_EVENT(RADIO_EVENTS_CRCERROR, NRF_RADIO_regs.EVENTS_CRCERROR),
+    PPI_EVENT(RADIO_EVENTS_FRAMESTART, NRF_RADIO_regs.EVENTS_FRAMESTART),
+    PPI_EVENT(RADIO_EVENTS_EDEND,   NRF_RADIO_regs.EVENTS_EDEND),
+    PPI_EVENT(RADIO_EVENTS_EDSTOPPED, NRF_RADIO_regs.EVENTS_EDSTOPPED),
+    PPI_EVENT(RADIO_EVENTS_CCAIDLE, NRF_RADIO_regs.EVENTS_CCAIDLE),
+    PPI_EVENT(RADIO_EVENTS_CCABUSY, NRF_RADIO_regs.EVENTS_CCABUSY),
+    PPI_EVENT(RADIO_EVENTS_CCASTOPPED, NRF_RADIO_regs.EVENTS_CCASTOPPED),
+    PPI_EVENT(RADIO_EVENTS_RATEBOOST, NRF_RADIO_regs.EVENTS_RATEBOOST),
+    PPI_EVENT(RADIO_EVENTS_TXREADY, NRF_RADIO_regs.EVENTS_TXREADY),
+    PPI_EVENT(RADIO_EVENTS_RXREADY, NRF_RADIO_regs.EVENTS_RXREADY),
+    PPI_EVENT(RADIO_EVENTS_MHRMATCH, NRF_RADIO_regs.EVENTS_MHRMATCH),
+    PPI_EVENT(RADIO_EVENTS_SYNC,    NRF_RADIO_regs.EVENTS_SYNC),
+    PPI_EVENT(RADIO_EVENTS_PHYEND,  NRF_RADIO_regs.EVENTS_PHYEND),
+    PPI_EVENT(RADIO_EVENTS_CTEPRESENT, NRF_RADIO_regs.EVENTS_CTEPRESENT),
+
+    PPI_EVENT(UARTE0_EVENTS_CTS,       NRF_UARTE_regs[0].EVENTS_CTS),
+    PPI_EVENT(UARTE0_EVENTS_NCTS,      NRF_UARTE_regs[0].EVENTS_NCTS),
+    PPI_EVENT(UARTE0_EVENTS_RXDRDY,    NRF_UARTE_regs[0].EVENTS_RXDRDY),
+    PPI_EVENT(UARTE0_EVENTS_ENDRX,     NRF_UARTE_regs[0].EVENTS_ENDRX),
+    PPI_EVENT(UARTE0_EVENTS_TXDRDY,    NRF_UARTE_regs[0].EVENTS_TXDRDY),
+    PPI_EVENT(UARTE0_EVENTS_ENDTX,     NRF_UARTE_regs[0].EVENTS_ENDTX),
+    PPI_EVENT(UARTE0_EVENTS_ERROR,     NRF_UARTE_regs[0].EVENTS_ERROR),
+    PPI_EVENT(UARTE0_EVENTS_RXTO,      NRF_UARTE_regs[0].EVENTS_RXTO),
+    PPI_EVENT(UARTE0_EVENTS_RXSTARTED, NRF_UARTE_regs[0].EVENTS_RXSTARTED),
+    PPI_EVENT(UARTE0_EVENTS_TXSTARTED, NRF_UARTE_regs[0].EVENTS_TXSTARTED),
+    PPI_EVENT(UARTE0_EVENTS_TXSTOPPED, NRF_UARTE_regs[0].EVENTS_TXSTOPPED),
+
+    PPI_EVENT(GPIOTE_EVENTS_IN_0, NRF_GPIOTE_regs[0].EVENTS_IN[0]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_1, NRF_GPIOTE_regs[0].EVENTS_IN[1]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_2, NRF_GPIOTE_regs[0].EVENTS_IN[2]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_3, NRF_GPIOTE_regs[0].EVENTS_IN[3]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_4, NRF_GPIOTE_regs[0].EVENTS_IN[4]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_5, NRF_GPIOTE_regs[0].EVENTS_IN[5]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_6, NRF_GPIOTE_regs[0].EVENTS_IN[6]),
+    PPI_EVENT(GPIOTE_EVENTS_IN_7, NRF_GPIOTE_regs[0].EVENTS_IN[7]),
+    PPI_EVENT(GPIOTE_EVENTS_PORT, NRF_GPIOTE_regs[0].EVENTS_PORT),
+
+    PPI_EVENT(TIMER0_EVENTS_COMPARE_0, NRF_TIMER_regs[0].EVENTS_COMPARE[0]),
+    PPI_EVENT(TIMER0_EVENTS_COMPARE_1, NRF_TIMER_regs[0].EVENTS_COMPARE[1]),
+    PPI_EVENT(TIMER0_EVENTS_COMPARE_2, NRF_TIMER_regs[0].EVENTS_COMPARE[2]),
+    PPI_EVENT(TIMER0_EVENTS_COMPARE_3, NRF_TIMER_regs[0].EVENTS_COMPARE[3]),
+//    PPI_EVENT(TIMER0_EVENTS_COMPARE_4, NRF_TIMER_regs[0].EVENTS_COMPARE[4]),
+//    PPI_EVENT(TIMER0_EVENTS_COMPARE_5, NRF_TIMER_regs[0].EVENTS_COMPARE[5]),
+
+    PPI_EVENT(TIMER1_EVENTS_COMPARE_0, NRF_TIMER_regs[1].EVENTS_COMPARE[0]),
+    PPI_EVENT(TIMER1_EVENTS_COMPARE_1, NRF_TIMER_regs[1].EVENTS_COMPARE[1]),
+    PPI_EVENT(TIMER1_EVENTS_COMPARE_2, NRF_TIMER_regs[1].EVENTS_COMPARE[2]),
+    PPI_EVENT(TIMER1_EVENTS_COMPARE_3, NRF_TIMER_regs[1].EVENTS_COMPARE[3]),
+    //    PPI_EVENT(TIMER1_EVENTS_COMPARE_4, NRF_TIMER_regs[1].EVENTS_COMPARE[4]),
+    //    PPI_EVENT(TIMER1_EVENTS_COMPARE_5, NRF_TIMER_regs[1].EVENTS_COMPARE[5]),
+
+    PPI_EVENT(TIMER2_EVENTS_COMPARE_0, NRF_TIMER_regs[2].EVENTS_COMPARE[0]),
+    PPI_EVENT(TIMER2_EVENTS_COMPARE_1, NRF_TIMER_regs[2].EVENTS_COMPARE[1]),
+    PPI_EVENT(TIMER2_EVENTS_COMPARE_2, NRF_TIMER_regs[2].EVENTS_COMPARE[2]),
+    PPI_EVENT(TIMER2_EVENTS_COMPARE_3, NRF_TIMER_regs[2].EVENTS_COMPARE[3]),
+    //    PPI_EVENT(TIMER2_EVENTS_COMPARE_4, NRF_TIMER_regs[2].EVENTS_COMPARE[4]),
+    //    PPI_EVENT(TIMER2_EVENTS_COMPARE_5, NRF_TIMER_regs[2].EVENTS_COMPARE[5]),
+
+    PPI_EVENT(RTC0_EVENTS_OVRFLW, NRF_RTC_regs[0].EVENTS_OVRFLW),
+    PPI_EVENT(RTC0_EVENTS_COMPARE_0, NRF_RTC_regs[0].EVENTS_COMPARE[0]),
+    PPI_EVENT(RTC0_EVENTS_COMPARE_1, NRF_RTC_regs[0].EVENTS_COMPARE[1]),
+    PPI_EVENT(RTC0_EVENTS_COMPARE_2, NRF_RTC_regs[0].EVENTS_COMPARE[2]),
+    PPI_EVENT(RTC0_EVENTS_COMPARE_3, NRF_RTC_regs[0].EVENTS_COMPARE[3]),
+
+    PPI_EVENT(TEMP_EVENTS_DATARDY, NRF_TEMP_regs.EVENTS_DATARDY),
+
+    //PPI_EVENT(RNG_EVENTS_VALRDY, NRF_RNG_regs.EVENTS_VALRDY),
+
+    PPI_EVENT(CCM_EVENTS_ENDKSGEN, NRF_CCM_regs.EVENTS_ENDKSGEN),
+    PPI_EVENT(CCM_EVENTS_ENDCRYPT, NRF_CCM_regs.EVENTS_ENDCRYPT),
+    PPI_EVENT(CCM_EVENTS_ERROR,    NRF_CCM_regs.EVENTS_ERROR),
+
+    PPI_EVENT(RTC1_EVENTS_OVRFLW, NRF_RTC_regs[1].EVENTS_OVRFLW),
+    PPI_EVENT(RTC1_EVENTS_COMPARE_0, NRF_RTC_regs[1].EVENTS_COMPARE[0]),
+    PPI_EVENT(RTC1_EVENTS_COMPARE_1, NRF_RTC_regs[1].EVENTS_COMPARE[1]),
+    PPI_EVENT(RTC1_EVENTS_COMPARE_2, NRF_RTC_regs[1].EVENTS_COMPARE[2]),
+    PPI_EVENT(RTC1_EVENTS_COMPARE_3, NRF_RTC_regs[1].EVENTS_COMPARE[3]),
+
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_0, NRF_EGU_regs[0].EVENTS_TRIGGERED[0]), /*These are autogenerated (See NRF_EGU.c)*/
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_1, NRF_EGU_regs[0].EVENTS_TRIGGERED[1]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_2, NRF_EGU_regs[0].EVENTS_TRIGGERED[2]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_3, NRF_EGU_regs[0].EVENTS_TRIGGERED[3]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_4, NRF_EGU_regs[0].EVENTS_TRIGGERED[4]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_5, NRF_EGU_regs[0].EVENTS_TRIGGERED[5]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_6, NRF_EGU_regs[0].EVENTS_TRIGGERED[6]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_7, NRF_EGU_regs[0].EVENTS_TRIGGERED[7]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_8, NRF_EGU_regs[0].EVENTS_TRIGGERED[8]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_9, NRF_EGU_regs[0].EVENTS_TRIGGERED[9]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_10, NRF_EGU_regs[0].EVENTS_TRIGGERED[10]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_11, NRF_EGU_regs[0].EVENTS_TRIGGERED[11]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_12, NRF_EGU_regs[0].EVENTS_TRIGGERED[12]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_13, NRF_EGU_regs[0].EVENTS_TRIGGERED[13]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_14, NRF_EGU_regs[0].EVENTS_TRIGGERED[14]),
+    PPI_EVENT(EGU0_EVENTS_TRIGGERED_15, NRF_EGU_regs[0].EVENTS_TRIGGERED[15]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_0, NRF_EGU_regs[1].EVENTS_TRIGGERED[0]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_1, NRF_EGU_regs[1].EVENTS_TRIGGERED[1]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_2, NRF_EGU_regs[1].EVENTS_TRIGGERED[2]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_3, NRF_EGU_regs[1].EVENTS_TRIGGERED[3]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_4, NRF_EGU_regs[1].EVENTS_TRIGGERED[4]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_5, NRF_EGU_regs[1].EVENTS_TRIGGERED[5]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_6, NRF_EGU_regs[1].EVENTS_TRIGGERED[6]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_7, NRF_EGU_regs[1].EVENTS_TRIGGERED[7]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_8, NRF_EGU_regs[1].EVENTS_TRIGGERED[8]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_9, NRF_EGU_regs[1].EVENTS_TRIGGERED[9]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_10, NRF_EGU_regs[1].EVENTS_TRIGGERED[10]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_11, NRF_EGU_regs[1].EVENTS_TRIGGERED[11]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_12, NRF_EGU_regs[1].EVENTS_TRIGGERED[12]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_13, NRF_EGU_regs[1].EVENTS_TRIGGERED[13]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_14, NRF_EGU_regs[1].EVENTS_TRIGGERED[14]),
+    PPI_EVENT(EGU1_EVENTS_TRIGGERED_15, NRF_EGU_regs[1].EVENTS_TRIGGERED[15]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_0, NRF_EGU_regs[2].EVENTS_TRIGGERED[0]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_1, NRF_EGU_regs[2].EVENTS_TRIGGERED[1]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_2, NRF_EGU_regs[2].EVENTS_TRIGGERED[2]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_3, NRF_EGU_regs[2].EVENTS_TRIGGERED[3]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_4, NRF_EGU_regs[2].EVENTS_TRIGGERED[4]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_5, NRF_EGU_regs[2].EVENTS_TRIGGERED[5]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_6, NRF_EGU_regs[2].EVENTS_TRIGGERED[6]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_7, NRF_EGU_regs[2].EVENTS_TRIGGERED[7]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_8, NRF_EGU_regs[2].EVENTS_TRIGGERED[8]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_9, NRF_EGU_regs[2].EVENTS_TRIGGERED[9]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_10, NRF_EGU_regs[2].EVENTS_TRIGGERED[10]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_11, NRF_EGU_regs[2].EVENTS_TRIGGERED[11]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_12, NRF_EGU_regs[2].EVENTS_TRIGGERED[12]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_13, NRF_EGU_regs[2].EVENTS_TRIGGERED[13]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_14, NRF_EGU_regs[2].EVENTS_TRIGGERED[14]),
+    PPI_EVENT(EGU2_EVENTS_TRIGGERED_15, NRF_EGU_regs[2].EVENTS_TRIGGERED[15]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_0, NRF_EGU_regs[3].EVENTS_TRIGGERED[0]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_1, NRF_EGU_regs[3].EVENTS_TRIGGERED[1]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_2, NRF_EGU_regs[3].EVENTS_TRIGGERED[2]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_3, NRF_EGU_regs[3].EVENTS_TRIGGERED[3]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_4, NRF_EGU_regs[3].EVENTS_TRIGGERED[4]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_5, NRF_EGU_regs[3].EVENTS_TRIGGERED[5]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_6, NRF_EGU_regs[3].EVENTS_TRIGGERED[6]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_7, NRF_EGU_regs[3].EVENTS_TRIGGERED[7]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_8, NRF_EGU_regs[3].EVENTS_TRIGGERED[8]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_9, NRF_EGU_regs[3].EVENTS_TRIGGERED[9]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_10, NRF_EGU_regs[3].EVENTS_TRIGGERED[10]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_11, NRF_EGU_regs[3].EVENTS_TRIGGERED[11]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_12, NRF_EGU_regs[3].EVENTS_TRIGGERED[12]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_13, NRF_EGU_regs[3].EVENTS_TRIGGERED[13]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_14, NRF_EGU_regs[3].EVENTS_TRIGGERED[14]),
+    PPI_EVENT(EGU3_EVENTS_TRIGGERED_15, NRF_EGU_regs[3].EVENTS_TRIGGERED[15]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_0, NRF_EGU_regs[4].EVENTS_TRIGGERED[0]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_1, NRF_EGU_regs[4].EVENTS_TRIGGERED[1]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_2, NRF_EGU_regs[4].EVENTS_TRIGGERED[2]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_3, NRF_EGU_regs[4].EVENTS_TRIGGERED[3]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_4, NRF_EGU_regs[4].EVENTS_TRIGGERED[4]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_5, NRF_EGU_regs[4].EVENTS_TRIGGERED[5]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_6, NRF_EGU_regs[4].EVENTS_TRIGGERED[6]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_7, NRF_EGU_regs[4].EVENTS_TRIGGERED[7]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_8, NRF_EGU_regs[4].EVENTS_TRIGGERED[8]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_9, NRF_EGU_regs[4].EVENTS_TRIGGERED[9]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_10, NRF_EGU_regs[4].EVENTS_TRIGGERED[10]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_11, NRF_EGU_regs[4].EVENTS_TRIGGERED[11]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_12, NRF_EGU_regs[4].EVENTS_TRIGGERED[12]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_13, NRF_EGU_regs[4].EVENTS_TRIGGERED[13]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_14, NRF_EGU_regs[4].EVENTS_TRIGGERED[14]),
+    PPI_EVENT(EGU4_EVENTS_TRIGGERED_15, NRF_EGU_regs[4].EVENTS_TRIGGERED[15]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_0, NRF_EGU_regs[5].EVENTS_TRIGGERED[0]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_1, NRF_EGU_regs[5].EVENTS_TRIGGERED[1]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_2, NRF_EGU_regs[5].EVENTS_TRIGGERED[2]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_3, NRF_EGU_regs[5].EVENTS_TRIGGERED[3]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_4, NRF_EGU_regs[5].EVENTS_TRIGGERED[4]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_5, NRF_EGU_regs[5].EVENTS_TRIGGERED[5]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_6, NRF_EGU_regs[5].EVENTS_TRIGGERED[6]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_7, NRF_EGU_regs[5].EVENTS_TRIGGERED[7]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_8, NRF_EGU_regs[5].EVENTS_TRIGGERED[8]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_9, NRF_EGU_regs[5].EVENTS_TRIGGERED[9]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_10, NRF_EGU_regs[5].EVENTS_TRIGGERED[10]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_11, NRF_EGU_regs[5].EVENTS_TRIGGERED[11]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_12, NRF_EGU_regs[5].EVENTS_TRIGGERED[12]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_13, NRF_EGU_regs[5].EVENTS_TRIGGERED[13]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_14, NRF_EGU_regs[5].EVENTS_TRIGGERED[14]),
+    PPI_EVENT(EGU5_EVENTS_TRIGGERED_15, NRF_EGU_regs[5].EVENTS_TRIGGERED[15]),
+
+    PPI_EVENT(TIMER3_EVENTS_COMPARE_0, NRF_TIMER_regs[3].EVENTS_COMPARE[0]),
+    PPI_EVENT(TIMER3_EVENTS_COMPARE_1, NRF_TIMER_regs[3].EVENTS_COMPARE[1]),
+    PPI_EVENT(TIMER3_EVENTS_COMPARE_2, NRF_TIMER_regs[3].EVENTS_COMPARE[2]),
+    PPI_EVENT(TIMER3_EVENTS_COMPARE_3, NRF_TIMER_regs[3].EVENTS_COMPARE[3]),
+    PPI_EVENT(TIMER3_EVENTS_COMPARE_4, NRF_TIMER_regs[3].EVENTS_COMPARE[4]),
+    PPI_EVENT(TIMER3_EVENTS_COMPARE_5, NRF_TIMER_regs[3].EVENTS_COMPARE[5]),
+
+    PPI_EVENT(TIMER4_EVENTS_COMPARE_0, NRF_TIMER_regs[4].EVENTS_COMPARE[0]),
+    PPI_EVENT(TIMER4_EVENTS_COMPARE_1, NRF_TIMER_regs[4].EVENTS_COMPARE[1]),
+    PPI_EVENT(TIMER4_EVENTS_COMPARE_2, NRF_TIMER_regs[4].EVENTS_COMPARE[2]),
+    PPI_EVENT(TIMER4_EVENTS_COMPARE_3, NRF_TIMER_regs[4].EVENTS_COMPARE[3]),
+    PPI_EVENT(TIMER4_EVENTS_COMPARE_4, NRF_TIMER_regs[4].EVENTS_COMPARE[4]),
+    PPI_EVENT(TIMER4_EVENTS_COMPARE_5, NRF_TIMER_regs[4].EVENTS_COMPARE[5]),
+
+    PPI_EVENT(RTC2_EVENTS_OVRFLW, NRF_RTC_regs[2].EVENTS_OVRFLW),
+    PPI_EVENT(RTC2_EVENTS_COMPARE_0, NRF_RTC_regs[2].EVENTS_COMPARE[0]),
+    PPI_EVENT(RTC2_EVENTS_COMPARE_1, NRF_RTC_regs[2].EVENTS_COMPARE[1]),
+    PPI_EVENT(RTC2_EVENTS_COMPARE_2, NRF_RTC_regs[2].EVENTS_COMPARE[2]),
+    PPI_EVENT(RTC2_EVENTS_COMPARE_3, NRF_RTC_regs[2].EVENTS_COMPARE[3]),
+
+    PPI_EVENT(UARTE1_EVENTS_CTS,       NRF_UARTE_regs[1].EVENTS_CTS),
+    PPI_EVENT(UARTE1_EVENTS_NCTS,      NRF_UARTE_regs[1].EVENTS_NCTS),
+    PPI_EVENT(UARTE1_EVENTS_RXDRDY,    NRF_UARTE_regs[1].EVENTS_RXDRDY),
+    PPI_EVENT(UARTE1_EVENTS_ENDRX,     NRF_UARTE_regs[1].EVENTS_ENDRX),
+    PPI_EVENT(UARTE1_EVENTS_TXDRDY,    NRF_UARTE_regs[1].EVENTS_TXDRDY),
+    PPI_EVENT(UARTE1_EVENTS_ENDTX,     NRF_UARTE_regs[1].EVENTS_ENDTX),
+    PPI_EVENT(UARTE1_EVENTS_ERROR,     NRF_UARTE_regs[1].EVENTS_ERROR),
+    PPI_EVENT(UARTE1_EVENTS_RXTO,      NRF_UARTE_regs[1].EVENTS_RXTO),
+    PPI_EVENT(UARTE1_EVENTS_RXSTARTED, NRF_UARTE_regs[1].EVENTS_RXSTARTED),
+    PPI_EVENT(UARTE1_EVENTS_TXSTARTED, NRF_UARTE_regs[1].EVENTS_TXSTARTED),
+    PPI_EVENT(UARTE1_EVENTS_TXSTOPPED, NRF_UARTE_regs[1].EVENTS_TXSTOPPED),
+
+    {NUMBER_PPI_EVENTS, NULL, NULL} //End marker
 };
 
 
@@ -666,6 +685,21 @@ static volatile struct {
 } tasks_queue;
 #define TASK_QUEUE_ALLOC_SIZE 64
 
+static char *ppi_stats_csv_path;
+static char *ppi_stats_json_path;
+static bool ppi_stats; /* Activity statistics enabled */
+
+static struct {
+  uint64_t evt_signals[NUMBER_PPI_EVENTS]; /* Per event, times it reached an enabled channel */
+  uint64_t ch_signals[NUMBER_PPI_CHANNELS]; /* Per channel, events which went thru it */
+  struct {
+    dest_f_t task;
+    uint64_t calls;
+  } *tasks; /* Calls to each task */
+  uint tasks_used;
+  uint tasks_size;
+} *ppi_st;
+
 
 /**
  * Initialize the PPI model
@@ -677,6 +711,9 @@ static void nrf_ppi_init(void) {
   set_fixed_channel_routes();
   tasks_queue.q = (dest_f_t*)bs_calloc(TASK_QUEUE_ALLOC_SIZE, sizeof(dest_f_t));
   tasks_queue.size = TASK_QUEUE_ALLOC_SIZE;
+  if (ppi_stats) {
+    ppi_st = bs_calloc(1, sizeof(*ppi_st));
+  }
 }
 
 NSI_TASK(nrf_ppi_init, HW_INIT, 50);
@@ -689,10 +726,189 @@ static void nrf_ppi_clean_up(void) {
     free(tasks_queue.q);
     tasks_queue.q = NULL;
   }
+  if (ppi_st) {
+    free(ppi_st->tasks);
+    free(ppi_st);
+    ppi_st = NULL;
+  }
 }
 
 NSI_TASK(nrf_ppi_clean_up, ON_EXIT_PRE, 50);
 
+static void nrf_ppi_stats_count_task(dest_f_t task) {
+  uint i;
+
+  for (i = 0; i < ppi_st->tasks_used; i++) {
+    if (ppi_st->tasks[i].task == task) {
+      ppi_st->tasks[i].calls++;
+      return;
+    }
+  }
+  if (ppi_st->tasks_used >= ppi_st->tasks_size) {
+    ppi_st->tasks_size += 16;
+    ppi_st->tasks = bs_realloc(ppi_st->tasks, ppi_st->tasks_size * sizeof(ppi_st->tasks[0]));
+  }
+  ppi_st->tasks[i].task = task;
+  ppi_st->tasks[i].calls = 1;
+  ppi_st->tasks_used++;
+}
+
+/*
+ * Get the name (like "TIMER0_EVENTS_COMPARE_0") and real HW address of an event register,
+ * given its type. Or an empty name and 0 if unknown
+ */
+static const char *nrf_ppi_stats_event(ppi_event_types_t event, uintptr_t *addr) {
+  for (int i = 0; ppi_events_table[i].event_type != NUMBER_PPI_EVENTS; i++) {
+    if (ppi_events_table[i].event_type == event) {
+      *addr = (uintptr_t)nhw_try_convert_per_addr_sim_to_hw(ppi_events_table[i].event_addr);
+      return ppi_events_table[i].name;
+    }
+  }
+  *addr = 0;
+  return "";
+}
+
+/*
+ * Print into <name> the name of the (first) task register handled by a task function
+ * (like "TIMER0.TASKS_START") and get its real HW address. Or an empty name and 0 if unknown
+ */
+static uintptr_t nrf_ppi_stats_task(dest_f_t task, char *name, size_t size) {
+  for (int i = 0; ppi_tasks_table[i].task_addr != NULL; i++) {
+    if (ppi_tasks_table[i].dest == task) {
+      uint32_t offset;
+      const char *per_name = nhw_try_per_addr_sim_to_name(ppi_tasks_table[i].task_addr, &offset);
+
+      snprintf(name, size, "%s.%s", per_name != NULL ? per_name : "?", ppi_tasks_table[i].reg_name);
+      return (uintptr_t)nhw_try_convert_per_addr_sim_to_hw(ppi_tasks_table[i].task_addr);
+    }
+  }
+  name[0] = 0;
+  return 0;
+}
+
+static FILE *nrf_ppi_stats_open(const char *path) {
+  FILE *f = fopen(path, "w");
+
+  if (f == NULL) {
+    bs_trace_warning_line("Could not open %s to write the PPI activity statistics (%i, %s)\n",
+                          path, errno, strerror(errno));
+  }
+  return f;
+}
+
+static void nrf_ppi_stats_write_csv(void) {
+  FILE *f = nrf_ppi_stats_open(ppi_stats_csv_path);
+
+  if (f == NULL) {
+    return;
+  }
+  fprintf(f, "kind,index,name,address,count\n");
+  for (int i = 0; i < NUMBER_PPI_EVENTS; i++) {
+    if (ppi_st->evt_signals[i] != 0) {
+      uintptr_t addr;
+      const char *name = nrf_ppi_stats_event((ppi_event_types_t)i, &addr);
+
+      fprintf(f, "event,%i,%s,0x%08"PRIXPTR",%"PRIu64"\n", i, name, addr, ppi_st->evt_signals[i]);
+    }
+  }
+  for (int i = 0; i < NUMBER_PPI_CHANNELS; i++) {
+    if (ppi_st->ch_signals[i] != 0) {
+      fprintf(f, "channel,%i,,,%"PRIu64"\n", i, ppi_st->ch_signals[i]);
+    }
+  }
+  for (uint i = 0; i < ppi_st->tasks_used; i++) {
+    char name[64];
+    uintptr_t addr = nrf_ppi_stats_task(ppi_st->tasks[i].task, name, sizeof(name));
+
+    fprintf(f, "task,,%s,0x%08"PRIXPTR",%"PRIu64"\n", name, addr, ppi_st->tasks[i].calls);
+  }
+  fclose(f);
+}
+
+static void nrf_ppi_stats_write_json(void) {
+  FILE *f = nrf_ppi_stats_open(ppi_stats_json_path);
+  bool first = true;
+
+  if (f == NULL) {
+    return;
+  }
+  fprintf(f, "{\n  \"events\": [");
+  for (int i = 0; i < NUMBER_PPI_EVENTS; i++) {
+    if (ppi_st->evt_signals[i] != 0) {
+      uintptr_t addr;
+      const char *name = nrf_ppi_stats_event((ppi_event_types_t)i, &addr);
+
+      fprintf(f, "%s\n    {\"event\": %i, \"name\": \"%s\", \"address\": \"0x%08"PRIXPTR"\", "
+              "\"signals\": %"PRIu64"}",
+              first ? "" : ",", i, name, addr, ppi_st->evt_signals[i]);
+      first = false;
+    }
+  }
+  fprintf(f, "\n  ],\n  \"channels\": [");
+  first = true;
+  for (int i = 0; i < NUMBER_PPI_CHANNELS; i++) {
+    if (ppi_st->ch_signals[i] != 0) {
+      fprintf(f, "%s\n    {\"channel\": %i, \"signals\": %"PRIu64"}",
+              first ? "" : ",", i, ppi_st->ch_signals[i]);
+      first = false;
+    }
+  }
+  fprintf(f, "\n  ],\n  \"tasks\": [");
+  for (uint i = 0; i < ppi_st->tasks_used; i++) {
+    char name[64];
+    uintptr_t addr = nrf_ppi_stats_task(ppi_st->tasks[i].task, name, sizeof(name));
+
+    fprintf(f, "%s\n    {\"name\": \"%s\", \"address\": \"0x%08"PRIXPTR"\", \"calls\": %"PRIu64"}",
+            i ? "," : "", name, addr, ppi_st->tasks[i].calls);
+  }
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+}
+
+static void nrf_ppi_write_stats(void) {
+  if (ppi_st == NULL) {
+    return;
+  }
+  if (ppi_stats_csv_path) {
+    nrf_ppi_stats_write_csv();
+  }
+  if (ppi_stats_json_path) {
+    nrf_ppi_stats_write_json();
+  }
+}
+
+NSI_TASK(nrf_ppi_write_stats, ON_EXIT_PRE, 11);
+
+static void nrf_ppi_register_cmdline(void) {
+  static bs_args_struct_t args[] = {
+    { .option = "ppi_stats_csv",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&ppi_stats_csv_path,
+      .descript = "Count the events which go thru each PPI channel and the calls to each "
+                  "task, and write them at exit into this CSV file"
+    },
+    { .option = "ppi_stats_json",
+      .name = "path",
+      .type = 's',
+      .dest = (void *)&ppi_stats_json_path,
+      .descript = "Count the events which go thru each PPI channel and the calls to each "
+                  "task, and write them at exit into this JSON file"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args);
+}
+
+NSI_TASK(nrf_ppi_register_cmdline, PRE_BOOT_1, 100);
+
+static void nrf_ppi_post_cmdline(void) {
+  ppi_stats = (ppi_stats_csv_path != NULL) || (ppi_stats_json_path != NULL);
+}
+
+NSI_TASK(nrf_ppi_post_cmdline, PRE_BOOT_2, 100);
+
 static void nrf_ppi_enqueue_task(dest_f_t task) {
   uint i;
   for (i = 0; i < tasks_queue.used; i++){
@@ -714,6 +930,9 @@ static void nrf_ppi_dequeue_all_tasks(void) {
     if (tasks_queue.q[i]) {
       dest_f_t f = tasks_queue.q[i];
       tasks_queue.q[i] = NULL;
+      if (ppi_stats) {
+        nrf_ppi_stats_count_task(f);
+      }
       f();
     }
   }
@@ -730,11 +949,17 @@ void nrf_ppi_event(ppi_event_types_t event){
   ch_mask &= NRF_PPI_regs.CHEN;
 
   if ( ch_mask ){
+    if ( ppi_stats ){
+      ppi_st->evt_signals[event]++;
+    }
     for ( int ch_nbr = __builtin_ffs(ch_mask) - 1;
           ( ch_mask != 0 ) && ( ch_nbr < NUMBER_PPI_CHANNELS ) ;
           ch_nbr++ ) {
       if ( ch_mask & ( (uint32_t) 1 << ch_nbr ) ){
         ch_mask &= ~( (uint64_t) 1 << ch_nbr );
+        if ( ppi_stats ){
+          ppi_st->ch_signals[ch_nbr]++;
+        }
         if ( ppi_ch_tasks[ch_nbr].tep_f != NULL ){
           nrf_ppi_enqueue_task(ppi_ch_tasks[ch_nbr].tep_f);
         }
@@ -747,6 +972,30 @@ void nrf_ppi_event(ppi_event_types_t event){
   } //if this event is in any channel
 }
 
+/**
+ * Would this event currently trigger any task thru the PPI?
+ * (HW models may use this to avoid modelling in detail events nobody listens to)
+ */
+bool nrf_ppi_event_is_routed(ppi_event_types_t event){
+  return (ppi_evt_to_ch[event].channels_mask & NRF_PPI_regs.CHEN) != 0;
+}
+
+/**
+ * Convert the value the SW wrote in an EEP or TEP register into the address of
+ * the corresponding event or task register in the models
+ *
+ * In 64 bit builds the SW gets these addresses from the nrfx HAL *_address_get() functions,
+ * which truncate them to 32 bits, so they cannot be mapped back. So, the PPI is not supported
+ * in 64 bit builds.
+ */
+static void *nrf_ppi_endpoint_to_ptr(uint32_t endpoint){
+#if NHW_DMA_ADDR_TRANSLATION
+  bs_trace_error_time_line("NRF_PPI: Setting PPI endpoints (0x%08"PRIx32") is not supported in 64 bit "
+                           "builds\n", endpoint);
+#endif
+  return nhw_dma_addr_to_ptr(endpoint);
+}
+
 /**
  * Find the task in ppi_tasks_table whose address
  * matches <TEP> and save the task handling function <in dest>
@@ -783,10 +1032,11 @@ void nrf_ppi_regw_sideeffects_EEP(int ch_nbr){
   }
 
   //then lets try to find which event (if any) is feeding this channel
-  if ( ( ch_nbr < 20 ) && ( (void*)NRF_PPI_regs.CH[ch_nbr].EEP != NULL ) ){
+  if ( ( ch_nbr < 20 ) && ( NRF_PPI_regs.CH[ch_nbr].EEP != 0 ) ){
+    void *EEP = nrf_ppi_endpoint_to_ptr(NRF_PPI_regs.CH[ch_nbr].EEP);
     int i = 0;
     while ( ppi_events_table[i].event_type != NUMBER_PPI_EVENTS ){
-      if ( ppi_events_table[i].event_addr == (void*)NRF_PPI_regs.CH[ch_nbr].EEP ) {
+      if ( ppi_events_table[i].event_addr == EEP ) {
         ppi_evt_to_ch[ppi_events_table[i].event_type].channels_mask |= ( 1 << ch_nbr );
         return;
       }
@@ -794,7 +1044,7 @@ void nrf_ppi_regw_sideeffects_EEP(int ch_nbr){
     }
     bs_trace_warning_line_time(
         "NRF_PPI: The event NRF_PPI_regs.CH[%i].EEP(=%p) does not match any modelled event in NRF_PPI.c=> it will be ignored\n",
-        ch_nbr, NRF_PPI_regs.CH[ch_nbr].EEP);
+        ch_nbr, EEP);
   }
 }
 
@@ -806,8 +1056,8 @@ void nrf_ppi_regw_sideeffects_TEP(int ch_nbr){
   //To save execution time when an event is raised, we build the
   //ppi_event_config_table & ppi_channel_config_table out of the registers
   if ( ch_nbr < 20 ){
-    if ( (void*)NRF_PPI_regs.CH[ch_nbr].TEP != NULL ){
-      find_task((void*)NRF_PPI_regs.CH[ch_nbr].TEP,
+    if ( NRF_PPI_regs.CH[ch_nbr].TEP != 0 ){
+      find_task(nrf_ppi_endpoint_to_ptr(NRF_PPI_regs.CH[ch_nbr].TEP),
                 &ppi_ch_tasks[ch_nbr].tep_f,
                 ch_nbr);
     } else {
@@ -820,8 +1070,8 @@ void nrf_ppi_regw_sideeffects_TEP(int ch_nbr){
  * FORK[<ch_nbr>].TEP update
  */
 void nrf_ppi_regw_sideeffects_FORK_TEP(int ch_nbr){
-  if ( (void*)NRF_PPI_regs.FORK[ch_nbr].TEP != NULL ){
-    find_task((void*)NRF_PPI_regs.FORK[ch_nbr].TEP,
+  if ( NRF_PPI_regs.FORK[ch_nbr].TEP != 0 ){
+    find_task(nrf_ppi_endpoint_to_ptr(NRF_PPI_regs.FORK[ch_nbr].TEP),
               &ppi_ch_tasks[ch_nbr].fork_tep_f,
               ch_nbr);
   } else {
@@ -6,6 +6,8 @@
 #ifndef _NRF_HW_MODEL_PPI_H
 #define _NRF_HW_MODEL_PPI_H
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C"{
 #endif
@@ -346,6 +348,7 @@ typedef enum { //Note that, for performance, it is better to leave commented the
 #define NUMBER_PPI_CHANNELS 32
 
 void nrf_ppi_event(ppi_event_types_t event);
+bool nrf_ppi_event_is_routed(ppi_event_types_t event);
 void nrf_ppi_regw_sideeffects_TEP(int ch_nbr);
 void nrf_ppi_regw_sideeffects_EEP(int ch_nbr);
 void nrf_ppi_regw_sideeffects_FORK_TEP(int ch_nbr);
@@ -19,6 +19,7 @@
 #include "nsi_hws_models_if.h"
 #include "NHW_common_types.h"
 #include "NHW_config.h"
+#include "NHW_hws_profiler.h"
 
 struct bs_ticker_status {
   bs_time_t ticker_timer;    /* Next time to awake either by the timer or a awake_cpu_asap() call */
@@ -48,6 +49,8 @@ NSI_TASK(nhw_bst_ticker_init, HW_INIT, 10);
 
 static void nhw_bst_ticker_update_main_timer(void)
 {
+  bs_time_t old_timer = bst_ticker_timer;
+
   bst_ticker_timer = bs_ticket_st[0].ticker_timer;
 
   for (int i = 1; i < NHW_FAKE_TIMER_TOTAL_INST ; i++) {
@@ -56,7 +59,7 @@ static void nhw_bst_ticker_update_main_timer(void)
     }
   }
 
-  nsi_hws_find_next_event();
+  nhw_hws_timer_updated(old_timer, bst_ticker_timer);
 }
 
 static void nhw_bst_ticker_find_next_time_inner(struct bs_ticker_status *this)
@@ -134,7 +137,7 @@ static void nhw_bst_ticker_triggered(void)
   nhw_bst_ticker_update_main_timer();
 }
 
-NSI_HW_EVENT(bst_ticker_timer, nhw_bst_ticker_triggered, 1 /* Purposely the second */);
+NHW_HW_EVENT(bst_ticker_timer, nhw_bst_ticker_triggered, 1 /* Purposely the second */);
 
 /**
  * Awake the MCU as soon as possible (in this same microsecond, in a following delta)
@@ -20,6 +20,7 @@
 #include "nsi_hws_models_if.h"
 #include "NHW_common_types.h"
 #include "NHW_config.h"
+#include "NHW_hws_profiler.h"
 
 struct ftimer_status_t {
   bs_time_t event_time;
@@ -86,4 +87,4 @@ static void nhw_fake_timer_triggered(void)
   nhw_fake_timer_update_main_timer();
 }
 
-NSI_HW_EVENT(Timer_fake_timer, nhw_fake_timer_triggered, 0 /* Purposely the first */);
+NHW_HW_EVENT(Timer_fake_timer, nhw_fake_timer_triggered, 0 /* Purposely the first */);
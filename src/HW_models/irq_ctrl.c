@@ -44,6 +44,7 @@
 #include "nsi_hw_scheduler.h"
 #include "nsi_tasks.h"
 #include "nsi_hws_models_if.h"
+#include "NHW_hws_profiler.h"
 
 #define IRQ_64s ((NHW_INTCTRL_MAX_INTLINES+63)/64)
 
@@ -427,7 +428,7 @@ static void irq_raising_from_hw_now(unsigned int inst)
    */
   if ((this->irqs_locked == false) || (this->lock_ignore) || (this->wake_even_if_lock)) {
     this->lock_ignore = false;
-    nsif_cpun_irq_raised(inst);
+    nhw_hws_cpu_run(nsif_cpun_irq_raised, inst);
   }
 }
 
@@ -477,7 +478,7 @@ static void hw_irq_ctrl_timer_triggered(void)
   nsi_hws_find_next_event();
 }
 
-NSI_HW_EVENT(Timer_irq_ctrl, hw_irq_ctrl_timer_triggered, 10 /* Purposely a low value */);
+NHW_HW_EVENT(Timer_irq_ctrl, hw_irq_ctrl_timer_triggered, 10 /* Purposely a low value */);
 
 /*
  * Get the name of an interrupt given the interrupt controller instance
@@ -9,11 +9,15 @@
 #include "bs_types.h"
 #include "nsi_tasks.h"
 #include "weak_stubs.h"
+#include "trivial_xo.h"
 
 static double xo_drift = 0.0; //Crystal oscillator drift relative to the phy
 static double time_off = 0.0; //Time offset relative to the phy
 
-long double __attribute__((weak)) dev_time_from_phy(long double p_t){
+/* Incremented each time the drift or offset change (see trivial_xo_get_params()) */
+uint trivial_xo_params_gen = 1;
+
+static long double trivial_xo_dev_time_from_phy(long double p_t){
   long double dev_time;
   dev_time = ((1.0 + xo_drift)*(long double)p_t) - time_off;
   //Note: in x86 compiling with GCC for Linux long double is 80bit (64bits
@@ -21,7 +25,7 @@ long double __attribute__((weak)) dev_time_from_phy(long double p_t){
   return dev_time;
 }
 
-long double __attribute__((weak)) phy_time_from_dev(long double d_t){
+static long double trivial_xo_phy_time_from_dev(long double d_t){
   long double phy_time;
   phy_time =  ((long double)(d_t + time_off))/(1.0 + xo_drift);
   //Note: in x86 compiling with GCC for Linux long double is 80bit (64bits
@@ -29,8 +33,32 @@ long double __attribute__((weak)) phy_time_from_dev(long double d_t){
   return phy_time;
 }
 
+/* Other XO models may replace these two */
+long double dev_time_from_phy(long double p_t)
+  __attribute__((weak, alias("trivial_xo_dev_time_from_phy")));
+long double phy_time_from_dev(long double d_t)
+  __attribute__((weak, alias("trivial_xo_phy_time_from_dev")));
+
 void xo_model_set_toffset(double t_off) {
   time_off = ((double)t_off)/1e6;
+  trivial_xo_params_gen++;
+}
+
+void trivial_xo_set_clock_drift(double cdrift) {
+  xo_drift = cdrift;
+  trivial_xo_params_gen++;
+}
+
+/*
+ * Get the current drift and offset (in seconds) of this linear XO model.
+ * Returns false if the time conversion functions have been replaced by another XO model,
+ * in which case these parameters do not describe the conversion.
+ */
+bool trivial_xo_get_params(double *drift, double *t_off) {
+  *drift = xo_drift;
+  *t_off = time_off;
+  return (dev_time_from_phy == trivial_xo_dev_time_from_phy)
+         && (phy_time_from_dev == trivial_xo_phy_time_from_dev);
 }
 
 static double tmp_xo_drift;
@@ -38,7 +66,7 @@ static double tmp_xo_drift;
 static void arg_xo_drift_found(char * argv, int offset) {
   (void) argv;
   (void) offset;
-  xo_drift = tmp_xo_drift;
+  trivial_xo_set_clock_drift(tmp_xo_drift);
 }
 
 static void trivial_xo_register_cmd_args(void) {
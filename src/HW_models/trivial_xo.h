@@ -6,6 +6,7 @@
 #ifndef TRIVIAL_XO_H
 #define TRIVIAL_XO_H
 
+#include <stdbool.h>
 #include "xo_if.h"
 #include "bs_types.h"
 
@@ -15,6 +16,9 @@ extern "C" {
 
 void trivial_xo_set_clock_drift(double cdrift);
 void xo_model_set_toffset(double args_tOffset);
+bool trivial_xo_get_params(double *drift, double *t_off);
+
+extern uint trivial_xo_params_gen;
 
 #ifdef __cplusplus
 }
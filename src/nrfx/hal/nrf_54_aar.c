@@ -9,17 +9,20 @@
 #include "hal/nrf_ccm.h"
 #include "bs_tracing.h"
 #include "NHW_54_AAR_CCM_ECB.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 static int aar_inst_from_ptr(NRF_AAR_Type * p_reg)
 {
   union NRF_AARCCM_regs *p = (union NRF_AARCCM_regs *)p_reg;
 
-  int i = ( (int)p - (int)NRF_AARCCM_regs ) / sizeof(union NRF_AARCCM_Type);
+  int i = ( (intptr_t)p - (intptr_t)NRF_AARCCM_regs ) / sizeof(union NRF_AARCCM_Type);
   return i;
 }
 
 void nrf_aar_int_enable(NRF_AAR_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int inst = aar_inst_from_ptr(p_reg);
   p_reg->INTENSET = mask;
   nhw_AAR_regw_sideeffects_INTENSET(inst);
@@ -27,6 +30,7 @@ void nrf_aar_int_enable(NRF_AAR_Type * p_reg, uint32_t mask)
 
 void nrf_aar_int_disable(NRF_AAR_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int inst = aar_inst_from_ptr(p_reg);
   p_reg->INTENCLR = mask;
   nhw_AAR_regw_sideeffects_INTENCLR(inst);
@@ -34,6 +38,7 @@ void nrf_aar_int_disable(NRF_AAR_Type * p_reg, uint32_t mask)
 
 void nrf_aar_task_trigger(NRF_AAR_Type * p_reg, nrf_aar_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   int inst = aar_inst_from_ptr(p_reg);
   *(volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task) = 1;
   if (task == NRF_AAR_TASK_START) {
@@ -49,6 +54,7 @@ void nrf_aar_task_trigger(NRF_AAR_Type * p_reg, nrf_aar_task_t task)
 
 void nrf_aar_enable(NRF_AAR_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int inst = aar_inst_from_ptr(p_reg);
   p_reg->ENABLE = AAR_ENABLE_ENABLE_Enabled << AAR_ENABLE_ENABLE_Pos;
   nhw_AARCCM_regw_sideeffects_ENABLE(inst);
@@ -56,6 +62,7 @@ void nrf_aar_enable(NRF_AAR_Type * p_reg)
 
 void nrf_aar_disable(NRF_AAR_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int inst = aar_inst_from_ptr(p_reg);
   p_reg->ENABLE = AAR_ENABLE_ENABLE_Disabled << AAR_ENABLE_ENABLE_Pos;
   nhw_AARCCM_regw_sideeffects_ENABLE(inst);
@@ -63,6 +70,7 @@ void nrf_aar_disable(NRF_AAR_Type * p_reg)
 
 void nrf_aar_event_clear(NRF_AAR_Type * p_reg, nrf_aar_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   int inst = aar_inst_from_ptr(p_reg);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_AAR_regw_sideeffects_EVENTS_all(inst);
@@ -90,6 +98,7 @@ void nrf_aar_subscribe_set(NRF_AAR_Type * p_reg,
                            nrf_aar_task_t task,
                            uint8_t        channel)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
           ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
   nrf_aar_subscribe_common(p_reg, task);
@@ -98,6 +107,19 @@ void nrf_aar_subscribe_set(NRF_AAR_Type * p_reg,
 void nrf_aar_subscribe_clear(NRF_AAR_Type * p_reg,
                              nrf_aar_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
   nrf_aar_subscribe_common(p_reg, task);
 }
+
+void nrf_aar_in_ptr_set(NRF_AAR_Type * p_reg, nrf_vdma_job_t const * p_job)
+{
+  NHW_REG_PROF(p_reg);
+  p_reg->IN.PTR = nhw_dma_ptr_to_addr(p_job);
+}
+
+void nrf_aar_out_ptr_set(NRF_AAR_Type * p_reg, nrf_vdma_job_t const * p_job)
+{
+  NHW_REG_PROF(p_reg);
+  p_reg->OUT.PTR = nhw_dma_ptr_to_addr(p_job);
+}
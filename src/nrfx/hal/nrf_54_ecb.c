@@ -8,15 +8,18 @@
 #include "hal/nrf_ecb.h"
 #include "bs_tracing.h"
 #include "NHW_54_AAR_CCM_ECB.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 static int ecb_inst_from_ptr(NRF_ECB_Type * p_reg)
 {
-  int i = ( (int)p_reg - (int)NRF_ECB_regs ) / sizeof(NRF_ECB_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)NRF_ECB_regs ) / sizeof(NRF_ECB_Type);
   return i;
 }
 
 void nrf_ecb_task_trigger(NRF_ECB_Type * p_reg, nrf_ecb_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   int inst = ecb_inst_from_ptr(p_reg);
 
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
@@ -32,6 +35,7 @@ void nrf_ecb_task_trigger(NRF_ECB_Type * p_reg, nrf_ecb_task_t task)
 
 void nrf_ecb_int_enable(NRF_ECB_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int inst = ecb_inst_from_ptr(p_reg);
   p_reg->INTENSET = mask;
   nhw_ECB_regw_sideeffects_INTENSET(inst);
@@ -39,6 +43,7 @@ void nrf_ecb_int_enable(NRF_ECB_Type * p_reg, uint32_t mask)
 
 void nrf_ecb_int_disable(NRF_ECB_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int inst = ecb_inst_from_ptr(p_reg);
   p_reg->INTENCLR = mask;
   nhw_ECB_regw_sideeffects_INTENCLR(inst);
@@ -46,6 +51,7 @@ void nrf_ecb_int_disable(NRF_ECB_Type * p_reg, uint32_t mask)
 
 void nrf_ecb_event_clear(NRF_ECB_Type * p_reg, nrf_ecb_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   int inst = ecb_inst_from_ptr(p_reg);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_ECB_regw_sideeffects_EVENTS_all(inst);
@@ -70,6 +76,7 @@ void nrf_ecb_subscribe_set(NRF_ECB_Type * p_reg,
                            nrf_ecb_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_ecb_subscribe_common(p_reg, task);
@@ -78,6 +85,19 @@ void nrf_ecb_subscribe_set(NRF_ECB_Type * p_reg,
 void nrf_ecb_subscribe_clear(NRF_ECB_Type * p_reg,
                              nrf_ecb_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_ecb_subscribe_common(p_reg, task);
 }
+
+void nrf_ecb_in_ptr_set(NRF_ECB_Type * p_reg, nrf_vdma_job_t const * p_job)
+{
+  NHW_REG_PROF(p_reg);
+  p_reg->IN.PTR = nhw_dma_ptr_to_addr(p_job);
+}
+
+void nrf_ecb_out_ptr_set(NRF_ECB_Type * p_reg, nrf_vdma_job_t const * p_job)
+{
+  NHW_REG_PROF(p_reg);
+  p_reg->OUT.PTR = nhw_dma_ptr_to_addr(p_job);
+}
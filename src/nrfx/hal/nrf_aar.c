@@ -9,21 +9,26 @@
 #include "hal/nrf_aar.h"
 #include "bs_tracing.h"
 #include "NHW_AAR.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_aar_int_enable(NRF_AAR_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
   nhw_AAR_regw_sideeffects_INTENSET();
 }
 
 void nrf_aar_int_disable(NRF_AAR_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
   nhw_AAR_regw_sideeffects_INTENCLR();
 }
 
 void nrf_aar_task_trigger(NRF_AAR_Type * p_reg, nrf_aar_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *(volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task) = 1;
   if (task == NRF_AAR_TASK_START) {
     nhw_AAR_regw_sideeffects_TASKS_START();
@@ -36,6 +41,7 @@ void nrf_aar_task_trigger(NRF_AAR_Type * p_reg, nrf_aar_task_t task)
 
 void nrf_aar_event_clear(NRF_AAR_Type * p_reg, nrf_aar_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_AAR_regw_sideeffects_EVENTS_all(0);
 }
@@ -60,6 +66,7 @@ void nrf_aar_subscribe_set(NRF_AAR_Type * p_reg,
                            nrf_aar_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_aar_subscribe_common(p_reg, task);
@@ -68,8 +75,28 @@ void nrf_aar_subscribe_set(NRF_AAR_Type * p_reg,
 void nrf_aar_subscribe_clear(NRF_AAR_Type * p_reg,
                              nrf_aar_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_aar_subscribe_common(p_reg, task);
 }
 
 #endif /* defined(DPPI_PRESENT) */
+
+#if NHW_DMA_ADDR_TRANSLATION
+/* 64 bit hosts pointers do not fit in the *PTR registers, see NHW_dma_addr.h */
+
+void nrf_aar_irk_pointer_set(NRF_AAR_Type * p_reg, uint8_t const * irk_ptr)
+{
+  p_reg->IRKPTR = nhw_dma_ptr_to_addr(irk_ptr);
+}
+
+void nrf_aar_addr_pointer_set(NRF_AAR_Type * p_reg, uint8_t const * addr_ptr)
+{
+  p_reg->ADDRPTR = nhw_dma_ptr_to_addr(addr_ptr);
+}
+
+void nrf_aar_scratch_pointer_set(NRF_AAR_Type * p_reg, uint8_t * scratch_ptr)
+{
+  p_reg->SCRATCHPTR = nhw_dma_ptr_to_addr(scratch_ptr);
+}
+#endif /* NHW_DMA_ADDR_TRANSLATION */
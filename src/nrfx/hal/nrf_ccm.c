@@ -9,9 +9,12 @@
 #include "hal/nrf_ccm.h"
 #include "bs_tracing.h"
 #include "NHW_AES_CCM.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_ccm_task_trigger(NRF_CCM_Type * p_reg, nrf_ccm_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
 
   if ( task == NRF_CCM_TASK_KSGEN ) {
@@ -27,18 +30,21 @@ void nrf_ccm_task_trigger(NRF_CCM_Type * p_reg, nrf_ccm_task_t task)
 
 void nrf_ccm_int_enable(NRF_CCM_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
   nhw_CCM_regw_sideeffects_INTENSET();
 }
 
 void nrf_ccm_int_disable(NRF_CCM_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
   nhw_CCM_regw_sideeffects_INTENCLR();
 }
 
 void nrf_ccm_event_clear(NRF_CCM_Type * p_reg, nrf_ccm_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_CCM_regw_sideeffects_EVENTS_all(0);
 }
@@ -67,6 +73,7 @@ void nrf_ccm_subscribe_set(NRF_CCM_Type * p_reg,
                            nrf_ccm_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_ccm_subscribe_common(p_reg, task);
@@ -75,8 +82,33 @@ void nrf_ccm_subscribe_set(NRF_CCM_Type * p_reg,
 void nrf_ccm_subscribe_clear(NRF_CCM_Type * p_reg,
                              nrf_ccm_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_ccm_subscribe_common(p_reg, task);
 }
 
 #endif /* defined(DPPI_PRESENT) */
+
+#if NHW_DMA_ADDR_TRANSLATION
+/* 64 bit hosts pointers do not fit in the *PTR registers, see NHW_dma_addr.h */
+
+void nrf_ccm_cnf_ptr_set(NRF_CCM_Type * p_reg, nrf_ccm_cnf_t const * p_data)
+{
+  p_reg->CNFPTR = nhw_dma_ptr_to_addr(p_data);
+}
+
+void nrf_ccm_in_ptr_set(NRF_CCM_Type * p_reg, uint32_t const * p_data)
+{
+  p_reg->INPTR = nhw_dma_ptr_to_addr(p_data);
+}
+
+void nrf_ccm_out_ptr_set(NRF_CCM_Type * p_reg, uint32_t * p_data)
+{
+  p_reg->OUTPTR = nhw_dma_ptr_to_addr(p_data);
+}
+
+void nrf_ccm_scratch_ptr_set(NRF_CCM_Type * p_reg, uint32_t const * p_area)
+{
+  p_reg->SCRATCHPTR = nhw_dma_ptr_to_addr(p_area);
+}
+#endif /* NHW_DMA_ADDR_TRANSLATION */
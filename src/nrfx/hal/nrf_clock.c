@@ -12,18 +12,20 @@
 #include "NHW_54L_CLOCK.h"
 #else
 #include "NHW_CLOCK.h"
+#include "NHW_reg_profiler.h"
 #endif
 
 static int clock_number_from_ptr(NRF_CLOCK_Type * p_reg)
 {
   union NRF_CLKPWR_Type *p = (union NRF_CLKPWR_Type *)p_reg;
 
-  int i = ( (int)p - (int)&NRF_CLKPWR_regs[0] ) / sizeof(union NRF_CLKPWR_Type);
+  int i = ( (intptr_t)p - (intptr_t)&NRF_CLKPWR_regs[0] ) / sizeof(union NRF_CLKPWR_Type);
   return i;
 }
 
 void nrf_clock_int_enable(NRF_CLOCK_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
 
   int i = clock_number_from_ptr(p_reg);
@@ -32,6 +34,7 @@ void nrf_clock_int_enable(NRF_CLOCK_Type * p_reg, uint32_t mask)
 
 void nrf_clock_int_disable(NRF_CLOCK_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
 
   int i = clock_number_from_ptr(p_reg);
@@ -40,6 +43,7 @@ void nrf_clock_int_disable(NRF_CLOCK_Type * p_reg, uint32_t mask)
 
 void nrf_clock_task_trigger(NRF_CLOCK_Type * p_reg, nrf_clock_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
 
   int i = clock_number_from_ptr(p_reg);
@@ -95,6 +99,7 @@ void nrf_clock_task_trigger(NRF_CLOCK_Type * p_reg, nrf_clock_task_t task)
 
 void nrf_clock_event_clear(NRF_CLOCK_Type * p_reg, nrf_clock_event_t event)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + event);
     *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
 
     int i = clock_number_from_ptr(p_reg);
@@ -158,6 +163,7 @@ void nrf_clock_subscribe_set(NRF_CLOCK_Type * p_reg,
                              nrf_clock_task_t task,
                              uint8_t          channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_clock_subscribe_common(p_reg, task);
@@ -166,6 +172,7 @@ void nrf_clock_subscribe_set(NRF_CLOCK_Type * p_reg,
 void nrf_clock_subscribe_clear(NRF_CLOCK_Type * p_reg,
                                nrf_clock_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_clock_subscribe_common(p_reg, task);
 }
@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include <nrfx.h>
 #include "NHW_misc.h"
+#include "NHW_reg_profiler.h"
 
 #if defined(ADDRESS_BUS_Msk)
 uint8_t nrf_address_bus_get(uint32_t addr, size_t size)
@@ -27,6 +28,16 @@ uint8_t nrf_address_slave_get(uint32_t addr)
 }
 #endif
 
+/*
+ * The nRFx HAL <peripheral>_event_check() functions read the event registers thru this one.
+ * It is replaced only so SW polling events is accounted by the register accesses profiler.
+ */
+bool nrf_event_check(void const * p_reg, uint32_t event)
+{
+  NHW_REG_PROF((uint8_t const *)p_reg + event);
+  return (bool)*(volatile const uint32_t *)((uint8_t const *)p_reg + event);
+}
+
 bool nrf_dma_accessible_check(void const * p_reg, void const * p_object)
 {
   (void)p_reg;
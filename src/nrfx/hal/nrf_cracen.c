@@ -10,15 +10,18 @@
 #include "hal/nrf_cracen.h"
 #include "bs_tracing.h"
 #include "NHW_CRACEN_wrap.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_cracen_int_enable(NRF_CRACEN_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
   nhw_CRACEN_regw_sideeffects_INTENSET(0);
 }
 
 void nrf_cracen_int_disable(NRF_CRACEN_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
   nhw_CRACEN_regw_sideeffects_INTENCLR(0);
 }
@@ -26,6 +29,7 @@ void nrf_cracen_int_disable(NRF_CRACEN_Type * p_reg, uint32_t mask)
 void nrf_cracen_event_clear(NRF_CRACEN_Type *  p_reg,
                             nrf_cracen_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0;
 
 #if NRF_CRACEN_HAS_CRYPTOMASTER
@@ -12,16 +12,19 @@
 #include "hal/nrf_cracen_cm.h"
 #include "bs_tracing.h"
 #include "NHW_CRACEN_CM.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_cracen_cm_config_indirect_set(NRF_CRACENCORE_Type *           p_reg,
                                        nrf_cracen_cm_config_indirect_mask_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CRYPTMSTRDMA.CONFIG = (uint32_t)mask;
     nhw_CRACEN_CM_regw_sideeffects_CONFIG();
 }
 
 void nrf_cracen_cm_softreset(NRF_CRACENCORE_Type * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CRYPTMSTRDMA.CONFIG = CRACENCORE_CRYPTMSTRDMA_CONFIG_SOFTRST_Msk;
     nhw_CRACEN_CM_regw_sideeffects_CONFIG();
     p_reg->CRYPTMSTRDMA.CONFIG = 0;
@@ -30,6 +33,7 @@ void nrf_cracen_cm_softreset(NRF_CRACENCORE_Type * p_reg)
 
 void nrf_cracen_cm_start(NRF_CRACENCORE_Type * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CRYPTMSTRDMA.START = CRACENCORE_CRYPTMSTRDMA_START_STARTFETCH_Msk
                                | CRACENCORE_CRYPTMSTRDMA_START_STARTPUSH_Msk;
     nhw_CRACEN_CM_regw_sideeffects_START();
@@ -37,18 +41,21 @@ void nrf_cracen_cm_start(NRF_CRACENCORE_Type * p_reg)
 
 void nrf_cracen_cm_int_enable(NRF_CRACENCORE_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CRYPTMSTRDMA.INTENSET = mask;
     nhw_CRACEN_CM_regw_sideeffects_INTENSET(0);
 }
 
 void nrf_cracen_cm_int_disable(NRF_CRACENCORE_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CRYPTMSTRDMA.INTENCLR = mask;
     nhw_CRACEN_CM_regw_sideeffects_INTENCLR(0);
 }
 
 void nrf_cracen_cm_int_clear(NRF_CRACENCORE_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CRYPTMSTRDMA.INTSTATCLR = mask;
     nhw_CRACEN_CM_regw_sideeffects_INTSTARTCLR(0);
 }
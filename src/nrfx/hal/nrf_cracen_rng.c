@@ -12,10 +12,12 @@
 #include "hal/nrf_cracen_rng.h"
 #include "bs_tracing.h"
 #include "NHW_CRACEN_RNG.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_cracen_rng_control_set(NRF_CRACENCORE_Type *            p_reg,
                                 nrf_cracen_rng_control_t const * p_config)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->RNGCONTROL.CONTROL =
           ((p_config->enable << CRACENCORE_RNGCONTROL_CONTROL_ENABLE_Pos)
            & CRACENCORE_RNGCONTROL_CONTROL_ENABLE_Msk)
@@ -34,6 +36,7 @@ void nrf_cracen_rng_control_set(NRF_CRACENCORE_Type *            p_reg,
 
 uint32_t nrf_cracen_rng_fifo_get(NRF_CRACENCORE_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     nhw_CRACEN_RNG_regr_sideeffects_FIFO();
     return p_reg->RNGCONTROL.FIFO[0];
 }
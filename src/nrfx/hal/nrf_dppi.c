@@ -11,6 +11,7 @@
 #include "hal/nrf_dppi.h"
 #include "bs_tracing.h"
 #include "NHW_DPPI.h"
+#include "NHW_reg_profiler.h"
 
 static int get_dppi_inst_from_ptr(NRF_DPPIC_Type * p_reg)
 {
@@ -21,6 +22,7 @@ static int get_dppi_inst_from_ptr(NRF_DPPIC_Type * p_reg)
 
 void nrf_dppi_task_trigger(NRF_DPPIC_Type * p_reg, nrf_dppi_task_t dppi_task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + dppi_task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) dppi_task)) = 1;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
@@ -36,6 +38,7 @@ void nrf_dppi_task_trigger(NRF_DPPIC_Type * p_reg, nrf_dppi_task_t dppi_task)
 
 void nrf_dppi_channels_disable_all(NRF_DPPIC_Type * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CHENCLR = 0xFFFFFFFFuL;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
@@ -44,6 +47,7 @@ void nrf_dppi_channels_disable_all(NRF_DPPIC_Type * p_reg)
 
 void nrf_dppi_channels_enable(NRF_DPPIC_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CHENSET = mask;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
@@ -52,6 +56,7 @@ void nrf_dppi_channels_enable(NRF_DPPIC_Type * p_reg, uint32_t mask)
 
 void nrf_dppi_channels_disable(NRF_DPPIC_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CHENCLR = mask;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
@@ -76,6 +81,7 @@ void nrf_dppi_subscribe_set(NRF_DPPIC_Type * p_reg,
                             nrf_dppi_task_t  task,
                             uint8_t          channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     NRFX_ASSERT(channel < nrf_dppi_channel_number_get(p_reg));
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
@@ -85,6 +91,7 @@ void nrf_dppi_subscribe_set(NRF_DPPIC_Type * p_reg,
 
 void nrf_dppi_subscribe_clear(NRF_DPPIC_Type * p_reg, nrf_dppi_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
 
     nrf_dppi_subscribe_common(p_reg, task);
@@ -94,6 +101,7 @@ void nrf_dppi_channels_include_in_group(NRF_DPPIC_Type *         p_reg,
                                         uint32_t                 channel_mask,
                                         nrf_dppi_channel_group_t channel_group)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CHG[(uint32_t) channel_group] =
         p_reg->CHG[(uint32_t) channel_group] | (channel_mask);
 
@@ -105,6 +113,7 @@ void nrf_dppi_channels_remove_from_group(NRF_DPPIC_Type *         p_reg,
                                          uint32_t                 channel_mask,
                                          nrf_dppi_channel_group_t channel_group)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CHG[(uint32_t) channel_group] =
         p_reg->CHG[(uint32_t) channel_group] & ~(channel_mask);
 
@@ -115,6 +124,7 @@ void nrf_dppi_channels_remove_from_group(NRF_DPPIC_Type *         p_reg,
 void nrf_dppi_group_clear(NRF_DPPIC_Type *         p_reg,
                           nrf_dppi_channel_group_t group)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->CHG[(uint32_t) group] = 0;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
@@ -123,6 +133,7 @@ void nrf_dppi_group_clear(NRF_DPPIC_Type *         p_reg,
 
 void nrf_dppi_group_enable(NRF_DPPIC_Type * p_reg, nrf_dppi_channel_group_t group)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->TASKS_CHG[(uint32_t) group].EN = 1;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
@@ -132,6 +143,7 @@ void nrf_dppi_group_enable(NRF_DPPIC_Type * p_reg, nrf_dppi_channel_group_t grou
 void nrf_dppi_group_disable(NRF_DPPIC_Type *         p_reg,
                             nrf_dppi_channel_group_t group)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->TASKS_CHG[(uint32_t) group].DIS = 1;
 
     uint dppi_inst = get_dppi_inst_from_ptr(p_reg);
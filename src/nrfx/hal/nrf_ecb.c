@@ -8,9 +8,12 @@
 #include "hal/nrf_ecb.h"
 #include "bs_tracing.h"
 #include "NHW_AES_ECB.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_ecb_task_trigger(NRF_ECB_Type * p_reg, nrf_ecb_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
 
   if ( task == NRF_ECB_TASK_STARTECB ) {
@@ -24,18 +27,21 @@ void nrf_ecb_task_trigger(NRF_ECB_Type * p_reg, nrf_ecb_task_t task)
 
 void nrf_ecb_int_enable(NRF_ECB_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
   nhw_ECB_regw_sideeffects_INTENSET();
 }
 
 void nrf_ecb_int_disable(NRF_ECB_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
   nhw_ECB_regw_sideeffects_INTENCLR();
 }
 
 void nrf_ecb_event_clear(NRF_ECB_Type * p_reg, nrf_ecb_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_ECB_regw_sideeffects_EVENTS_all(0);
 }
@@ -60,6 +66,7 @@ void nrf_ecb_subscribe_set(NRF_ECB_Type * p_reg,
                            nrf_ecb_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_ecb_subscribe_common(p_reg, task);
@@ -68,8 +75,23 @@ void nrf_ecb_subscribe_set(NRF_ECB_Type * p_reg,
 void nrf_ecb_subscribe_clear(NRF_ECB_Type * p_reg,
                              nrf_ecb_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_ecb_subscribe_common(p_reg, task);
 }
 
 #endif /* defined(DPPI_PRESENT) */
+
+#if NHW_DMA_ADDR_TRANSLATION
+/* 64 bit hosts pointers do not fit in ECBDATAPTR, see NHW_dma_addr.h */
+
+void nrf_ecb_data_pointer_set(NRF_ECB_Type * p_reg, void const * p_buffer)
+{
+  p_reg->ECBDATAPTR = nhw_dma_ptr_to_addr(p_buffer);
+}
+
+void * nrf_ecb_data_pointer_get(NRF_ECB_Type const * p_reg)
+{
+  return nhw_dma_addr_to_ptr(p_reg->ECBDATAPTR);
+}
+#endif /* NHW_DMA_ADDR_TRANSLATION */
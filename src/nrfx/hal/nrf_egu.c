@@ -8,14 +8,16 @@
 #include "hal/nrf_egu.h"
 #include "bs_tracing.h"
 #include "NHW_EGU.h"
+#include "NHW_reg_profiler.h"
 
 static int egu_number_from_ptr(NRF_EGU_Type const * p_reg){
-  int i = ( (int)p_reg - (int)&NRF_EGU_regs[0] ) / sizeof(NRF_EGU_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)&NRF_EGU_regs[0] ) / sizeof(NRF_EGU_Type);
   return i;
 }
 
 void nrf_egu_task_trigger(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + egu_task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)egu_task)) = 0x1UL;
 
   int i = egu_number_from_ptr(p_reg);
@@ -26,6 +28,7 @@ void nrf_egu_task_trigger(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task)
 
 void nrf_egu_event_clear(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + egu_event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)egu_event)) = 0x0UL;
 
   int i = egu_number_from_ptr(p_reg);
@@ -36,6 +39,7 @@ void nrf_egu_event_clear(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event)
 
 void nrf_egu_int_enable(NRF_EGU_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
 
   int i = egu_number_from_ptr(p_reg);
@@ -44,6 +48,7 @@ void nrf_egu_int_enable(NRF_EGU_Type * p_reg, uint32_t mask)
 
 void nrf_egu_int_disable(NRF_EGU_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
 
   int i = egu_number_from_ptr(p_reg);
@@ -55,6 +60,7 @@ void nrf_egu_subscribe_set(NRF_EGU_Type * p_reg,
                            nrf_egu_task_t task,
                            uint8_t        channel)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   NRFX_ASSERT(p_reg);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
           ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
@@ -68,6 +74,7 @@ void nrf_egu_subscribe_set(NRF_EGU_Type * p_reg,
 void nrf_egu_subscribe_clear(NRF_EGU_Type * p_reg,
                              nrf_egu_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   NRFX_ASSERT(p_reg);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
 
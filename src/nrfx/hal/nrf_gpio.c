@@ -52,9 +52,10 @@
 #include "NRF_GPIO.h"
 #include "hal/nrf_gpio.h"
 #include "bs_tracing.h"
+#include "NHW_reg_profiler.h"
 
 static int gpio_number_from_ptr(NRF_GPIO_Type const * p_reg){
-	int i = ( (int)p_reg - (int)&NRF_GPIO_regs[0] ) / sizeof(NRF_GPIO_Type);
+	int i = ( (intptr_t)p_reg - (intptr_t)&NRF_GPIO_regs[0] ) / sizeof(NRF_GPIO_Type);
 	return i;
 }
 
@@ -138,6 +139,7 @@ void nrf_gpio_reconfigure(uint32_t                     pin_number,
 
 void nrf_gpio_port_pin_output_set(NRF_GPIO_Type * p_reg, uint32_t pin_number)
 {
+    NHW_REG_PROF(p_reg);
     uint32_t cnf = ((uint32_t)NRF_GPIO_PIN_DIR_OUTPUT << GPIO_PIN_CNF_DIR_Pos) |
            ((uint32_t)NRF_GPIO_PIN_INPUT_DISCONNECT << GPIO_PIN_CNF_INPUT_Pos) |
            ((uint32_t)NRF_GPIO_PIN_NOPULL << GPIO_PIN_CNF_PULL_Pos)            |
@@ -155,6 +157,7 @@ void nrf_gpio_port_pin_input_set(NRF_GPIO_Type *     p_reg,
                                                    uint32_t            pin_number,
                                                    nrf_gpio_pin_pull_t pull_config)
 {
+    NHW_REG_PROF(p_reg);
     uint32_t cnf = ((uint32_t)NRF_GPIO_PIN_DIR_INPUT << GPIO_PIN_CNF_DIR_Pos) |
            ((uint32_t)NRF_GPIO_PIN_INPUT_CONNECT << GPIO_PIN_CNF_INPUT_Pos)   |
            ((uint32_t)pull_config << GPIO_PIN_CNF_PULL_Pos)                   |
@@ -205,6 +208,7 @@ void nrf_gpio_pin_toggle(uint32_t pin_number)
 
 void nrf_gpio_port_dir_output_set(NRF_GPIO_Type * p_reg, uint32_t out_mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->DIRSET = out_mask;
     nrf_gpio_regw_sideeffects_DIRSET(gpio_number_from_ptr(p_reg));
 }
@@ -212,24 +216,28 @@ void nrf_gpio_port_dir_output_set(NRF_GPIO_Type * p_reg, uint32_t out_mask)
 
 void nrf_gpio_port_dir_input_set(NRF_GPIO_Type * p_reg, uint32_t in_mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->DIRCLR = in_mask;
     nrf_gpio_regw_sideeffects_DIRCLR(gpio_number_from_ptr(p_reg));
 }
 
 void nrf_gpio_port_dir_write(NRF_GPIO_Type * p_reg, uint32_t value)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->DIR = value;
     nrf_gpio_regw_sideeffects_DIR(gpio_number_from_ptr(p_reg));
 }
 
 void nrf_gpio_port_out_write(NRF_GPIO_Type * p_reg, uint32_t value)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->OUT = value;
     nrf_gpio_regw_sideeffects_OUT(gpio_number_from_ptr(p_reg));
 }
 
 void nrf_gpio_port_out_set(NRF_GPIO_Type * p_reg, uint32_t set_mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->OUTSET = set_mask;
     nrf_gpio_regw_sideeffects_OUTSET(gpio_number_from_ptr(p_reg));
 }
@@ -237,12 +245,14 @@ void nrf_gpio_port_out_set(NRF_GPIO_Type * p_reg, uint32_t set_mask)
 
 void nrf_gpio_port_out_clear(NRF_GPIO_Type * p_reg, uint32_t clr_mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->OUTCLR = clr_mask;
     nrf_gpio_regw_sideeffects_OUTCLR(gpio_number_from_ptr(p_reg));
 }
 
 void nrf_gpio_port_detect_latch_set(NRF_GPIO_Type * p_reg, bool enable)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->DETECTMODE = (enable ? GPIO_DETECTMODE_DETECTMODE_LDETECT :
                                   GPIO_DETECTMODE_DETECTMODE_Default);
     nrf_gpio_regw_sideeffects_DETECTMODE(gpio_number_from_ptr(p_reg));
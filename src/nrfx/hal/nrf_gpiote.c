@@ -43,14 +43,16 @@
 #include "NRF_GPIOTE.h"
 #include "hal/nrf_gpiote.h"
 #include "bs_tracing.h"
+#include "NHW_reg_profiler.h"
 
 static int gpiote_number_from_ptr(NRF_GPIOTE_Type const * p_reg){
-  int i = ( (int)p_reg - (int)&NRF_GPIOTE_regs[0] ) / sizeof(NRF_GPIOTE_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)&NRF_GPIOTE_regs[0] ) / sizeof(NRF_GPIOTE_Type);
   return i;
 }
 
 void nrf_gpiote_task_trigger(NRF_GPIOTE_Type * p_reg, nrf_gpiote_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   uint32_t *reg = (uint32_t *)((uintptr_t)p_reg + task);
   *(volatile uint32_t *)reg = 0x1UL;
 
@@ -72,6 +74,7 @@ void nrf_gpiote_task_trigger(NRF_GPIOTE_Type * p_reg, nrf_gpiote_task_t task)
 
 void nrf_gpiote_event_clear(NRF_GPIOTE_Type * p_reg, nrf_gpiote_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   uint32_t *reg = (uint32_t *)((uintptr_t)p_reg + event);
   *(volatile uint32_t *)reg = 0;
 
@@ -104,6 +107,7 @@ void nrf_gpiote_event_clear(NRF_GPIOTE_Type * p_reg, nrf_gpiote_event_t event)
 
 void nrf_gpiote_int_enable(NRF_GPIOTE_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     uint inst = gpiote_number_from_ptr(p_reg);
     p_reg->NRFX_CONCAT_2(INTENSET, NRF_GPIOTE_IRQ_GROUP) = mask;
     nrf_gpiote_regw_sideeffects_INTENSET(inst, DEFAULT_IRQ_LINE);
@@ -112,6 +116,7 @@ void nrf_gpiote_int_enable(NRF_GPIOTE_Type * p_reg, uint32_t mask)
 
 void nrf_gpiote_int_disable(NRF_GPIOTE_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     uint inst = gpiote_number_from_ptr(p_reg);
     p_reg->NRFX_CONCAT_2(INTENCLR, NRF_GPIOTE_IRQ_GROUP) = mask;
     nrf_gpiote_regw_sideeffects_INTENCLR(inst, DEFAULT_IRQ_LINE);
@@ -119,6 +124,7 @@ void nrf_gpiote_int_disable(NRF_GPIOTE_Type * p_reg, uint32_t mask)
 
 void nrf_gpiote_event_enable(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 {
+   NHW_REG_PROF(p_reg);
    uint inst = gpiote_number_from_ptr(p_reg);
    p_reg->CONFIG[idx] |= GPIOTE_CONFIG_MODE_Event;
    nrf_gpiote_regw_sideeffects_CONFIG(inst, idx);
@@ -126,6 +132,7 @@ void nrf_gpiote_event_enable(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 
 void nrf_gpiote_event_disable(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 {
+   NHW_REG_PROF(p_reg);
    uint inst = gpiote_number_from_ptr(p_reg);
    p_reg->CONFIG[idx] &= ~GPIOTE_CONFIG_MODE_Msk;
    nrf_gpiote_regw_sideeffects_CONFIG(inst, idx);
@@ -136,6 +143,7 @@ void nrf_gpiote_int_group_enable(NRF_GPIOTE_Type * p_reg,
                                  uint8_t           group_idx,
                                  uint32_t          mask)
 {
+    NHW_REG_PROF(p_reg);
     switch (group_idx)
     {
         case 0:
@@ -181,6 +189,7 @@ void nrf_gpiote_int_group_disable(NRF_GPIOTE_Type * p_reg,
                                   uint8_t           group_idx,
                                   uint32_t          mask)
 {
+    NHW_REG_PROF(p_reg);
     switch (group_idx)
     {
         case 0:
@@ -228,6 +237,7 @@ void nrf_gpiote_event_configure(NRF_GPIOTE_Type *     p_reg,
                                 uint32_t              pin,
                                 nrf_gpiote_polarity_t polarity)
 {
+  NHW_REG_PROF(p_reg);
   uint inst = gpiote_number_from_ptr(p_reg);
   p_reg->CONFIG[idx] &= ~(GPIOTE_CONFIG_PORT_PIN_Msk | GPIOTE_CONFIG_POLARITY_Msk);
   p_reg->CONFIG[idx] |= ((pin << GPIOTE_CONFIG_PSEL_Pos) & GPIOTE_CONFIG_PORT_PIN_Msk) |
@@ -237,6 +247,7 @@ void nrf_gpiote_event_configure(NRF_GPIOTE_Type *     p_reg,
 
 void nrf_gpiote_task_enable(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 {
+    NHW_REG_PROF(p_reg);
     uint inst = gpiote_number_from_ptr(p_reg);
     uint32_t final_config = p_reg->CONFIG[idx] | GPIOTE_CONFIG_MODE_Task;
     p_reg->CONFIG[idx] = final_config;
@@ -245,6 +256,7 @@ void nrf_gpiote_task_enable(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 
 void nrf_gpiote_task_disable(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 {
+    NHW_REG_PROF(p_reg);
     uint inst = gpiote_number_from_ptr(p_reg);
     p_reg->CONFIG[idx] &= ~GPIOTE_CONFIG_MODE_Msk;
     nrf_gpiote_regw_sideeffects_CONFIG(inst, idx);
@@ -256,6 +268,7 @@ void nrf_gpiote_task_configure(NRF_GPIOTE_Type *     p_reg,
                                nrf_gpiote_polarity_t polarity,
                                nrf_gpiote_outinit_t  init_val)
 {
+  NHW_REG_PROF(p_reg);
   uint inst = gpiote_number_from_ptr(p_reg);
   p_reg->CONFIG[idx] &= ~(GPIOTE_CONFIG_PORT_PIN_Msk |
                           GPIOTE_CONFIG_POLARITY_Msk |
@@ -272,6 +285,7 @@ void nrf_gpiote_task_force(NRF_GPIOTE_Type *    p_reg,
                            uint32_t             idx,
                            nrf_gpiote_outinit_t init_val)
 {
+    NHW_REG_PROF(p_reg);
     uint inst = gpiote_number_from_ptr(p_reg);
     p_reg->CONFIG[idx] = (p_reg->CONFIG[idx] & ~GPIOTE_CONFIG_OUTINIT_Msk) |
                          ((init_val << GPIOTE_CONFIG_OUTINIT_Pos) & GPIOTE_CONFIG_OUTINIT_Msk);
@@ -280,6 +294,7 @@ void nrf_gpiote_task_force(NRF_GPIOTE_Type *    p_reg,
 
 void nrf_gpiote_te_default(NRF_GPIOTE_Type * p_reg, uint32_t idx)
 {
+    NHW_REG_PROF(p_reg);
     uint inst = gpiote_number_from_ptr(p_reg);
     p_reg->CONFIG[idx] = 0;
 #if !defined(NRF51_SERIES) && !defined(NRF52_SERIES)
@@ -314,6 +329,7 @@ void nrf_gpiote_subscribe_set(NRF_GPIOTE_Type * p_reg,
                               nrf_gpiote_task_t task,
                               uint8_t           channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_gpiote_subscribe_common(p_reg, task);
@@ -321,6 +337,7 @@ void nrf_gpiote_subscribe_set(NRF_GPIOTE_Type * p_reg,
 
 void nrf_gpiote_subscribe_clear(NRF_GPIOTE_Type * p_reg, nrf_gpiote_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_gpiote_subscribe_common(p_reg, task);
 }
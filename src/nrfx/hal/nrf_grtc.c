@@ -8,11 +8,13 @@
 #include "hal/nrf_grtc.h"
 #include "bs_tracing.h"
 #include "NHW_GRTC.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_grtc_sys_counter_cc_set(NRF_GRTC_Type * p_reg,
                                  uint8_t         cc_channel,
                                  uint64_t        cc_value)
 {
+  NHW_REG_PROF(p_reg);
 #if NRF_GRTC_HAS_EXTENDED
     NRFX_ASSERT(cc_channel < NRF_GRTC_SYSCOUNTER_CC_COUNT);
 #else
@@ -33,6 +35,7 @@ void nrf_grtc_sys_counter_cc_add_set(NRF_GRTC_Type *             p_reg,
                                      uint32_t                    value,
                                      nrf_grtc_cc_add_reference_t reference)
 {
+  NHW_REG_PROF(p_reg);
 #if NRF_GRTC_HAS_EXTENDED
     NRFX_ASSERT(cc_channel < NRF_GRTC_SYSCOUNTER_CC_COUNT);
 #else
@@ -48,12 +51,14 @@ void nrf_grtc_sys_counter_cc_add_set(NRF_GRTC_Type *             p_reg,
 
 void nrf_grtc_int_enable(NRF_GRTC_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->GRTC_INTENSET = mask;
     nhw_GRTC_regw_sideeffects_INTENSET(0, GRTC_IRQ_GROUP);
 }
 
 void nrf_grtc_int_disable(NRF_GRTC_Type * p_reg, uint32_t mask)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->GRTC_INTENCLR = mask;
     nhw_GRTC_regw_sideeffects_INTENCLR(0, GRTC_IRQ_GROUP);
 }
@@ -64,6 +69,7 @@ void nrf_grtc_int_group_enable(NRF_GRTC_Type * p_reg,
                                uint8_t         group_idx,
                                uint32_t        mask)
 {
+  NHW_REG_PROF(p_reg);
   *(uint32_t*)((char*)&p_reg->INTENSET0 + INTENGRPOFFSET*group_idx) = mask;
   nhw_GRTC_regw_sideeffects_INTENSET(0, group_idx);
 }
@@ -72,6 +78,7 @@ void nrf_grtc_int_group_disable(NRF_GRTC_Type * p_reg,
                                                   uint8_t         group_idx,
                                                   uint32_t        mask)
 {
+  NHW_REG_PROF(p_reg);
   *(uint32_t*)((char*)&p_reg->INTENCLR0 + INTENGRPOFFSET*group_idx) = mask;
   nhw_GRTC_regw_sideeffects_INTENCLR(0, group_idx);
 }
@@ -80,6 +87,7 @@ void nrf_grtc_subscribe_set(NRF_GRTC_Type * p_reg,
                            nrf_grtc_task_t task,
                            uint8_t        channel)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
 #if NRF_GRTC_HAS_EXTENDED
     NRFX_ASSERT((task != NRF_GRTC_TASK_START) &&
                 (task != NRF_GRTC_TASK_CLEAR) &&
@@ -97,6 +105,7 @@ void nrf_grtc_subscribe_set(NRF_GRTC_Type * p_reg,
 void nrf_grtc_subscribe_clear(NRF_GRTC_Type * p_reg,
                              nrf_grtc_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
 #if NRF_GRTC_HAS_EXTENDED
     NRFX_ASSERT((task != NRF_GRTC_TASK_START) &&
                 (task != NRF_GRTC_TASK_CLEAR) &&
@@ -112,6 +121,7 @@ void nrf_grtc_subscribe_clear(NRF_GRTC_Type * p_reg,
 
 void nrf_grtc_event_clear(NRF_GRTC_Type * p_reg, nrf_grtc_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
 
   nhw_GRTC_regw_sideeffects_EVENTS_all(0);
@@ -120,6 +130,7 @@ void nrf_grtc_event_clear(NRF_GRTC_Type * p_reg, nrf_grtc_event_t event)
 
 uint32_t nrf_grtc_sys_counter_low_get(NRF_GRTC_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     (void) p_reg;
 #if NRF_GRTC_HAS_SYSCOUNTER_ARRAY
     return nhw_GRTC_regr_sideeffects_SYSCOUNTERL(0, NRF_GRTC_DOMAIN_INDEX);
@@ -131,6 +142,7 @@ uint32_t nrf_grtc_sys_counter_low_get(NRF_GRTC_Type const * p_reg)
 
 uint32_t nrf_grtc_sys_counter_high_get(NRF_GRTC_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     (void) p_reg;
 #if NRF_GRTC_HAS_SYSCOUNTER_ARRAY
     return nhw_GRTC_regr_sideeffects_SYSCOUNTERH(0, NRF_GRTC_DOMAIN_INDEX);
@@ -141,6 +153,7 @@ uint32_t nrf_grtc_sys_counter_high_get(NRF_GRTC_Type const * p_reg)
 
 uint64_t nrf_grtc_sys_counter_get(NRF_GRTC_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     nhw_GRTC_regr_sideeffects_SYSCOUNTERL(0, NRF_GRTC_DOMAIN_INDEX);
     nhw_GRTC_regr_sideeffects_SYSCOUNTERH(0, NRF_GRTC_DOMAIN_INDEX);
     return *((const uint64_t volatile *)&p_reg->GRTC_SYSCOUNTER.SYSCOUNTERL);
@@ -148,6 +161,7 @@ uint64_t nrf_grtc_sys_counter_get(NRF_GRTC_Type const * p_reg)
 
 bool nrf_grtc_sys_counter_overflow_check(NRF_GRTC_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     nhw_GRTC_regr_sideeffects_SYSCOUNTERH(0, NRF_GRTC_DOMAIN_INDEX);
     return (p_reg->GRTC_SYSCOUNTER.SYSCOUNTERH &
             GRTC_SYSCOUNTER_SYSCOUNTERH_OVERFLOW_Msk) ? true : false;
@@ -156,6 +170,7 @@ bool nrf_grtc_sys_counter_overflow_check(NRF_GRTC_Type const * p_reg)
 uint64_t nrf_grtc_sys_counter_indexed_get(NRF_GRTC_Type const * p_reg,
                                           uint8_t               index)
 {
+    NHW_REG_PROF(p_reg);
     nhw_GRTC_regr_sideeffects_SYSCOUNTERL(0, index);
     nhw_GRTC_regr_sideeffects_SYSCOUNTERH(0, index);
     return *((const uint64_t volatile *)&p_reg->SYSCOUNTER[index]);
@@ -163,6 +178,7 @@ uint64_t nrf_grtc_sys_counter_indexed_get(NRF_GRTC_Type const * p_reg,
 
 void nrf_grtc_task_trigger(NRF_GRTC_Type * p_reg, nrf_grtc_task_t grtc_task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + grtc_task);
     uint inst = 0;
     *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)grtc_task)) = 0x1UL;
 
@@ -189,6 +205,7 @@ void nrf_grtc_task_trigger(NRF_GRTC_Type * p_reg, nrf_grtc_task_t grtc_task)
 void nrf_grtc_sys_counter_compare_event_enable(NRF_GRTC_Type * p_reg,
                                                                  uint8_t         cc_channel)
 {
+  NHW_REG_PROF(p_reg);
 
 #if NRF_GRTC_HAS_EXTENDED
     NRFX_ASSERT(cc_channel < NRF_GRTC_SYSCOUNTER_CC_COUNT);
@@ -203,6 +220,7 @@ void nrf_grtc_sys_counter_compare_event_enable(NRF_GRTC_Type * p_reg,
 void nrf_grtc_sys_counter_compare_event_disable(NRF_GRTC_Type * p_reg,
                                                                   uint8_t         cc_channel)
 {
+  NHW_REG_PROF(p_reg);
 #if NRF_GRTC_HAS_EXTENDED
     NRFX_ASSERT(cc_channel < NRF_GRTC_SYSCOUNTER_CC_COUNT);
 #else
@@ -8,14 +8,16 @@
 #include "hal/nrf_ipc.h"
 #include "bs_tracing.h"
 #include "NHW_IPC.h"
+#include "NHW_reg_profiler.h"
 
 static int ipc_number_from_ptr(NRF_IPC_Type const * p_reg){
-  int i = ( (int)p_reg - (int)&NRF_IPC_regs[0] ) / sizeof(NRF_IPC_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)&NRF_IPC_regs[0] ) / sizeof(NRF_IPC_Type);
   return i;
 }
 
 void nrf_ipc_task_trigger(NRF_IPC_Type * p_reg, nrf_ipc_task_t ipc_task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + ipc_task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)ipc_task)) = 0x1UL;
 
   int i = ipc_number_from_ptr(p_reg);
@@ -25,6 +27,7 @@ void nrf_ipc_task_trigger(NRF_IPC_Type * p_reg, nrf_ipc_task_t ipc_task)
 
 void nrf_ipc_event_clear(NRF_IPC_Type * p_reg, nrf_ipc_event_t ipc_event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + ipc_event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)ipc_event)) = 0x0UL;
 
   int i = ipc_number_from_ptr(p_reg);
@@ -33,6 +36,7 @@ void nrf_ipc_event_clear(NRF_IPC_Type * p_reg, nrf_ipc_event_t ipc_event)
 
 void nrf_ipc_int_enable(NRF_IPC_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENSET = mask;
 
   int i = ipc_number_from_ptr(p_reg);
@@ -41,17 +45,28 @@ void nrf_ipc_int_enable(NRF_IPC_Type * p_reg, uint32_t mask)
 
 void nrf_ipc_int_disable(NRF_IPC_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->INTENCLR = mask;
 
   int i = ipc_number_from_ptr(p_reg);
   nhw_IPC_regw_sideeffects_INTENCLR(i);
 }
 
+void nrf_ipc_receive_config_set(NRF_IPC_Type * p_reg, uint8_t index, uint32_t channels_mask)
+{
+  NHW_REG_PROF(p_reg);
+  p_reg->RECEIVE_CNF[index] = channels_mask;
+
+  int i = ipc_number_from_ptr(p_reg);
+  nhw_IPC_regw_sideeffects_RECEIVE_CNF(i, index);
+}
+
 #if defined(DPPI_PRESENT)
 void nrf_ipc_subscribe_set(NRF_IPC_Type * p_reg,
                            nrf_ipc_task_t task,
                            uint8_t        channel)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   NRFX_ASSERT(p_reg);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
           ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
@@ -65,6 +80,7 @@ void nrf_ipc_subscribe_set(NRF_IPC_Type * p_reg,
 void nrf_ipc_subscribe_clear(NRF_IPC_Type * p_reg,
                              nrf_ipc_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   NRFX_ASSERT(p_reg);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
 
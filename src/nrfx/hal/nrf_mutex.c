@@ -8,15 +8,18 @@
 #include "hal/nrf_mutex.h"
 #include "bs_tracing.h"
 #include "NHW_MUTEX.h"
+#include "NHW_reg_profiler.h"
 
 bool nrf_mutex_lock(NRF_MUTEX_Type * p_reg, uint8_t mutex)
 {
+    NHW_REG_PROF(p_reg);
     (void) p_reg;
     return (nhw_MUTEX_regr_sideeffects_MUTEX(mutex) == MUTEX_MUTEX_MUTEX_Unlocked);
 }
 
 void nrf_mutex_unlock(NRF_MUTEX_Type * p_reg, uint8_t mutex)
 {
+    NHW_REG_PROF(p_reg);
     (void) p_reg;
     nhw_MUTEX_regw_sideeffects_MUTEX(mutex);
 }
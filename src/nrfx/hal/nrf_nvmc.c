@@ -11,6 +11,7 @@
 #include "bs_utils.h"
 #include "NHW_NVMC.h"
 #include <nrfx_glue.h>
+#include "NHW_reg_profiler.h"
 
 static int nvmc_number_from_ptr(NRF_NVMC_Type * p_reg)
 {
@@ -20,6 +21,7 @@ static int nvmc_number_from_ptr(NRF_NVMC_Type * p_reg)
 
 void nrf_nvmc_page_erase_start(NRF_NVMC_Type * p_reg, uint32_t page_addr)
 {
+    NHW_REG_PROF(p_reg);
     int i = nvmc_number_from_ptr(p_reg);
 
 #if defined(NRF52_SERIES)
@@ -33,6 +35,7 @@ void nrf_nvmc_page_erase_start(NRF_NVMC_Type * p_reg, uint32_t page_addr)
 #if defined(NVMC_ERASEUICR_ERASEUICR_Msk)
 void nrf_nvmc_uicr_erase_start(NRF_NVMC_Type * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     int i = nvmc_number_from_ptr(p_reg);
 
     p_reg->ERASEUICR = 1;
@@ -42,6 +45,7 @@ void nrf_nvmc_uicr_erase_start(NRF_NVMC_Type * p_reg)
 
 void nrf_nvmc_erase_all_start(NRF_NVMC_Type * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     int i = nvmc_number_from_ptr(p_reg);
 
     p_reg->ERASEALL = 1;
@@ -50,6 +54,7 @@ void nrf_nvmc_erase_all_start(NRF_NVMC_Type * p_reg)
 
 void nrf_nvmc_page_partial_erase_start(NRF_NVMC_Type * p_reg, uint32_t page_addr)
 {
+    NHW_REG_PROF(p_reg);
     int i = nvmc_number_from_ptr(p_reg);
 
 #if defined(NVMC_ERASEPAGEPARTIAL_ERASEPAGEPARTIAL_Msk)
@@ -80,6 +85,11 @@ void nrf_nvmc_word_write(uint32_t addr, uint32_t value)
     nhw_nmvc_write_word(addr, value);
 }
 
+void nrf_nvmc_buffer_write(uint32_t address, void const * src, uint32_t num_bytes)
+{
+    nhw_nmvc_write_buffer(address, src, num_bytes);
+}
+
 void nrf_nvmc_buffer_read(void *dest, uint32_t addr, size_t n)
 {
     nhw_nmvc_read_buffer(dest, addr, n);
@@ -106,6 +116,7 @@ static void nrf_nvmc_ready_wait(unsigned int inst)
 
 bool nrf_nvmc_ready_check(NRF_NVMC_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     bool ready = (bool)(p_reg->READY & NVMC_READY_READY_Msk);
     if (!ready) {
         int i = nvmc_number_from_ptr((NRF_NVMC_Type *)p_reg);
@@ -116,5 +127,6 @@ bool nrf_nvmc_ready_check(NRF_NVMC_Type const * p_reg)
 
 bool nrf_nvmc_write_ready_check(NRF_NVMC_Type const * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     return nrf_nvmc_ready_check(p_reg);
 }
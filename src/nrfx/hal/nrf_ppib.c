@@ -8,9 +8,10 @@
 #include "hal/nrf_ppib.h"
 #include "NHW_PPIB.h"
 #include "bs_tracing.h"
+#include "NHW_reg_profiler.h"
 
 static int ppib_number_from_ptr(NRF_PPIB_Type const * p_reg){
-  int i = ( (int)p_reg - (int)&NRF_PPIB_regs[0] ) / sizeof(NRF_PPIB_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)&NRF_PPIB_regs[0] ) / sizeof(NRF_PPIB_Type);
   return i;
 }
 
@@ -21,6 +22,7 @@ void nrf_ppib_subscribe_set(NRF_PPIB_Type * p_reg,
                             nrf_ppib_task_t task,
                             uint8_t        channel)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   NRFX_ASSERT(p_reg);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
           ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
@@ -34,6 +36,7 @@ void nrf_ppib_subscribe_set(NRF_PPIB_Type * p_reg,
 void nrf_ppib_subscribe_clear(NRF_PPIB_Type * p_reg,
                               nrf_ppib_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   NRFX_ASSERT(p_reg);
   *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
 
@@ -11,9 +11,12 @@
 #include "hal/nrf_radio.h"
 #include "bs_tracing.h"
 #include "NHW_RADIO.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_radio_task_trigger(NRF_RADIO_Type * p_reg, nrf_radio_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
 
 #define CASE_CALL_SIDEEFFECT(x) \
@@ -54,6 +57,7 @@ void nrf_radio_task_trigger(NRF_RADIO_Type * p_reg, nrf_radio_task_t task)
 
 void nrf_radio_int_enable(NRF_RADIO_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
 #if defined(RADIO_INTENSET_READY_Msk)
     p_reg->INTENSET = mask;
 #elif defined(RADIO_INTENSET00_READY_Msk)
@@ -64,6 +68,7 @@ void nrf_radio_int_enable(NRF_RADIO_Type * p_reg, uint32_t mask)
 
 void nrf_radio_int_disable(NRF_RADIO_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
 #if defined(RADIO_INTENCLR_READY_Msk)
     p_reg->INTENCLR = mask;
 #elif defined(RADIO_INTENCLR00_READY_Msk)
@@ -74,6 +79,7 @@ void nrf_radio_int_disable(NRF_RADIO_Type * p_reg, uint32_t mask)
 
 void nrf_radio_bcc_set(NRF_RADIO_Type * p_reg, uint32_t radio_bcc)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->BCC = radio_bcc;
   nhw_RADIO_regw_sideeffects_BCC();
 }
@@ -81,6 +87,7 @@ void nrf_radio_bcc_set(NRF_RADIO_Type * p_reg, uint32_t radio_bcc)
 #if defined(RADIO_POWER_POWER_Msk)
 void nrf_radio_power_set(NRF_RADIO_Type * p_reg, bool radio_power)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->POWER = (uint32_t) radio_power;
   nhw_RADIO_regw_sideeffects_POWER();
 }
@@ -88,6 +95,7 @@ void nrf_radio_power_set(NRF_RADIO_Type * p_reg, bool radio_power)
 
 void nrf_radio_event_clear(NRF_RADIO_Type * p_reg, nrf_radio_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_RADIO_regw_sideeffects_EVENTS_all(0);
 }
@@ -140,6 +148,7 @@ void nrf_radio_subscribe_set(NRF_RADIO_Type * p_reg,
                              nrf_radio_task_t task,
                              uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + NRF_RADIO_DPPI_OFFSET)) =
           ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_radio_subscribe_common(p_reg, task);
@@ -148,8 +157,23 @@ void nrf_radio_subscribe_set(NRF_RADIO_Type * p_reg,
 void nrf_radio_subscribe_clear(NRF_RADIO_Type * p_reg,
                                nrf_radio_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + NRF_RADIO_DPPI_OFFSET)) = 0;
     nrf_radio_subscribe_common(p_reg, task);
 }
 
 #endif /* defined(DPPI_PRESENT) */
+
+#if NHW_DMA_ADDR_TRANSLATION
+/* 64 bit hosts pointers do not fit in PACKETPTR, see NHW_dma_addr.h */
+
+void nrf_radio_packetptr_set(NRF_RADIO_Type * p_reg, void const * p_packet)
+{
+  p_reg->PACKETPTR = nhw_dma_ptr_to_addr(p_packet);
+}
+
+void * nrf_radio_packetptr_get(NRF_RADIO_Type const * p_reg)
+{
+  return nhw_dma_addr_to_ptr(p_reg->PACKETPTR);
+}
+#endif /* NHW_DMA_ADDR_TRANSLATION */
@@ -8,11 +8,13 @@
 #include "hal/nrf_rng.h"
 #include "bs_tracing.h"
 #include "NHW_RNG.h"
+#include "NHW_reg_profiler.h"
 
 extern NRF_RNG_Type NRF_RNG_regs;
 
 void nrf_rng_task_trigger(NRF_RNG_Type * p_reg, nrf_rng_task_t rng_task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + rng_task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)rng_task)) = 0x1UL;
 
   if ( rng_task == NRF_RNG_TASK_START ) {
@@ -26,6 +28,7 @@ void nrf_rng_task_trigger(NRF_RNG_Type * p_reg, nrf_rng_task_t rng_task)
 
 void nrf_rng_int_enable(NRF_RNG_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   (void) p_reg;
   NRF_RNG_regs.INTENSET = mask;
   nhw_RNG_regw_sideeffects_INTENSET();
@@ -33,6 +36,7 @@ void nrf_rng_int_enable(NRF_RNG_Type * p_reg, uint32_t mask)
 
 void nrf_rng_int_disable(NRF_RNG_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   (void) p_reg;
   NRF_RNG_regs.INTENCLR = mask;
   nhw_RNG_regw_sideeffects_INTENCLR();
@@ -40,6 +44,7 @@ void nrf_rng_int_disable(NRF_RNG_Type * p_reg, uint32_t mask)
 
 void nrf_rng_event_clear(NRF_RNG_Type * p_reg, nrf_rng_event_t rng_event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + rng_event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)rng_event)) = 0x0UL;
   nhw_RNG_regw_sideeffects_EVENTS_all(0);
 }
@@ -64,6 +69,7 @@ void nrf_rng_subscribe_set(NRF_RNG_Type * p_reg,
                            nrf_rng_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_rng_subscribe_common(p_reg, task);
@@ -72,6 +78,7 @@ void nrf_rng_subscribe_set(NRF_RNG_Type * p_reg,
 void nrf_rng_subscribe_clear(NRF_RNG_Type * p_reg,
                                                nrf_rng_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_rng_subscribe_common(p_reg, task);
 }
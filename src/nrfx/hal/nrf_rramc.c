@@ -9,9 +9,11 @@
 #include <stdint.h>
 #include "hal/nrf_rramc.h"
 #include "NHW_RRAMC.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_rramc_erase_all_set(NRF_RRAMC_Type * p_reg)
 {
+    NHW_REG_PROF(p_reg);
     p_reg->ERASE.ERASEALL = RRAMC_ERASE_ERASEALL_ERASE_Erase;
     nhw_RRAMC_regw_sideeffects_ERASEALL(0);
 }
@@ -9,14 +9,16 @@
 #include "hal/nrf_rtc.h"
 #include "bs_tracing.h"
 #include "NHW_RTC.h"
+#include "NHW_reg_profiler.h"
 
 static int rtc_number_from_ptr(NRF_RTC_Type const * p_reg){
-  int i = ( (int)p_reg - (int)&NRF_RTC_regs[0] ) / sizeof(NRF_RTC_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)&NRF_RTC_regs[0] ) / sizeof(NRF_RTC_Type);
   return i;
 }
 
 void nrf_rtc_cc_set(NRF_RTC_Type * p_reg, uint32_t ch, uint32_t cc_val)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->CC[ch] = cc_val & 0xFFFFFF;
   int i = rtc_number_from_ptr(p_reg);
   nhw_rtc_regw_sideeffects_CC(i, ch);
@@ -24,6 +26,7 @@ void nrf_rtc_cc_set(NRF_RTC_Type * p_reg, uint32_t ch, uint32_t cc_val)
 
 void nrf_rtc_int_enable(NRF_RTC_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = rtc_number_from_ptr(p_reg);
   p_reg->INTENSET = mask;
   nhw_rtc_regw_sideeffect_INTENSET(i);
@@ -31,6 +34,7 @@ void nrf_rtc_int_enable(NRF_RTC_Type * p_reg, uint32_t mask)
 
 void nrf_rtc_int_disable(NRF_RTC_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = rtc_number_from_ptr(p_reg);
   p_reg->INTENCLR = mask;
   nhw_rtc_regw_sideeffect_INTENCLR(i);
@@ -38,6 +42,7 @@ void nrf_rtc_int_disable(NRF_RTC_Type * p_reg, uint32_t mask)
 
 uint32_t nrf_rtc_counter_get(NRF_RTC_Type const * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = rtc_number_from_ptr(p_reg);
   nhw_rtc_update_COUNTER(i);
   return p_reg->COUNTER;
@@ -45,7 +50,8 @@ uint32_t nrf_rtc_counter_get(NRF_RTC_Type const * p_reg)
 
 void nrf_rtc_task_trigger(NRF_RTC_Type * p_reg, nrf_rtc_task_t task)
 {
-  *(uint32_t *)((uint32_t)p_reg + task) = 1;
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
+  *(uint32_t *)((uintptr_t)p_reg + task) = 1;
 
   int i = rtc_number_from_ptr(p_reg);
 
@@ -69,6 +75,7 @@ void nrf_rtc_task_trigger(NRF_RTC_Type * p_reg, nrf_rtc_task_t task)
 
 void nrf_rtc_event_clear(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + event);
     *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0;
 
     int i = rtc_number_from_ptr(p_reg);
@@ -77,6 +84,7 @@ void nrf_rtc_event_clear(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
 
 void nrf_rtc_event_enable(NRF_RTC_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = rtc_number_from_ptr(p_reg);
   p_reg->EVTENSET = mask;
   nhw_rtc_regw_sideeffect_EVTENSET(i);
@@ -84,6 +92,7 @@ void nrf_rtc_event_enable(NRF_RTC_Type * p_reg, uint32_t mask)
 
 void nrf_rtc_event_disable(NRF_RTC_Type * p_reg, uint32_t event)
 {
+  NHW_REG_PROF(p_reg);
   int i = rtc_number_from_ptr(p_reg);
   p_reg->EVTENCLR = event;
   nhw_rtc_regw_sideeffect_EVTENCLR(i);
@@ -119,6 +128,7 @@ void nrf_rtc_subscribe_set(NRF_RTC_Type * p_reg,
                            nrf_rtc_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_rtc_subscribe_common(p_reg, task);
@@ -127,6 +137,7 @@ void nrf_rtc_subscribe_set(NRF_RTC_Type * p_reg,
 void nrf_rtc_subscribe_clear(NRF_RTC_Type * p_reg,
                              nrf_rtc_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_rtc_subscribe_common(p_reg, task);
 }
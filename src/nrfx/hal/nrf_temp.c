@@ -8,9 +8,11 @@
 #include "hal/nrf_temp.h"
 #include "bs_tracing.h"
 #include "NHW_TEMP.h"
+#include "NHW_reg_profiler.h"
 
 void nrf_temp_task_trigger(NRF_TEMP_Type * p_reg, nrf_temp_task_t temp_task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + temp_task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)temp_task)) = 0x1UL;
 
   if ( temp_task == NRF_TEMP_TASK_START ) {
@@ -24,6 +26,7 @@ void nrf_temp_task_trigger(NRF_TEMP_Type * p_reg, nrf_temp_task_t temp_task)
 
 void nrf_temp_int_enable(NRF_TEMP_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   (void) p_reg;
   NRF_TEMP_regs.INTENSET = mask;
   nhw_TEMP_regw_sideeffects_INTENSET();
@@ -31,6 +34,7 @@ void nrf_temp_int_enable(NRF_TEMP_Type * p_reg, uint32_t mask)
 
 void nrf_temp_int_disable(NRF_TEMP_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   (void) p_reg;
   NRF_TEMP_regs.INTENCLR = mask;
   nhw_TEMP_regw_sideeffects_INTENCLR();
@@ -38,6 +42,7 @@ void nrf_temp_int_disable(NRF_TEMP_Type * p_reg, uint32_t mask)
 
 void nrf_temp_event_clear(NRF_TEMP_Type * p_reg, nrf_temp_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   nhw_TEMP_regw_sideeffects_EVENTS_all(0);
 }
@@ -62,6 +67,7 @@ void nrf_temp_subscribe_set(NRF_TEMP_Type * p_reg,
                            nrf_temp_task_t task,
                            uint8_t        channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_temp_subscribe_common(p_reg, task);
@@ -70,6 +76,7 @@ void nrf_temp_subscribe_set(NRF_TEMP_Type * p_reg,
 void nrf_temp_subscribe_clear(NRF_TEMP_Type * p_reg,
                              nrf_temp_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_temp_subscribe_common(p_reg, task);
 }
@@ -11,9 +11,10 @@
 #include "hal/nrf_timer.h"
 #include "bs_tracing.h"
 #include "NHW_TIMER.h"
+#include "NHW_reg_profiler.h"
 
 static int timer_number_from_ptr(NRF_TIMER_Type * p_reg){
-  int i = ( (int)p_reg - (int)&NRF_TIMER_regs[0] ) / sizeof(NRF_TIMER_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)&NRF_TIMER_regs[0] ) / sizeof(NRF_TIMER_Type);
   return i;
 }
 
@@ -21,6 +22,7 @@ void nrf_timer_cc_set(NRF_TIMER_Type * p_reg,
     nrf_timer_cc_channel_t cc_channel,
     uint32_t               cc_value)
 {
+  NHW_REG_PROF(p_reg);
   int i = timer_number_from_ptr(p_reg);
   p_reg->CC[cc_channel] = cc_value;
   nhw_timer_regw_sideeffects_CC(i, cc_channel);
@@ -29,6 +31,7 @@ void nrf_timer_cc_set(NRF_TIMER_Type * p_reg,
 void nrf_timer_task_trigger(NRF_TIMER_Type * p_reg,
                             nrf_timer_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   int i = timer_number_from_ptr(p_reg);
 
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
@@ -57,6 +60,7 @@ void nrf_timer_task_trigger(NRF_TIMER_Type * p_reg,
 void nrf_timer_event_clear(NRF_TIMER_Type *  p_reg,
                            nrf_timer_event_t event)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + event);
     *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
     int t = timer_number_from_ptr(p_reg);
     nhw_timer_regw_sideeffects_EVENTS_all(t);
@@ -65,6 +69,7 @@ void nrf_timer_event_clear(NRF_TIMER_Type *  p_reg,
 void nrf_timer_int_enable(NRF_TIMER_Type * p_reg,
                           uint32_t         mask)
 {
+    NHW_REG_PROF(p_reg);
     int i = timer_number_from_ptr(p_reg);
     p_reg->INTENSET = mask;
     nhw_timer_regw_sideeffects_INTENSET(i);
@@ -73,6 +78,7 @@ void nrf_timer_int_enable(NRF_TIMER_Type * p_reg,
 void nrf_timer_int_disable(NRF_TIMER_Type * p_reg,
                            uint32_t         mask)
 {
+    NHW_REG_PROF(p_reg);
     int i = timer_number_from_ptr(p_reg);
     p_reg->INTENCLR = mask;
     nhw_timer_regw_sideeffects_INTENCLR(i);
@@ -110,6 +116,7 @@ void nrf_timer_subscribe_set(NRF_TIMER_Type * p_reg,
                              nrf_timer_task_t task,
                              uint8_t          channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_timer_subscribe_common(p_reg, task);
@@ -118,6 +125,7 @@ void nrf_timer_subscribe_set(NRF_TIMER_Type * p_reg,
 void nrf_timer_subscribe_clear(NRF_TIMER_Type * p_reg,
                                nrf_timer_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_timer_subscribe_common(p_reg, task);
 }
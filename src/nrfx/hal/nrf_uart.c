@@ -10,14 +10,16 @@
 #include "hal/nrf_uart.h"
 #include "bs_tracing.h"
 #include "NHW_UART.h"
+#include "NHW_reg_profiler.h"
 
 static int uart_number_from_ptr(NRF_UART_Type * p_reg){
-  int i = ( (int)p_reg - (int)NRF_UARTE_regs ) / sizeof(NRF_UARTE_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)NRF_UARTE_regs ) / sizeof(NRF_UARTE_Type);
   return i;
 }
 
 void nrf_uart_task_trigger(NRF_UART_Type * p_reg, nrf_uart_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
 
   int i = uart_number_from_ptr(p_reg);
@@ -40,6 +42,7 @@ void nrf_uart_task_trigger(NRF_UART_Type * p_reg, nrf_uart_task_t task)
 
 void nrf_uart_int_enable(NRF_UART_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr(p_reg);
   p_reg->INTENSET = mask;
   nhw_UARTE_regw_sideeffects_INTENSET(i);
@@ -47,6 +50,7 @@ void nrf_uart_int_enable(NRF_UART_Type * p_reg, uint32_t mask)
 
 void nrf_uart_int_disable(NRF_UART_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr(p_reg);
   p_reg->INTENCLR = mask;
   nhw_UARTE_regw_sideeffects_INTENCLR(i);
@@ -54,6 +58,7 @@ void nrf_uart_int_disable(NRF_UART_Type * p_reg, uint32_t mask)
 
 void nrf_uart_event_clear(NRF_UART_Type * p_reg, nrf_uart_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   int i = uart_number_from_ptr(p_reg);
   nhw_UARTE_regw_sideeffects_EVENTS_all(i);
@@ -61,18 +66,21 @@ void nrf_uart_event_clear(NRF_UART_Type * p_reg, nrf_uart_event_t event)
 
 uint32_t nrf_uart_errorsrc_get_and_clear(NRF_UART_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr(p_reg);
   return nhw_UARTE_regr_sideeffects_ERRORSRC(i);
 }
 
 uint8_t nrf_uart_rxd_get(NRF_UART_Type const * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr((NRF_UART_Type *)p_reg);
   return nhw_UARTE_regr_sideeffects_RXD(i);
 }
 
 void nrf_uart_txd_set(NRF_UART_Type * p_reg, uint8_t txd)
 {
+  NHW_REG_PROF(p_reg);
   p_reg->TXD = txd;
   int i = uart_number_from_ptr(p_reg);
   nhw_UARTE_regw_sideeffects_TXD(i);
@@ -80,6 +88,7 @@ void nrf_uart_txd_set(NRF_UART_Type * p_reg, uint8_t txd)
 
 void nrf_uart_disable(NRF_UART_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr(p_reg);
   p_reg->ENABLE = UART_ENABLE_ENABLE_Disabled;
   nhw_UARTE_regw_sideeffects_ENABLE(i);
@@ -87,6 +96,7 @@ void nrf_uart_disable(NRF_UART_Type * p_reg)
 
 void nrf_uart_enable(NRF_UART_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr(p_reg);
   p_reg->ENABLE = UART_ENABLE_ENABLE_Enabled;
   nhw_UARTE_regw_sideeffects_ENABLE(i);
@@ -95,6 +105,7 @@ void nrf_uart_enable(NRF_UART_Type * p_reg)
 void nrf_uart_configure(NRF_UART_Type           * p_reg,
                         nrf_uart_config_t const * p_cfg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uart_number_from_ptr(p_reg);
   p_reg->CONFIG = (uint32_t)p_cfg->parity
 #if defined(UART_CONFIG_STOP_Msk)
@@ -135,6 +146,7 @@ void nrf_uart_subscribe_set(NRF_UART_Type * p_reg,
                              nrf_uart_task_t task,
                              uint8_t          channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_uart_subscribe_common(p_reg, task);
@@ -143,6 +155,7 @@ void nrf_uart_subscribe_set(NRF_UART_Type * p_reg,
 void nrf_uart_subscribe_clear(NRF_UART_Type * p_reg,
                                nrf_uart_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_uart_subscribe_common(p_reg, task);
 }
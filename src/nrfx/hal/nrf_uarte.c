@@ -10,14 +10,17 @@
 #include "hal/nrf_uarte.h"
 #include "bs_tracing.h"
 #include "NHW_UART.h"
+#include "NHW_dma_addr.h"
+#include "NHW_reg_profiler.h"
 
 static int uarte_number_from_ptr(NRF_UARTE_Type * p_reg){
-  int i = ( (int)p_reg - (int)NRF_UARTE_regs ) / sizeof(NRF_UARTE_Type);
+  int i = ( (intptr_t)p_reg - (intptr_t)NRF_UARTE_regs ) / sizeof(NRF_UARTE_Type);
   return i;
 }
 
 void nrf_uarte_task_trigger(NRF_UARTE_Type * p_reg, nrf_uarte_task_t task)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + task);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)task)) = 0x1UL;
 
   int i = uarte_number_from_ptr(p_reg);
@@ -50,6 +53,7 @@ void nrf_uarte_task_trigger(NRF_UARTE_Type * p_reg, nrf_uarte_task_t task)
 
 void nrf_uarte_int_enable(NRF_UARTE_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = uarte_number_from_ptr(p_reg);
   p_reg->INTENSET = mask;
   nhw_UARTE_regw_sideeffects_INTENSET(i);
@@ -57,6 +61,7 @@ void nrf_uarte_int_enable(NRF_UARTE_Type * p_reg, uint32_t mask)
 
 void nrf_uarte_int_disable(NRF_UARTE_Type * p_reg, uint32_t mask)
 {
+  NHW_REG_PROF(p_reg);
   int i = uarte_number_from_ptr(p_reg);
   p_reg->INTENCLR = mask;
   nhw_UARTE_regw_sideeffects_INTENCLR(i);
@@ -64,6 +69,7 @@ void nrf_uarte_int_disable(NRF_UARTE_Type * p_reg, uint32_t mask)
 
 void nrf_uarte_event_clear(NRF_UARTE_Type * p_reg, nrf_uarte_event_t event)
 {
+  NHW_REG_PROF((const uint8_t *)p_reg + event);
   *((volatile uint32_t *)((uint8_t *)p_reg + (uint32_t)event)) = 0x0UL;
   int i = uarte_number_from_ptr(p_reg);
   nhw_UARTE_regw_sideeffects_EVENTS_all(i);
@@ -71,12 +77,14 @@ void nrf_uarte_event_clear(NRF_UARTE_Type * p_reg, nrf_uarte_event_t event)
 
 uint32_t nrf_uarte_errorsrc_get_and_clear(NRF_UARTE_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uarte_number_from_ptr(p_reg);
   return nhw_UARTE_regr_sideeffects_ERRORSRC(i);
 }
 
 void nrf_uarte_enable(NRF_UARTE_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uarte_number_from_ptr(p_reg);
   p_reg->ENABLE = UARTE_ENABLE_ENABLE_Enabled;
   nhw_UARTE_regw_sideeffects_ENABLE(i);
@@ -84,6 +92,7 @@ void nrf_uarte_enable(NRF_UARTE_Type * p_reg)
 
 void nrf_uarte_disable(NRF_UARTE_Type * p_reg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uarte_number_from_ptr(p_reg);
   p_reg->ENABLE = UARTE_ENABLE_ENABLE_Disabled;
   nhw_UARTE_regw_sideeffects_ENABLE(i);
@@ -92,6 +101,7 @@ void nrf_uarte_disable(NRF_UARTE_Type * p_reg)
 void nrf_uarte_configure(NRF_UARTE_Type           * p_reg,
                          nrf_uarte_config_t const * p_cfg)
 {
+  NHW_REG_PROF(p_reg);
   int i = uarte_number_from_ptr(p_reg);
   p_reg->CONFIG = (uint32_t)p_cfg->parity
 #if defined(UARTE_CONFIG_STOP_Msk)
@@ -145,6 +155,7 @@ void nrf_uarte_subscribe_set(NRF_UARTE_Type * p_reg,
                              nrf_uarte_task_t task,
                              uint8_t          channel)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) =
             ((uint32_t)channel | NRF_SUBSCRIBE_PUBLISH_ENABLE);
     nrf_uarte_subscribe_common(p_reg, task);
@@ -153,7 +164,38 @@ void nrf_uarte_subscribe_set(NRF_UARTE_Type * p_reg,
 void nrf_uarte_subscribe_clear(NRF_UARTE_Type * p_reg,
                                nrf_uarte_task_t task)
 {
+    NHW_REG_PROF((const uint8_t *)p_reg + task);
     *((volatile uint32_t *) ((uint8_t *) p_reg + (uint32_t) task + 0x80uL)) = 0;
     nrf_uarte_subscribe_common(p_reg, task);
 }
 #endif /* defined(DPPI_PRESENT) */
+
+#if NHW_DMA_ADDR_TRANSLATION
+/* 64 bit hosts pointers do not fit in the DMA PTR registers, see NHW_dma_addr.h */
+
+void nrf_uarte_tx_buffer_set(NRF_UARTE_Type * p_reg,
+                             uint8_t const *  p_buffer,
+                             size_t           length)
+{
+#if !NHW_UARTE_54NAMING
+  p_reg->TXD.PTR    = nhw_dma_ptr_to_addr(p_buffer);
+  p_reg->TXD.MAXCNT = length;
+#else
+  p_reg->DMA.TX.PTR    = nhw_dma_ptr_to_addr(p_buffer);
+  p_reg->DMA.TX.MAXCNT = length;
+#endif
+}
+
+void nrf_uarte_rx_buffer_set(NRF_UARTE_Type * p_reg,
+                             uint8_t *        p_buffer,
+                             size_t           length)
+{
+#if !NHW_UARTE_54NAMING
+  p_reg->RXD.PTR    = nhw_dma_ptr_to_addr(p_buffer);
+  p_reg->RXD.MAXCNT = length;
+#else
+  p_reg->DMA.RX.PTR    = nhw_dma_ptr_to_addr(p_buffer);
+  p_reg->DMA.RX.MAXCNT = length;
+#endif
+}
+#endif /* NHW_DMA_ADDR_TRANSLATION */
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The integrator should ensure this header is in
+ * the include path before the real hal/nrf_nvmc.h
+ */
+
+#ifndef HAL_REPLACEMENTS_HAL_NRF_NVMC_H
+#define HAL_REPLACEMENTS_HAL_NRF_NVMC_H
+
+#include_next "hal/nrf_nvmc.h"
+
+/*
+ * Special API for the HW models, which programs a whole word aligned buffer
+ * in one go (like nrf_rramc_buffer_write() for the RRAMC).
+ * The NVMC must be in write mode, and ready, before calling it.
+ * As with nrf_nvmc_word_write(), the NVMC will be busy afterwards,
+ * for as long as it would have taken to program the buffer word by word.
+ *
+ * This call is experimental and may change at any point
+ */
+void nrf_nvmc_buffer_write(uint32_t address, void const * src, uint32_t num_bytes);
+
+#endif /* HAL_REPLACEMENTS_HAL_NRF_NVMC_H */
@@ -0,0 +1,56 @@
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Run the BLE connection benchmark: the 2.4GHz Phy, and two instances of the test image, one as
+central and one as peripheral, connected for 10 simulated seconds.
+Check both devices pass, and log how long (wall time) the run took, so the builds with and
+without the unity build and LTO variants can be compared.
+"""
+
+import logging
+import os
+import subprocess
+import time
+from pathlib import Path
+
+from twister_harness import DeviceAdapter
+
+logger = logging.getLogger(__name__)
+
+RUN_TIMEOUT = 600
+SIM_LENGTH_US = 30e6  # Only a limit, the devices end (and with them the Phy) before
+SUCCESS_STR = "PROJECT EXECUTION SUCCESSFUL"
+
+
+def test_ble_conn_benchmark_two_devices(device_object: DeviceAdapter, record_property):
+    exe = Path(device_object.device_config.build_dir) / "zephyr" / "zephyr.exe"
+    phy = Path(os.environ["BSIM_OUT_PATH"]) / "bin" / "bs_2G4_phy_v1"
+    sim_id = f"ble_conn_benchmark_{os.getpid()}"
+
+    cmds = [[str(phy), f"-s={sim_id}", "-D=2", f"-sim_length={SIM_LENGTH_US}"],
+            [str(exe), f"-s={sim_id}", "-d=0", "-central"],
+            [str(exe), f"-s={sim_id}", "-d=1", "-peripheral"]]
+
+    start = time.monotonic()
+    procs = [subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+             for cmd in cmds]
+    outputs = []
+    try:
+        for proc in procs:
+            outputs.append(proc.communicate(timeout=RUN_TIMEOUT)[0])
+    finally:
+        for proc in procs:
+            proc.kill()
+    wall_time = time.monotonic() - start
+
+    logger.info("Phy output:\n%s", outputs[0])
+    assert procs[0].returncode == 0, f"The Phy exited with {procs[0].returncode}"
+    for i, (proc, output) in enumerate(zip(procs[1:], outputs[1:])):
+        logger.info("Device %i output:\n%s", i, output)
+        assert proc.returncode == 0, f"Device {i} exited with {proc.returncode}"
+        assert SUCCESS_STR in output, f"Device {i} test failed"
+
+    logger.info("BLE connection benchmark took %.2f s (wall time)", wall_time)
+    record_property("wall_time_s", f"{wall_time:.2f}")
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * End to end benchmark of the HW models, to compare them with and without the unity build
+ * and LTO variants (see docs/README_HW_models.md).
+ *
+ * On its own (as run by twister), the device advertises for ADV_EVENTS events 20ms apart, and
+ * checks the controller reports all of them as sent. The twister report execution time of the
+ * testcase.yaml scenarios with and without the variants gives the speedup.
+ *
+ * With -central or -peripheral, it instead runs a BLE connection between 2 devices, in which the
+ * central pushes data to the peripheral with GATT writes without response for 10 simulated
+ * seconds (7.5ms connection interval, 2M PHY, 251 bytes PDUs). Both sides check the expected
+ * amount of data got thru. In twister, this is run by pytest/test_ble_conn_benchmark.py (the .conn
+ * scenarios), which logs the run wall time. To run it manually, build it with and without the
+ * variants, like:
+ *   west build -b nrf52_bsim -d build_ref <this folder>
+ *   west build -b nrf52_bsim -d build_opt <this folder> -- \
+ *              -DNRF_HW_MODELS_UNITY_BUILD=ON -DNRF_HW_MODELS_LTO=ON
+ * and run each under time, like:
+ *   time ( ${BSIM_OUT_PATH}/bin/bs_2G4_phy_v1 -s=ble_bench -D=2 -sim_length=15e6 & \
+ *          build_ref/zephyr/zephyr.exe -s=ble_bench -d=0 -central & \
+ *          build_ref/zephyr/zephyr.exe -s=ble_bench -d=1 -peripheral ; wait )
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/ztest.h>
+#include "bs_types.h"
+#include "bs_cmd_line.h"
+#include "bs_dynargs.h"
+#include "posix_native_task.h"
+
+#define BENCH_DURATION_MS 10000
+#define CONN_INTERVAL 6 /* In 1.25ms units */
+#define MIN_THROUGHPUT_KBPS 100 /* Sanity check, a connection at 7.5ms should do much more */
+#define ADV_INTERVAL 0x20 /* 20ms, in 0.625ms units */
+#define ADV_EVENTS 250
+
+static struct bt_uuid_128 bench_svc_uuid =
+    BT_UUID_INIT_128(BT_UUID_128_ENCODE(0x6e68775f, 0x6265, 0x6e63, 0x6800, 0x000000000001));
+static struct bt_uuid_128 bench_chrc_uuid =
+    BT_UUID_INIT_128(BT_UUID_128_ENCODE(0x6e68775f, 0x6265, 0x6e63, 0x6800, 0x000000000002));
+
+static bool is_central;
+static bool is_peripheral;
+
+static struct bt_conn *conn;
+static uint16_t chrc_handle;
+static size_t bytes_count;
+
+static K_SEM_DEFINE(connected_sem, 0, 1);
+static K_SEM_DEFINE(disconnected_sem, 0, 1);
+static K_SEM_DEFINE(mtu_sem, 0, 1);
+static K_SEM_DEFINE(discovered_sem, 0, 1);
+static K_SEM_DEFINE(adv_sent_sem, 0, 1);
+static uint8_t adv_num_sent;
+
+static void bench_register_cmdline(void) {
+  static bs_args_struct_t args[] = {
+    { .is_switch = true,
+      .option = "central",
+      .type = 'b',
+      .dest = (void *)&is_central,
+      .descript = "Run as the connection central (data sender)"
+    },
+    { .is_switch = true,
+      .option = "peripheral",
+      .type = 'b',
+      .dest = (void *)&is_peripheral,
+      .descript = "Run as the connection peripheral (data receiver)"
+    },
+    ARG_TABLE_ENDMARKER
+  };
+
+  bs_add_extra_dynargs(args);
+}
+
+NATIVE_TASK(bench_register_cmdline, PRE_BOOT_1, 100);
+
+static ssize_t bench_write(struct bt_conn *c, const struct bt_gatt_attr *attr,
+                           const void *buf, uint16_t len, uint16_t offset, uint8_t flags) {
+  ARG_UNUSED(c);
+  ARG_UNUSED(attr);
+  ARG_UNUSED(buf);
+  ARG_UNUSED(offset);
+  ARG_UNUSED(flags);
+
+  bytes_count += len;
+  return len;
+}
+
+BT_GATT_SERVICE_DEFINE(bench_svc,
+  BT_GATT_PRIMARY_SERVICE(&bench_svc_uuid),
+  BT_GATT_CHARACTERISTIC(&bench_chrc_uuid.uuid, BT_GATT_CHRC_WRITE_WITHOUT_RESP,
+                         BT_GATT_PERM_WRITE, NULL, bench_write, NULL),
+);
+
+static void connected(struct bt_conn *c, uint8_t err) {
+  if (err) {
+    TC_PRINT("Connection failed (%u)\n", err);
+    return;
+  }
+  if (conn == NULL) {
+    conn = bt_conn_ref(c);
+  }
+  k_sem_give(&connected_sem);
+}
+
+static void disconnected(struct bt_conn *c, uint8_t reason) {
+  ARG_UNUSED(reason);
+
+  if (c != conn) {
+    return;
+  }
+  bt_conn_unref(conn);
+  conn = NULL;
+  k_sem_give(&disconnected_sem);
+}
+
+BT_CONN_CB_DEFINE(conn_callbacks) = {
+  .connected = connected,
+  .disconnected = disconnected,
+};
+
+static bool ad_has_bench_svc(struct bt_data *data, void *user_data) {
+  bool *found = user_data;
+
+  if ((data->type == BT_DATA_UUID128_ALL) && (data->data_len == 16) &&
+      (memcmp(data->data, bench_svc_uuid.val, 16) == 0)) {
+    *found = true;
+    return false;
+  }
+  return true;
+}
+
+static void device_found(const bt_addr_le_t *addr, int8_t rssi, uint8_t type,
+                         struct net_buf_simple *ad) {
+  struct bt_le_conn_param param = BT_LE_CONN_PARAM_INIT(CONN_INTERVAL, CONN_INTERVAL,
+                                                         0, 400);
+  bool found = false;
+  int err;
+
+  ARG_UNUSED(rssi);
+
+  if (type != BT_GAP_ADV_TYPE_ADV_IND) {
+    return;
+  }
+  bt_data_parse(ad, ad_has_bench_svc, &found);
+  if (!found || bt_le_scan_stop()) {
+    return;
+  }
+
+  err = bt_conn_le_create(addr, BT_CONN_LE_CREATE_CONN, &param, &conn);
+  if (err) {
+    TC_PRINT("bt_conn_le_create failed (%d)\n", err);
+  }
+}
+
+static void mtu_exchanged(struct bt_conn *c, uint8_t err, struct bt_gatt_exchange_params *params) {
+  ARG_UNUSED(c);
+  ARG_UNUSED(params);
+
+  if (err) {
+    TC_PRINT("MTU exchange failed (%u)\n", err);
+  }
+  k_sem_give(&mtu_sem);
+}
+
+static uint8_t chrc_discovered(struct bt_conn *c, const struct bt_gatt_attr *attr,
+                               struct bt_gatt_discover_params *params) {
+  ARG_UNUSED(c);
+
+  if (attr != NULL) {
+    chrc_handle = ((struct bt_gatt_chrc *)attr->user_data)->value_handle;
+  }
+  (void)memset(params, 0, sizeof(*params));
+  k_sem_give(&discovered_sem);
+  return BT_GATT_ITER_STOP;
+}
+
+static void run_central(void) {
+  static struct bt_gatt_exchange_params mtu_params = {.func = mtu_exchanged};
+  static struct bt_gatt_discover_params discover_params;
+  static uint8_t data[CONFIG_BT_L2CAP_TX_MTU - 3];
+  int64_t start, elapsed;
+  int err;
+
+  err = bt_le_scan_start(BT_LE_SCAN_PASSIVE, device_found);
+  zassert_equal(err, 0, "Scanning failed to start (%d)", err);
+  zassert_equal(k_sem_take(&connected_sem, K_SECONDS(5)), 0, "Not connected");
+
+  err = bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M);
+  zassert_equal(err, 0, "PHY update failed (%d)", err);
+  err = bt_gatt_exchange_mtu(conn, &mtu_params);
+  zassert_equal(err, 0, "MTU exchange failed (%d)", err);
+  k_sem_take(&mtu_sem, K_FOREVER);
+
+  discover_params.uuid = &bench_chrc_uuid.uuid;
+  discover_params.func = chrc_discovered;
+  discover_params.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+  discover_params.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+  discover_params.type = BT_GATT_DISCOVER_CHARACTERISTIC;
+  err = bt_gatt_discover(conn, &discover_params);
+  zassert_equal(err, 0, "Discovery failed (%d)", err);
+  k_sem_take(&discovered_sem, K_FOREVER);
+  zassert_not_equal(chrc_handle, 0, "Benchmark characteristic not found");
+
+  start = k_uptime_get();
+  do {
+    err = bt_gatt_write_without_response(conn, chrc_handle, data,
+                                         bt_gatt_get_mtu(conn) - 3, false);
+    if (err == 0) {
+      bytes_count += bt_gatt_get_mtu(conn) - 3;
+    } else {
+      k_sleep(K_MSEC(1));
+    }
+    elapsed = k_uptime_get() - start;
+  } while (elapsed < BENCH_DURATION_MS);
+
+  err = bt_conn_disconnect(conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+  zassert_equal(err, 0, "Disconnection failed (%d)", err);
+  k_sem_take(&disconnected_sem, K_FOREVER);
+
+  TC_PRINT("Sent %zu bytes in %lli ms (simulated), %lli kbps\n",
+           bytes_count, elapsed, (int64_t)bytes_count * 8 / elapsed);
+  zassert_true(bytes_count * 8 / elapsed >= MIN_THROUGHPUT_KBPS, "Throughput too low");
+}
+
+static void run_peripheral(void) {
+  const struct bt_data ad[] = {
+    BT_DATA_BYTES(BT_DATA_FLAGS, (BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR)),
+    BT_DATA(BT_DATA_UUID128_ALL, bench_svc_uuid.val, 16),
+  };
+  int err;
+
+  err = bt_le_adv_start(BT_LE_ADV_CONN_ONE_TIME, ad, ARRAY_SIZE(ad), NULL, 0);
+  zassert_equal(err, 0, "Advertising failed to start (%d)", err);
+  zassert_equal(k_sem_take(&connected_sem, K_SECONDS(5)), 0, "Not connected");
+  zassert_equal(k_sem_take(&disconnected_sem, K_SECONDS(BENCH_DURATION_MS / 1000 + 5)), 0,
+                "Not disconnected");
+
+  TC_PRINT("Received %zu bytes\n", bytes_count);
+  zassert_true(bytes_count * 8 / BENCH_DURATION_MS >= MIN_THROUGHPUT_KBPS,
+               "Throughput too low");
+}
+
+static void adv_sent(struct bt_le_ext_adv *adv, struct bt_le_ext_adv_sent_info *info) {
+  ARG_UNUSED(adv);
+
+  adv_num_sent = info->num_sent;
+  k_sem_give(&adv_sent_sem);
+}
+
+ZTEST(ble_conn_benchmark, test_advertise)
+{
+  static const struct bt_le_ext_adv_cb adv_cb = {.sent = adv_sent};
+  const struct bt_le_adv_param param =
+      BT_LE_ADV_PARAM_INIT(BT_LE_ADV_OPT_NONE, ADV_INTERVAL, ADV_INTERVAL, NULL);
+  const struct bt_data ad[] = {
+    BT_DATA_BYTES(BT_DATA_FLAGS, BT_LE_AD_NO_BREDR),
+    BT_DATA(BT_DATA_UUID128_ALL, bench_svc_uuid.val, 16),
+  };
+  struct bt_le_ext_adv *adv;
+  int err;
+
+  if (is_central || is_peripheral) {
+    ztest_test_skip();
+  }
+
+  err = bt_enable(NULL);
+  zassert_equal(err, 0, "Bluetooth init failed (%d)", err);
+
+  err = bt_le_ext_adv_create(&param, &adv_cb, &adv);
+  zassert_equal(err, 0, "Advertising set creation failed (%d)", err);
+  err = bt_le_ext_adv_set_data(adv, ad, ARRAY_SIZE(ad), NULL, 0);
+  zassert_equal(err, 0, "Setting the advertising data failed (%d)", err);
+  err = bt_le_ext_adv_start(adv, BT_LE_EXT_ADV_START_PARAM(0, ADV_EVENTS));
+  zassert_equal(err, 0, "Advertising failed to start (%d)", err);
+
+  /* Each event is up to 10ms (advDelay) later than the interval */
+  zassert_equal(k_sem_take(&adv_sent_sem, K_MSEC(ADV_EVENTS * 30 + 1000)), 0,
+                "Advertising did not finish");
+  zassert_equal(adv_num_sent, ADV_EVENTS, "Only %u advertising events sent", adv_num_sent);
+
+  (void)bt_le_ext_adv_delete(adv);
+}
+
+ZTEST(ble_conn_benchmark, test_push_data)
+{
+  int err;
+
+  if (!is_central && !is_peripheral) {
+    ztest_test_skip();
+  }
+
+  err = bt_enable(NULL);
+  zassert_equal(err, 0, "Bluetooth init failed (%d)", err);
+
+  if (is_central) {
+    run_central();
+  } else {
+    run_peripheral();
+  }
+}
+
+ZTEST_SUITE(ble_conn_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,53 @@
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Run two instances of the test image connected thru a GPIO bus (each one with its own GPIO
+configuration file), and check both pass.
+"""
+
+import logging
+import os
+import subprocess
+from pathlib import Path
+
+from twister_harness import DeviceAdapter
+
+logger = logging.getLogger(__name__)
+
+LATENCY = 3  # Must match LATENCY in src/test_gpio_bus.c
+RUN_TIMEOUT = 120
+SUCCESS_STR = "PROJECT EXECUTION SUCCESSFUL"
+
+
+def test_gpio_bus_two_devices(device_object: DeviceAdapter, tmp_path: Path):
+    exe = Path(device_object.device_config.build_dir) / "zephyr" / "zephyr.exe"
+    bus_path = f"/dev/shm/gpio_bus_test_{os.getpid()}"
+    sim_id = f"gpio_bus_test_{os.getpid()}"
+
+    cmds = []
+    for side in (0, 1):
+        conf_file = tmp_path / f"gpio_conf_{side}.txt"
+        conf_file.write_text(f"bus 0 {bus_path} {side} {LATENCY}\n"
+                             "bus_out 0 0.3\n"
+                             "bus_out 0 0.5\n"
+                             "bus_in 0 0.3 0.4\n"
+                             "bus_in 0 0.5 0.6\n")
+        cmds.append([str(exe), "-nosim", f"-s={sim_id}", f"-d={side}",
+                     f"-gpio_conf_file={conf_file}"])
+
+    procs = [subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+             for cmd in cmds]
+    outputs = []
+    try:
+        for proc in procs:
+            outputs.append(proc.communicate(timeout=RUN_TIMEOUT)[0])
+    finally:
+        for proc in procs:
+            proc.kill()
+
+    for i, (proc, output) in enumerate(zip(procs, outputs)):
+        logger.info("Device %i output:\n%s", i, output)
+        assert proc.returncode == 0, f"Device {i} exited with {proc.returncode}"
+        assert SUCCESS_STR in output, f"Device {i} test failed"
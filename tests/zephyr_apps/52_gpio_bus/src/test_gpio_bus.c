@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Two devices, running this same test, connected thru a GPIO bus with a latency of LATENCY us:
+ * Each device outputs a pattern in P0.3 and P0.5 (which sometimes changes one pin, and sometimes
+ * both at the same time), and the bus wires those to the other device P0.4 and P0.6 respectively.
+ * Check each device sees exactly the other device edges, LATENCY us after they happened,
+ * and that the input levels follow the other device outputs.
+ *
+ * As both devices run the same code from the same boot time, the other device output edges
+ * happen at the same time as our own, which we record to know when to expect them.
+ *
+ * In twister, this is run by pytest/test_gpio_bus.py, which generates the GPIO configuration
+ * files. To run it manually, write for each device a configuration file like:
+ *   bus 0 /dev/shm/gpio_bus_test <side: 0 in one device, 1 in the other> 3
+ *   bus_out 0 0.3
+ *   bus_out 0 0.5
+ *   bus_in 0 0.3 0.4
+ *   bus_in 0 0.5 0.6
+ * and start both together with -nosim -gpio_conf_file=<that file>
+ */
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <hal/nrf_gpio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include "bs_types.h"
+#include "nsi_hw_scheduler.h"
+#include "NRF_GPIO.h"
+
+#define LATENCY 3 /* Must match the bus configuration */
+#define N_STEPS 1000
+#define MAX_EDGES (2 * N_STEPS)
+
+#define OUT_A 3
+#define OUT_B 5
+#define IN_A 4 /* Driven by the other device OUT_A */
+#define IN_B 6 /* Driven by the other device OUT_B */
+
+struct edge {
+  bs_time_t time;
+  unsigned int pin;
+  bool value;
+};
+
+static struct edge out_edges[MAX_EDGES];
+static struct edge in_edges[MAX_EDGES];
+static int n_out_edges, n_in_edges;
+
+static void record_edge(struct edge *edges, int *n, unsigned int port, unsigned int pin,
+                        bool value) {
+  if ((port != 0) || (*n >= MAX_EDGES)) {
+    return;
+  }
+  edges[*n].time = nsi_hws_get_time();
+  edges[*n].pin = pin;
+  edges[*n].value = value;
+  (*n)++;
+}
+
+static void out_cb(unsigned int port, unsigned int n, bool value) {
+  record_edge(out_edges, &n_out_edges, port, n, value);
+}
+
+static void in_cb(unsigned int port, unsigned int n, bool value) {
+  record_edge(in_edges, &n_in_edges, port, n, value);
+}
+
+static unsigned int out_to_in(unsigned int pin) {
+  return pin == OUT_A ? IN_A : IN_B;
+}
+
+ZTEST(gpio_bus, test_edges_across_bus)
+{
+  nrf_gpio_cfg_output(OUT_A);
+  nrf_gpio_cfg_output(OUT_B);
+  nrf_gpio_cfg_input(IN_A, NRF_GPIO_PIN_NOPULL);
+  nrf_gpio_cfg_input(IN_B, NRF_GPIO_PIN_NOPULL);
+
+  nrf_gpio_test_register_out_callback(out_cb);
+  nrf_gpio_test_register_in_callback(in_cb);
+
+  for (int i = 1; i <= N_STEPS; i++) {
+    /* OUT_A changes in every step, and OUT_B together with it in every other one */
+    nrf_gpio_port_out_write(NRF_P0, (nrf_gpio_port_out_read(NRF_P0) &
+                                     ~(BIT(OUT_A) | BIT(OUT_B))) |
+                                    ((i & 1) << OUT_A) | (((i >> 1) & 1) << OUT_B));
+    /* Vary the time between changes, including some below the bus latency */
+    k_busy_wait(1 + (i % 7) * 2);
+  }
+  k_busy_wait(10 * LATENCY);
+
+  nrf_gpio_test_register_out_callback(NULL);
+  nrf_gpio_test_register_in_callback(NULL);
+
+  zassert_equal(n_in_edges, n_out_edges, "%i input edges seen, expected %i",
+                n_in_edges, n_out_edges);
+
+  for (int i = 0; i < n_out_edges; i++) {
+    struct edge *o = &out_edges[i];
+    struct edge *in = &in_edges[i];
+
+    zassert_equal(in->pin, out_to_in(o->pin), "Edge %i in pin %u, expected in %u",
+                  i, in->pin, out_to_in(o->pin));
+    zassert_equal(in->value, o->value, "Edge %i with wrong level", i);
+    zassert_equal(in->time, o->time + LATENCY, "Edge %i seen at %"PRIu64", expected at %"PRIu64,
+                  i, in->time, o->time + LATENCY);
+  }
+
+  zassert_equal(nrf_gpio_pin_read(IN_A), nrf_gpio_pin_out_read(OUT_A), "Wrong final level");
+  zassert_equal(nrf_gpio_pin_read(IN_B), nrf_gpio_pin_out_read(OUT_B), "Wrong final level");
+}
+
+ZTEST_SUITE(gpio_bus, NULL, NULL, NULL, NULL, NULL);
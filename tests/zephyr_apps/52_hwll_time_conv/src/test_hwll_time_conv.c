@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Property test of the device<->phy time conversions of NRF_HWLowL.c (done in fixed point),
+ * against the trivial XO model long double conversion functions, for a set of clock drifts
+ * and offsets, over the whole bs_time_t range.
+ *
+ * The long double path multiplies by 1e-6 in double precision, so its result is only
+ * exact up to a relative error of ~2^-52. Therefore:
+ *  * Both must always be within 1 + that error of each other.
+ *  * For times below 2^50 us, both must be equal, unless the exact result is so close
+ *    to a rounding tie that the long double one can not tell.
+ * Also checked are that, without drift and with an integer offset, the conversions are exact,
+ * and that a round trip gives back the same time +-1us.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include "bs_types.h"
+#include "NRF_HWLowL.h"
+#include "xo_if.h"
+#include "trivial_xo.h"
+
+#define N_SAMPLES 200000
+
+static const double drifts[] = {0, 20e-6, -20e-6, 300e-6, -300e-6, 1.234567891e-5, -9.87654321e-3};
+static const double offsets[] = {0, 2.5, -1000, 1234.567, 123456789.123, 1e9 + 0.25};
+
+static uint64_t rnd_state;
+
+static uint64_t rnd(void) {
+  rnd_state ^= rnd_state << 13;
+  rnd_state ^= rnd_state >> 7;
+  rnd_state ^= rnd_state << 17;
+  return rnd_state;
+}
+
+/* Times spread over the whole range: the first ones around each power of 2, then random */
+static bs_time_t sample_time(int i) {
+  if (i < 128) {
+    return ((bs_time_t)1 << (i / 2)) - (i & 1);
+  }
+  return rnd() >> (rnd() % 64);
+}
+
+static void check_vs_long_double(bs_time_t t, bool to_phy) {
+  long double x, tol, frac, diff;
+  bs_time_t ref, fixed;
+
+  if (to_phy) {
+    x = 1e6 * phy_time_from_dev(((long double)t) * 1e-6);
+    fixed = hwll_phy_time_from_dev(t);
+  } else {
+    x = 1e6 * dev_time_from_phy(((long double)t) * 1e-6);
+    fixed = hwll_dev_time_from_phy(t);
+  }
+  if ((x < 0) || (x + 0.5 >= 0x1p64L)) {
+    return; /* Out of the bs_time_t range */
+  }
+  ref = (bs_time_t)(x + 0.5);
+  if (fixed == ref) {
+    return;
+  }
+
+  tol = x * 0x1p-51L + 1e-9L;
+  frac = x - (long double)(uint64_t)x;
+  diff = fixed > ref ? (long double)(fixed - ref) : (long double)(ref - fixed);
+  zassert_true(diff <= 1 + tol, "%s(%llu) = %llu, long double path gives %llu",
+               to_phy ? "phy_from_dev" : "dev_from_phy", t, fixed, ref);
+  if (x < 0x1p50L) {
+    zassert_true((frac - 0.5L <= tol) && (0.5L - frac <= tol),
+                 "%s(%llu) = %llu, long double path gives %llu",
+                 to_phy ? "phy_from_dev" : "dev_from_phy", t, fixed, ref);
+  }
+}
+
+static void after_each(void *fixture) {
+  ARG_UNUSED(fixture);
+
+  trivial_xo_set_clock_drift(0);
+  xo_model_set_toffset(0);
+}
+
+ZTEST(hwll_time_conv, test_vs_long_double)
+{
+  rnd_state = 88172645463325252ULL;
+
+  for (int d = 0; d < ARRAY_SIZE(drifts); d++) {
+    for (int o = 0; o < ARRAY_SIZE(offsets); o++) {
+      trivial_xo_set_clock_drift(drifts[d]);
+      xo_model_set_toffset(offsets[o]);
+      for (int i = 0; i < N_SAMPLES; i++) {
+        bs_time_t t = sample_time(i);
+
+        if (t == TIME_NEVER) {
+          continue;
+        }
+        check_vs_long_double(t, true);
+        check_vs_long_double(t, false);
+      }
+    }
+  }
+}
+
+ZTEST(hwll_time_conv, test_exact_without_drift)
+{
+  rnd_state = 0x9E3779B97F4A7C15ULL;
+  trivial_xo_set_clock_drift(0);
+  xo_model_set_toffset(1000);
+
+  for (int i = 0; i < N_SAMPLES; i++) {
+    bs_time_t t = sample_time(i) >> 1;
+
+    zassert_equal(hwll_phy_time_from_dev(t), t + 1000, "t = %llu", t);
+    zassert_equal(hwll_dev_time_from_phy(t + 1000), t, "t = %llu", t);
+  }
+}
+
+ZTEST(hwll_time_conv, test_round_trip)
+{
+  rnd_state = 0xD1B54A32D192ED03ULL;
+  trivial_xo_set_clock_drift(-37.5e-6);
+  xo_model_set_toffset(55.25);
+
+  for (int i = 0; i < N_SAMPLES; i++) {
+    bs_time_t t = sample_time(i) >> 2;
+    bs_time_t back = hwll_dev_time_from_phy(hwll_phy_time_from_dev(t));
+
+    zassert_true((back + 1 >= t) && (back <= t + 1), "t = %llu, back = %llu", t, back);
+  }
+}
+
+ZTEST(hwll_time_conv, test_never)
+{
+  trivial_xo_set_clock_drift(20e-6);
+
+  zassert_equal(hwll_phy_time_from_dev(TIME_NEVER), TIME_NEVER);
+  zassert_equal(hwll_dev_time_from_phy(TIME_NEVER), TIME_NEVER);
+}
+
+ZTEST_SUITE(hwll_time_conv, NULL, NULL, NULL, after_each, NULL);
@@ -0,0 +1,61 @@
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Run two instances of the test image, with their UART1s connected to each other thru the FIFO
+backend, once with each FIFO protocol version.
+Check both devices receive all the data correctly, and log how long (wall time) each run took,
+so the protocol versions can be compared.
+"""
+
+import logging
+import subprocess
+import time
+from pathlib import Path
+
+import pytest
+from twister_harness import DeviceAdapter
+
+logger = logging.getLogger(__name__)
+
+RUN_TIMEOUT = 300
+SUCCESS_STR = "PROJECT EXECUTION SUCCESSFUL"
+
+
+@pytest.mark.parametrize("protocol", [1, 2])
+def test_uart_fifob_two_devices(device_object: DeviceAdapter, tmp_path: Path, protocol: int):
+    exe = Path(device_object.device_config.build_dir) / "zephyr" / "zephyr.exe"
+    fifo_a = tmp_path / "uf_a"
+    fifo_b = tmp_path / "uf_b"
+    sim_id = f"uart_fifob_tp_{protocol}_{tmp_path.name}"
+
+    cmds = [
+        [str(exe), "-nosim", f"-s={sim_id}", "-d=0",
+         f"-uart1_fifob_txfile={fifo_a}", f"-uart1_fifob_rxfile={fifo_b}"],
+        [str(exe), "-nosim", f"-s={sim_id}", "-d=1",
+         f"-uart1_fifob_txfile={fifo_b}", f"-uart1_fifob_rxfile={fifo_a}"],
+    ]
+    for cmd in cmds:
+        # Each device finishes at a slightly different time, let the other one complete its test
+        cmd += [f"-uart_fifob_protocol={protocol}", "-uart_fifob_no_terminate"]
+
+    start = time.monotonic()
+    procs = [subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+             for cmd in cmds]
+    outputs = []
+    try:
+        for proc in procs:
+            outputs.append(proc.communicate(timeout=RUN_TIMEOUT)[0])
+    finally:
+        for proc in procs:
+            proc.kill()
+    wall_time = time.monotonic() - start
+
+    for i, (proc, output) in enumerate(zip(procs, outputs)):
+        logger.info("Device %i output:\n%s", i, output)
+        assert proc.returncode == 0, f"Device {i} exited with {proc.returncode}"
+        assert SUCCESS_STR in output, f"Device {i} test failed"
+
+    logger.info("FIFO protocol v%i: 2 x 1MiB transferred in %.2f s (wall time)",
+                protocol, wall_time)
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Transfer 1MiB at 1Mbaud thru UART1, and check all the data is received, and received correctly.
+ *
+ * This is meant to be run as two devices with their UART1s connected to each other thru the FIFO
+ * backend, both running this same test, so it also works as a benchmark of the FIFO backend.
+ * In twister, pytest/test_uart_fifob_throughput.py does so once with each FIFO protocol version,
+ * and logs how long each run took. To run it manually:
+ *   ./zephyr.exe -nosim -uart1_fifob_txfile=/tmp/uf_a -uart1_fifob_rxfile=/tmp/uf_b \
+ *                -uart_fifob_protocol=1 -uart_fifob_no_terminate &
+ *   time ./zephyr.exe -nosim -uart1_fifob_txfile=/tmp/uf_b -uart1_fifob_rxfile=/tmp/uf_a \
+ *                -uart_fifob_protocol=1 -uart_fifob_no_terminate
+ * It can also be run on its own with UART1 in loopback (-uart1_loopback).
+ */
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/ztest.h>
+
+#define TRANSFER_SIZE (1024 * 1024)
+#define TX_CHUNK_SIZE 1024
+#define RX_BUF_SIZE 1024
+
+static const struct device *const uart_dev = DEVICE_DT_GET(DT_NODELABEL(uart1));
+
+static uint8_t tx_buf[TX_CHUNK_SIZE];
+static uint8_t rx_bufs[2][RX_BUF_SIZE];
+static int next_rx_buf;
+static size_t rx_count;
+static size_t rx_errors;
+
+static K_SEM_DEFINE(tx_done_sem, 0, 1);
+static K_SEM_DEFINE(rx_done_sem, 0, 1);
+
+static uint8_t pattern(size_t i) {
+  return (uint8_t)(i * 7 + (i >> 8));
+}
+
+static void uart_cb(const struct device *dev, struct uart_event *evt, void *user_data) {
+  ARG_UNUSED(user_data);
+
+  switch (evt->type) {
+  case UART_TX_DONE:
+    k_sem_give(&tx_done_sem);
+    break;
+  case UART_RX_RDY:
+    for (size_t i = 0; i < evt->data.rx.len; i++) {
+      if (evt->data.rx.buf[evt->data.rx.offset + i] != pattern(rx_count + i)) {
+        rx_errors++;
+      }
+    }
+    rx_count += evt->data.rx.len;
+    if (rx_count >= TRANSFER_SIZE) {
+      k_sem_give(&rx_done_sem);
+    }
+    break;
+  case UART_RX_BUF_REQUEST:
+    uart_rx_buf_rsp(dev, rx_bufs[next_rx_buf], RX_BUF_SIZE);
+    next_rx_buf ^= 1;
+    break;
+  default:
+    break;
+  }
+}
+
+ZTEST(uart_fifob_throughput, test_transfer_1MiB)
+{
+  int ret;
+  int64_t start;
+
+  zassert_true(device_is_ready(uart_dev), "UART device not ready");
+
+  ret = uart_callback_set(uart_dev, uart_cb, NULL);
+  zassert_equal(ret, 0, "uart_callback_set failed (%d)", ret);
+
+  next_rx_buf = 1;
+  ret = uart_rx_enable(uart_dev, rx_bufs[0], RX_BUF_SIZE, 100);
+  zassert_equal(ret, 0, "uart_rx_enable failed (%d)", ret);
+
+  start = k_uptime_get();
+
+  for (size_t offset = 0; offset < TRANSFER_SIZE; offset += TX_CHUNK_SIZE) {
+    for (size_t i = 0; i < TX_CHUNK_SIZE; i++) {
+      tx_buf[i] = pattern(offset + i);
+    }
+    ret = uart_tx(uart_dev, tx_buf, TX_CHUNK_SIZE, SYS_FOREVER_US);
+    zassert_equal(ret, 0, "uart_tx failed (%d)", ret);
+    k_sem_take(&tx_done_sem, K_FOREVER);
+  }
+
+  ret = k_sem_take(&rx_done_sem, K_SECONDS(5));
+  zassert_equal(ret, 0, "Only %zu bytes received", rx_count);
+
+  /* Nothing else should arrive */
+  k_sleep(K_MSEC(10));
+  (void)uart_rx_disable(uart_dev);
+
+  zassert_equal(rx_count, TRANSFER_SIZE, "%zu bytes received, expected %d",
+                rx_count, TRANSFER_SIZE);
+  zassert_equal(rx_errors, 0, "%zu bytes received corrupted", rx_errors);
+
+  TC_PRINT("Transferred %i bytes in %lli ms (simulated)\n", TRANSFER_SIZE, k_uptime_get() - start);
+}
+
+ZTEST_SUITE(uart_fifob_throughput, NULL, NULL, NULL, NULL, NULL);
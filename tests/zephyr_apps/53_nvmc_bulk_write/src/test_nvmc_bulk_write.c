@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Program 1MiB of flash thru the NVMC HAL, word by word and with the bulk nrf_nvmc_buffer_write(),
+ * and check both give the same result.
+ *
+ * This doubles as a benchmark of both paths. Run each test separately under time, like:
+ *   time ./zephyr.exe -test=nvmc_bulk_write::test_program_1MiB_word_by_word
+ *   time ./zephyr.exe -test=nvmc_bulk_write::test_program_1MiB_bulk
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <nrf.h>
+#include <hal/nrf_nvmc.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include "NHW_NVMC.h"
+
+#define FLASH_START 0
+#define PROGRAM_SIZE (1024*1024)
+#define CHUNK_SIZE 4096
+
+static uint8_t pattern[CHUNK_SIZE];
+static uint8_t readback[CHUNK_SIZE];
+
+static void wait_ready(void) {
+  while (!nrf_nvmc_ready_check(NRF_NVMC)) {
+    k_busy_wait(1);
+  }
+}
+
+static void erase_all(void) {
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_ERASE);
+  nrf_nvmc_erase_all_start(NRF_NVMC);
+  wait_ready();
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_READONLY);
+}
+
+static void fill_pattern(uint32_t chunk) {
+  for (int i = 0; i < CHUNK_SIZE; i++) {
+    pattern[i] = (uint8_t)(i * 7 + chunk);
+  }
+}
+
+static void check_programmed(void) {
+  for (uint32_t off = 0; off < PROGRAM_SIZE; off += CHUNK_SIZE) {
+    fill_pattern(off / CHUNK_SIZE);
+    nrf_nvmc_buffer_read(readback, FLASH_START + off, CHUNK_SIZE);
+    zassert_mem_equal(readback, pattern, CHUNK_SIZE, "Flash content mismatch at offset %u", off);
+  }
+}
+
+static void before_each(void *fixture) {
+  (void)fixture;
+  erase_all();
+}
+
+ZTEST(nvmc_bulk_write, test_program_1MiB_word_by_word)
+{
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_WRITE);
+  for (uint32_t off = 0; off < PROGRAM_SIZE; off += CHUNK_SIZE) {
+    fill_pattern(off / CHUNK_SIZE);
+    for (int i = 0; i < CHUNK_SIZE; i += 4) {
+      uint32_t word;
+      memcpy(&word, &pattern[i], sizeof(word));
+      wait_ready();
+      nrf_nvmc_word_write(FLASH_START + off + i, word);
+    }
+  }
+  wait_ready();
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_READONLY);
+
+  check_programmed();
+}
+
+ZTEST(nvmc_bulk_write, test_program_1MiB_bulk)
+{
+  uint64_t start, duration;
+
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_WRITE);
+  start = k_ticks_to_us_floor64(k_uptime_ticks());
+  for (uint32_t off = 0; off < PROGRAM_SIZE; off += CHUNK_SIZE) {
+    fill_pattern(off / CHUNK_SIZE);
+    wait_ready();
+    nrf_nvmc_buffer_write(FLASH_START + off, pattern, CHUNK_SIZE);
+  }
+  wait_ready();
+  duration = k_ticks_to_us_floor64(k_uptime_ticks()) - start;
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_READONLY);
+
+  /* The modeled programming time is the same as if it was programmed word by word */
+  zassert_true(duration >= (uint64_t)PROGRAM_SIZE / 4 * NHW_NVMC_FLASH_T_WRITE,
+               "Bulk programming was too fast (%llu us)", duration);
+
+  check_programmed();
+}
+
+ZTEST(nvmc_bulk_write, test_bulk_write_only_clears_bits)
+{
+  uint32_t words[2] = {0xF0F0F0F0, 0x0000FFFF};
+  uint32_t words2[2] = {0xFF00FF00, 0xFFFFFFFF};
+
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_WRITE);
+  nrf_nvmc_buffer_write(FLASH_START, words, sizeof(words));
+  wait_ready();
+  nrf_nvmc_buffer_write(FLASH_START, words2, sizeof(words2));
+  wait_ready();
+  nrf_nvmc_mode_set(NRF_NVMC, NRF_NVMC_MODE_READONLY);
+
+  zassert_equal(nrf_nvmc_word_read(FLASH_START), 0xF000F000);
+  zassert_equal(nrf_nvmc_word_read(FLASH_START + 4), 0x0000FFFF);
+}
+
+ZTEST_SUITE(nvmc_bulk_write, NULL, NULL, before_each, NULL, NULL);
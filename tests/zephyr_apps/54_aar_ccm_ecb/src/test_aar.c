@@ -12,8 +12,148 @@
 #include <zephyr/ztest.h>
 #include <common.h>
 
-//ZTEST(nrf_aar_tests, aar_test1)
-//}
+#define AAR NRF_AAR00
+
+#define AAR_ATTR_HASH 11
+#define AAR_ATTR_PRAND 12
+#define AAR_ATTR_IRK 13
+#define AAR_ATTR_OTHER 14
+
+/*
+ * Sample data from the Bluetooth Core spec (Vol 3, Part H, ah function):
+ *   IRK = ec0234a357c8ad05341010a60a397d9b, prand = 708194 => hash = 0dfbaa
+ * The IRKs are given big endian, and the hash and prand little endian
+ */
+static uint8_t good_irk[16] = {0xec, 0x02, 0x34, 0xa3, 0x57, 0xc8, 0xad, 0x05,
+                               0x34, 0x10, 0x10, 0xa6, 0x0a, 0x39, 0x7d, 0x9b};
+static uint8_t bad_irk[16] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+                              0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10};
+static uint8_t hash[3] = {0xaa, 0xfb, 0x0d};
+static uint8_t prand[3] = {0x94, 0x81, 0x70};
+
+static uint16_t out_idx[8];
+
+struct aar_result {
+  bool resolved;
+  bool error;
+  uint32_t errorstatus;
+  uint32_t amount;
+};
+
+static void run_aar(job_t *in_jobs, struct aar_result *res)
+{
+  job_t out_jobs[] = {
+    {(uint8_t *)out_idx, sizeof(out_idx), 0},
+    {NULL, 0, 0},
+  };
+
+  memset(out_idx, 0xFF, sizeof(out_idx));
+  nrf_aar_enable(AAR);
+  AAR->MAXRESOLVED = 8;
+  nrf_aar_in_ptr_set(AAR, (nrf_vdma_job_t const *)in_jobs);
+  nrf_aar_out_ptr_set(AAR, (nrf_vdma_job_t const *)out_jobs);
+
+  nrf_aar_task_trigger(AAR, NRF_AAR_TASK_START);
+
+  while (!nrf_aar_event_check(AAR, NRF_AAR_EVENT_END)
+         && !nrf_aar_event_check(AAR, NRF_AAR_EVENT_ERROR)) {
+    k_busy_wait(1);
+  }
+
+  res->resolved = nrf_aar_event_check(AAR, NRF_AAR_EVENT_RESOLVED);
+  res->error = nrf_aar_event_check(AAR, NRF_AAR_EVENT_ERROR);
+  res->errorstatus = AAR->ERRORSTATUS;
+  res->amount = AAR->OUT.AMOUNT;
+
+  nrf_aar_disable(AAR);
+}
+
+/* The IRK list ends exactly after a matching IRK (-2 end of the IRKs batch read) */
+ZTEST(nrf_aar_tests, test_list_end_on_match)
+{
+  job_t in_jobs[] = {
+    {hash, 3, AAR_ATTR_HASH},
+    {prand, 3, AAR_ATTR_PRAND},
+    {bad_irk, 16, AAR_ATTR_IRK},
+    {good_irk, 16, AAR_ATTR_IRK},
+    {NULL, 0, 0},
+  };
+  struct aar_result res;
+
+  run_aar(in_jobs, &res);
+
+  zassert_false(res.error, "Unexpected error (ERRORSTATUS = %u)", res.errorstatus);
+  zassert_true(res.resolved, "Address not resolved");
+  zassert_equal(res.amount, 2, "OUT.AMOUNT = %u", res.amount);
+  zassert_equal(out_idx[0], 1, "Resolved with IRK %u", out_idx[0]);
+}
+
+/* The IRK list ends without any match (-2 end of the IRKs batch read) */
+ZTEST(nrf_aar_tests, test_list_end_no_match)
+{
+  job_t in_jobs[] = {
+    {hash, 3, AAR_ATTR_HASH},
+    {prand, 3, AAR_ATTR_PRAND},
+    {bad_irk, 16, AAR_ATTR_IRK},
+    {bad_irk, 16, AAR_ATTR_IRK},
+    {NULL, 0, 0},
+  };
+  struct aar_result res;
+
+  run_aar(in_jobs, &res);
+
+  zassert_false(res.error, "Unexpected error (ERRORSTATUS = %u)", res.errorstatus);
+  zassert_false(res.resolved, "Address unexpectedly resolved");
+  zassert_equal(res.amount, 0, "OUT.AMOUNT = %u", res.amount);
+}
+
+/*
+ * The IRKs batch read stops short (-1) on an incomplete IRK, which follows a matching one.
+ * The match must be reported in OUT, but the AAR must then stop with an error,
+ * instead of going on reading the next jobs as IRKs.
+ */
+ZTEST(nrf_aar_tests, test_short_batch_after_match)
+{
+  job_t in_jobs[] = {
+    {hash, 3, AAR_ATTR_HASH},
+    {prand, 3, AAR_ATTR_PRAND},
+    {good_irk, 16, AAR_ATTR_IRK},
+    {bad_irk, 8, AAR_ATTR_IRK},
+    {&bad_irk[8], 8, AAR_ATTR_OTHER},
+    {good_irk, 16, AAR_ATTR_IRK},
+    {NULL, 0, 0},
+  };
+  struct aar_result res;
+
+  run_aar(in_jobs, &res);
+
+  zassert_true(res.error, "No error reported");
+  zassert_equal(res.errorstatus, AAR_ERRORSTATUS_ERRORSTATUS_PrematureInptrEnd,
+                "ERRORSTATUS = %u", res.errorstatus);
+  zassert_equal(res.amount, 2, "OUT.AMOUNT = %u", res.amount);
+  zassert_equal(out_idx[0], 0, "Resolved with IRK %u", out_idx[0]);
+}
+
+/* The IRKs batch read stops short (-1) without any match */
+ZTEST(nrf_aar_tests, test_short_batch_no_match)
+{
+  job_t in_jobs[] = {
+    {hash, 3, AAR_ATTR_HASH},
+    {prand, 3, AAR_ATTR_PRAND},
+    {bad_irk, 16, AAR_ATTR_IRK},
+    {bad_irk, 8, AAR_ATTR_IRK},
+    {&bad_irk[8], 8, AAR_ATTR_OTHER},
+    {NULL, 0, 0},
+  };
+  struct aar_result res;
+
+  run_aar(in_jobs, &res);
+
+  zassert_true(res.error, "No error reported");
+  zassert_equal(res.errorstatus, AAR_ERRORSTATUS_ERRORSTATUS_PrematureInptrEnd,
+                "ERRORSTATUS = %u", res.errorstatus);
+  zassert_equal(res.amount, 0, "OUT.AMOUNT = %u", res.amount);
+}
 
 static void test_clean_aar(void *ignored)
 {
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Tests of the GPIOTE input events, with the inputs driven thru the GPIO test API
+ * (nrf_gpio_test_change_pin_level()), like a stimuli file or a test would:
+ *  * test_toggle_32_pins_1MHz: Toggle 32 input pins (spread over the 3 ports) at 1MHz for 100ms,
+ *    with all GPIOTE20 and GPIOTE30 channels monitoring some of them in toggle mode,
+ *    and SENSE enabled in the others which support it, and check every toggle generates
+ *    exactly the expected events.
+ *  * test_polarity: Check LoToHi, HiToLo, Toggle and None channels only get the events
+ *    for the edges they are configured for.
+ *  * test_partial_pins: Toggle only some of the monitored pins, and check only their
+ *    channels get events.
+ *  * test_reconfigure_channel: Move a channel to another pin, change its polarity, and disable
+ *    it, and check the old configuration does not generate events anymore.
+ *
+ * test_toggle_32_pins_1MHz doubles as a benchmark of the GPIO & GPIOTE input path.
+ * Run it under time, like:
+ *   time ./zephyr.exe -test=gpiote_port_toggle::test_toggle_32_pins_1MHz
+ */
+
+#include <stdint.h>
+#include <nrf.h>
+#include <hal/nrf_gpio.h>
+#include <hal/nrf_gpiote.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include "NRF_GPIO.h"
+
+#define N_TOGGLES 100000
+
+/* Pins driven in each port: P0 0..6, P1 0..15, P2 0..8 */
+static const uint32_t port_pins[] = {0x7F, 0xFFFF, 0x1FF};
+
+#define GPIOTE20_CHANNELS 8 /* Monitoring P1 0..7 in test_toggle_32_pins_1MHz */
+#define GPIOTE30_CHANNELS 4 /* Monitoring P0 0..3 in test_toggle_32_pins_1MHz */
+
+/* Drive all <pins> in this port to <level> */
+static void set_pins(unsigned int port, uint32_t pins, bool level)
+{
+	for (int pin = __builtin_ffs(pins) - 1; pin >= 0; pin = __builtin_ffs(pins) - 1) {
+		nrf_gpio_test_change_pin_level(port, pin, level);
+		pins &= ~BIT(pin);
+	}
+}
+
+/* Get (and clear) the mask of channels in this GPIOTE which got their EVENTS_IN */
+static uint32_t get_events(NRF_GPIOTE_Type *gpiote, int n_channels)
+{
+	uint32_t events = 0;
+
+	for (int ch = 0; ch < n_channels; ch++) {
+		nrf_gpiote_event_t evt = nrf_gpiote_in_event_get(ch);
+
+		if (nrf_gpiote_event_check(gpiote, evt)) {
+			events |= BIT(ch);
+		}
+		nrf_gpiote_event_clear(gpiote, evt);
+	}
+	return events;
+}
+
+static void configure_event(NRF_GPIOTE_Type *gpiote, int ch, uint32_t pin,
+			    nrf_gpiote_polarity_t polarity)
+{
+	nrf_gpiote_event_configure(gpiote, ch, pin, polarity);
+	nrf_gpiote_event_enable(gpiote, ch);
+}
+
+static void configure_pins(void)
+{
+	for (int port = 0; port < ARRAY_SIZE(port_pins); port++) {
+		for (int pin = 0; pin < 32; pin++) {
+			if ((port_pins[port] >> pin) & 1) {
+				nrf_gpio_cfg_sense_input(NRF_GPIO_PIN_MAP(port, pin),
+							 NRF_GPIO_PIN_NOPULL,
+							 port == 2 ? NRF_GPIO_PIN_NOSENSE
+								   : NRF_GPIO_PIN_SENSE_HIGH);
+			}
+		}
+	}
+
+	for (int ch = 0; ch < GPIOTE20_CHANNELS; ch++) {
+		configure_event(NRF_GPIOTE20, ch, NRF_GPIO_PIN_MAP(1, ch),
+				NRF_GPIOTE_POLARITY_TOGGLE);
+	}
+	for (int ch = 0; ch < GPIOTE30_CHANNELS; ch++) {
+		configure_event(NRF_GPIOTE30, ch, NRF_GPIO_PIN_MAP(0, ch),
+				NRF_GPIOTE_POLARITY_TOGGLE);
+	}
+}
+
+/* Before each test: disable all channels, set all pins low, and clear all events */
+static void gpiote_port_toggle_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int ch = 0; ch < GPIOTE20_CHANNELS; ch++) {
+		nrf_gpiote_te_default(NRF_GPIOTE20, ch);
+	}
+	for (int ch = 0; ch < GPIOTE30_CHANNELS; ch++) {
+		nrf_gpiote_te_default(NRF_GPIOTE30, ch);
+	}
+	for (int port = 0; port < ARRAY_SIZE(port_pins); port++) {
+		set_pins(port, port_pins[port], false);
+	}
+	(void)get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	(void)get_events(NRF_GPIOTE30, GPIOTE30_CHANNELS);
+}
+
+ZTEST(gpiote_port_toggle, test_toggle_32_pins_1MHz)
+{
+	uint32_t misses = 0;
+	bool level = false;
+
+	configure_pins();
+
+	for (int i = 0; i < N_TOGGLES; i++) {
+		level = !level;
+		for (int port = 0; port < ARRAY_SIZE(port_pins); port++) {
+			set_pins(port, port_pins[port], level);
+		}
+		misses += GPIOTE20_CHANNELS -
+			  __builtin_popcount(get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS));
+		misses += GPIOTE30_CHANNELS -
+			  __builtin_popcount(get_events(NRF_GPIOTE30, GPIOTE30_CHANNELS));
+		k_busy_wait(1);
+	}
+
+	zassert_equal(misses, 0, "%u GPIOTE events missed", misses);
+	zassert_equal(nrf_gpio_port_in_read(NRF_P0) & port_pins[0], 0);
+	zassert_equal(nrf_gpio_port_in_read(NRF_P1) & port_pins[1], 0);
+	zassert_equal(NRF_P0->LATCH, port_pins[0], "P0 SENSE not latched (0x%x)", NRF_P0->LATCH);
+	zassert_equal(NRF_P1->LATCH, port_pins[1], "P1 SENSE not latched (0x%x)", NRF_P1->LATCH);
+}
+
+ZTEST(gpiote_port_toggle, test_polarity)
+{
+	uint32_t events;
+
+	/* P1 0..3 in GPIOTE20 channels 0..3, and P0 0..3 in GPIOTE30 0..3, with each polarity */
+	static const nrf_gpiote_polarity_t polarity[] = {
+		NRF_GPIOTE_POLARITY_LOTOHI, NRF_GPIOTE_POLARITY_HITOLO,
+		NRF_GPIOTE_POLARITY_TOGGLE, NRF_GPIOTE_POLARITY_NONE};
+
+	for (int ch = 0; ch < ARRAY_SIZE(polarity); ch++) {
+		configure_event(NRF_GPIOTE20, ch, NRF_GPIO_PIN_MAP(1, ch), polarity[ch]);
+		configure_event(NRF_GPIOTE30, ch, NRF_GPIO_PIN_MAP(0, ch), polarity[ch]);
+	}
+
+	/* Rising edges in all pins together (one after the other) */
+	set_pins(1, 0xF, true);
+	set_pins(0, 0xF, true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(0) | BIT(2), "GPIOTE20 rising events 0x%x", events);
+	events = get_events(NRF_GPIOTE30, GPIOTE30_CHANNELS);
+	zassert_equal(events, BIT(0) | BIT(2), "GPIOTE30 rising events 0x%x", events);
+
+	/* Falling edges */
+	set_pins(1, 0xF, false);
+	set_pins(0, 0xF, false);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(1) | BIT(2), "GPIOTE20 falling events 0x%x", events);
+	events = get_events(NRF_GPIOTE30, GPIOTE30_CHANNELS);
+	zassert_equal(events, BIT(1) | BIT(2), "GPIOTE30 falling events 0x%x", events);
+
+	/* Setting a pin to the level it already has is not an edge */
+	set_pins(1, 0xF, false);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, 0, "GPIOTE20 events 0x%x without edges", events);
+}
+
+ZTEST(gpiote_port_toggle, test_partial_pins)
+{
+	uint32_t events;
+
+	configure_pins();
+
+	/* Only the odd monitored pins of P1, and P0.2 */
+	set_pins(1, 0xAA, true);
+	set_pins(0, BIT(2), true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, 0xAA, "GPIOTE20 events 0x%x", events);
+	events = get_events(NRF_GPIOTE30, GPIOTE30_CHANNELS);
+	zassert_equal(events, BIT(2), "GPIOTE30 events 0x%x", events);
+
+	/* Pins which are not monitored by any channel do not generate events */
+	set_pins(1, 0xFF00, true);
+	set_pins(0, 0x70, true);
+	set_pins(2, port_pins[2], true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, 0, "GPIOTE20 events 0x%x from unmonitored pins", events);
+	events = get_events(NRF_GPIOTE30, GPIOTE30_CHANNELS);
+	zassert_equal(events, 0, "GPIOTE30 events 0x%x from unmonitored pins", events);
+
+	/* The even pins of P1 */
+	set_pins(1, 0x55, true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, 0x55, "GPIOTE20 events 0x%x", events);
+}
+
+ZTEST(gpiote_port_toggle, test_reconfigure_channel)
+{
+	uint32_t events;
+
+	configure_event(NRF_GPIOTE20, 0, NRF_GPIO_PIN_MAP(1, 0), NRF_GPIOTE_POLARITY_TOGGLE);
+
+	/* Move the channel to P1.8: P1.0 does not generate events anymore */
+	configure_event(NRF_GPIOTE20, 0, NRF_GPIO_PIN_MAP(1, 8), NRF_GPIOTE_POLARITY_TOGGLE);
+	set_pins(1, BIT(0), true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, 0, "Events 0x%x from the old pin", events);
+	set_pins(1, BIT(8), true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(0), "Events 0x%x from the new pin", events);
+
+	/* Change only its polarity: The falling edge does not generate events anymore */
+	configure_event(NRF_GPIOTE20, 0, NRF_GPIO_PIN_MAP(1, 8), NRF_GPIOTE_POLARITY_LOTOHI);
+	set_pins(1, BIT(8), false);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, 0, "Events 0x%x from a falling edge in LoToHi", events);
+	set_pins(1, BIT(8), true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(0), "Events 0x%x from a rising edge in LoToHi", events);
+
+	/* Another channel in a pin of the same port: both work */
+	configure_event(NRF_GPIOTE20, 1, NRF_GPIO_PIN_MAP(1, 9), NRF_GPIOTE_POLARITY_TOGGLE);
+	set_pins(1, BIT(8), false);
+	set_pins(1, BIT(8) | BIT(9), true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(0) | BIT(1), "Events 0x%x from 2 channels", events);
+
+	/* Disable the channel: no more events from its pin, but the other channel still works */
+	nrf_gpiote_event_disable(NRF_GPIOTE20, 0);
+	set_pins(1, BIT(8) | BIT(9), false);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(1), "Events 0x%x after disabling channel 0", events);
+
+	/* And re-enabling it, it monitors the same pin again */
+	nrf_gpiote_event_enable(NRF_GPIOTE20, 0);
+	set_pins(1, BIT(8), true);
+	events = get_events(NRF_GPIOTE20, GPIOTE20_CHANNELS);
+	zassert_equal(events, BIT(0), "Events 0x%x after re-enabling channel 0", events);
+}
+
+ZTEST_SUITE(gpiote_port_toggle, NULL, NULL, gpiote_port_toggle_before, NULL, NULL);